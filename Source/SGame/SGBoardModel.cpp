@@ -0,0 +1,303 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGame.h"
+#include "SGBoardModel.h"
+
+FSGBoardModel::FSGBoardModel()
+	: GridWidth(0)
+	, GridHeight(0)
+	, BoardMask(0)
+{
+	FMemory::Memzero(ColumnMasks, sizeof(ColumnMasks));
+	FMemory::Memzero(NeighborMasks, sizeof(NeighborMasks));
+	FMemory::Memzero(BelowMasks, sizeof(BelowMasks));
+	Reset();
+}
+
+bool FSGBoardModel::Initialize(int32 inGridWidth, int32 inGridHeight)
+{
+	if (inGridWidth <= 0 || inGridHeight <= 0 || inGridWidth * inGridHeight > MaxGridCells)
+	{
+		UE_LOG(LogSGame, Error, TEXT("Board model cannot hold a %dx%d grid, max %d cells"), inGridWidth, inGridHeight, MaxGridCells);
+		return false;
+	}
+
+	GridWidth = inGridWidth;
+	GridHeight = inGridHeight;
+
+	const int32 CellNum = GridWidth * GridHeight;
+	BoardMask = (CellNum == MaxGridCells) ? ~FSGBoardMask(0) : (AddressToMask(CellNum) - 1);
+
+	// Precompute the column masks
+	FMemory::Memzero(ColumnMasks, sizeof(ColumnMasks));
+	for (int32 Address = 0; Address < CellNum; Address++)
+	{
+		ColumnMasks[Address % GridWidth] |= AddressToMask(Address);
+	}
+
+	// Precompute the below masks
+	FMemory::Memzero(BelowMasks, sizeof(BelowMasks));
+	for (int32 Address = 0; Address < CellNum; Address++)
+	{
+		BelowMasks[Address] = (AddressToMask(Address) - 1) & ColumnMasks[Address % GridWidth];
+	}
+
+	// Precompute the neighbor masks, the link is 8 directions
+	FMemory::Memzero(NeighborMasks, sizeof(NeighborMasks));
+	for (int32 Address = 0; Address < CellNum; Address++)
+	{
+		const int32 Column = Address % GridWidth;
+		const int32 Row = Address / GridWidth;
+		for (int32 OffsetY = -1; OffsetY <= 1; OffsetY++)
+		{
+			for (int32 OffsetX = -1; OffsetX <= 1; OffsetX++)
+			{
+				const int32 NeighborColumn = Column + OffsetX;
+				const int32 NeighborRow = Row + OffsetY;
+				if (NeighborColumn >= 0 && NeighborColumn < GridWidth && NeighborRow >= 0 && NeighborRow < GridHeight)
+				{
+					NeighborMasks[Address] |= AddressToMask(NeighborRow * GridWidth + NeighborColumn);
+				}
+			}
+		}
+	}
+
+	Reset();
+	return true;
+}
+
+void FSGBoardModel::Reset()
+{
+	FMemory::Memzero(TypeMasks, sizeof(TypeMasks));
+	EnemyMask = 0;
+	CanLinkEnemyMask = 0;
+	LinkedMask = 0;
+	SelectableMask = 0;
+	EmptyMask = BoardMask;
+}
+
+void FSGBoardModel::SetTile(int32 inGridAddress, ESGTileType inTileType, bool bEnemyTile, bool bCanLinkEnemy)
+{
+	checkSlow(static_cast<int32>(inTileType) < MaxTileTypes);
+
+	// Clear the old tile on the address first
+	ClearTile(inGridAddress);
+
+	const FSGBoardMask Bit = AddressToMask(inGridAddress);
+	TypeMasks[static_cast<int32>(inTileType)] |= Bit;
+	EmptyMask &= ~Bit;
+
+	// A new tile is shown as selectable
+	SelectableMask |= Bit;
+	if (bEnemyTile == true)
+	{
+		EnemyMask |= Bit;
+	}
+	if (bCanLinkEnemy == true)
+	{
+		CanLinkEnemyMask |= Bit;
+	}
+}
+
+void FSGBoardModel::ClearTile(int32 inGridAddress)
+{
+	const FSGBoardMask ClearMask = ~AddressToMask(inGridAddress);
+	for (int32 i = 0; i < MaxTileTypes; i++)
+	{
+		TypeMasks[i] &= ClearMask;
+	}
+	EnemyMask &= ClearMask;
+	CanLinkEnemyMask &= ClearMask;
+	LinkedMask &= ClearMask;
+	SelectableMask &= ClearMask;
+	EmptyMask |= AddressToMask(inGridAddress);
+}
+
+void FSGBoardModel::MoveTile(int32 inFromAddress, int32 inToAddress)
+{
+	checkSlow(IsEmpty(inToAddress));
+	if (inFromAddress == inToAddress)
+	{
+		return;
+	}
+
+	const FSGBoardMask FromBit = AddressToMask(inFromAddress);
+	const FSGBoardMask ToBit = AddressToMask(inToAddress);
+	const FSGBoardMask MoveBits = FromBit | ToBit;
+
+	// Flip both bits in every mask which contains the source bit
+	for (int32 i = 0; i < MaxTileTypes; i++)
+	{
+		if (TypeMasks[i] & FromBit)
+		{
+			TypeMasks[i] ^= MoveBits;
+		}
+	}
+	if (EnemyMask & FromBit)
+	{
+		EnemyMask ^= MoveBits;
+	}
+	if (CanLinkEnemyMask & FromBit)
+	{
+		CanLinkEnemyMask ^= MoveBits;
+	}
+	if (LinkedMask & FromBit)
+	{
+		LinkedMask ^= MoveBits;
+	}
+	if (SelectableMask & FromBit)
+	{
+		SelectableMask ^= MoveBits;
+	}
+	EmptyMask = (EmptyMask | FromBit) & ~ToBit;
+}
+
+FSGBoardMask FSGBoardModel::GetLinkableMask(int32 inLastGridAddress) const
+{
+	if (inLastGridAddress < 0)
+	{
+		// First tile, every tile can be linked
+		return BoardMask & ~EmptyMask;
+	}
+
+	const FSGBoardMask LastBit = AddressToMask(inLastGridAddress);
+	if (EmptyMask & LastBit)
+	{
+		return 0;
+	}
+
+	// Same tile type can always link together
+	FSGBoardMask LinkableMask = TypeMasks[static_cast<int32>(GetTileType(inLastGridAddress))];
+
+	// Enemy links
+	if (CanLinkEnemyMask & LastBit)
+	{
+		LinkableMask |= EnemyMask;
+	}
+	if (EnemyMask & LastBit)
+	{
+		LinkableMask |= CanLinkEnemyMask;
+	}
+
+	// Currently only the neighbor tiles can be selected
+	return LinkableMask & NeighborMasks[inLastGridAddress];
+}
+
+ESGTileType FSGBoardModel::GetTileType(int32 inGridAddress) const
+{
+	const FSGBoardMask Bit = AddressToMask(inGridAddress);
+	for (int32 i = 0; i < MaxTileTypes; i++)
+	{
+		if (TypeMasks[i] & Bit)
+		{
+			return static_cast<ESGTileType>(i);
+		}
+	}
+
+	checkSlow(false);
+	return ESGTileType::ETT_Sword;
+}
+
+bool FSGBoardModel::HasLegalLink(int32 inMinLinkLength) const
+{
+	const int32 MinLength = FMath::Max(inMinLinkLength, 1);
+
+	// Same type components, grown with the bitboard dilation until they stop growing
+	for (int32 i = 0; i < MaxTileTypes; i++)
+	{
+		FSGBoardMask RemainMask = TypeMasks[i];
+		while (RemainMask != 0)
+		{
+			FSGBoardMask ComponentMask = AddressToMask(LowestAddress(RemainMask));
+			for (;;)
+			{
+				const FSGBoardMask GrownMask = DilateMask(ComponentMask) & TypeMasks[i];
+				if (GrownMask == ComponentMask)
+				{
+					break;
+				}
+				ComponentMask = GrownMask;
+			}
+			RemainMask &= ~ComponentMask;
+
+			if (CountBits(ComponentMask) >= MinLength && HasLinkPath(ComponentMask, MinLength) == true)
+			{
+				return true;
+			}
+		}
+	}
+
+	// The enemy links join the enemy tiles and the tiles can link enemy of different types
+	FSGBoardMask RemainMask = EnemyMask;
+	while (RemainMask != 0)
+	{
+		FSGBoardMask ComponentMask = AddressToMask(LowestAddress(RemainMask));
+		FSGBoardMask FrontierMask = ComponentMask;
+		while (FrontierMask != 0)
+		{
+			const FSGBoardMask NewMask = GetLinkableMask(PopLowestAddress(FrontierMask)) & ~ComponentMask;
+			ComponentMask |= NewMask;
+			FrontierMask |= NewMask;
+		}
+		RemainMask &= ~ComponentMask;
+
+		if (CountBits(ComponentMask) >= MinLength && HasLinkPath(ComponentMask, MinLength) == true)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+FSGBoardMask FSGBoardModel::DilateMask(FSGBoardMask inMask) const
+{
+	// Spread along the row first, the edge columns should not wrap to the next row
+	const FSGBoardMask RowMask = inMask | ((inMask & ~ColumnMasks[GridWidth - 1]) << 1) | ((inMask & ~ColumnMasks[0]) >> 1);
+	if (GridHeight <= 1)
+	{
+		return RowMask & BoardMask;
+	}
+
+	// Then along the column
+	return (RowMask | (RowMask << GridWidth) | (RowMask >> GridWidth)) & BoardMask;
+}
+
+bool FSGBoardModel::HasLinkPath(FSGBoardMask inComponentMask, int32 inLinkLength) const
+{
+	// Any connected component of 3 tiles has a 3 tiles path, a longer path may not exist, e.g. a star
+	if (inLinkLength <= 3)
+	{
+		return true;
+	}
+
+	FSGBoardMask StartMask = inComponentMask;
+	while (StartMask != 0)
+	{
+		const int32 StartAddress = PopLowestAddress(StartMask);
+		if (FindLinkPath(StartAddress, AddressToMask(StartAddress), inLinkLength - 1) == true)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FSGBoardModel::FindLinkPath(int32 inLastGridAddress, FSGBoardMask inVisitedMask, int32 inRemainNum) const
+{
+	if (inRemainNum <= 0)
+	{
+		return true;
+	}
+
+	FSGBoardMask NextMask = GetLinkableMask(inLastGridAddress) & ~inVisitedMask;
+	while (NextMask != 0)
+	{
+		const int32 NextAddress = PopLowestAddress(NextMask);
+		if (FindLinkPath(NextAddress, inVisitedMask | AddressToMask(NextAddress), inRemainNum - 1) == true)
+		{
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,178 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SGame.h"
+#include "SGTileStructs.h"
+
+/** One bit per grid address, bit N stands for grid address N */
+typedef uint64 FSGBoardMask;
+
+/**
+ * Compact bitboard representation of the grid, kept alongside the tile actors.
+ * Every board question (neighbors, holes, same type tiles, linkability) can be
+ * answered with shifts and masks, without touching the tile actors.
+ */
+struct SGAME_API FSGBoardModel
+{
+	/** Max tile type num, should cover all the ESGTileType values */
+	static const int32 MaxTileTypes = 8;
+
+	/** The bitboard can only hold this many grid addresses */
+	static const int32 MaxGridCells = 64;
+
+	FSGBoardModel();
+
+	/** Initialize the model for a grid size, all the cells become empty */
+	bool Initialize(int32 inGridWidth, int32 inGridHeight);
+
+	/** Clear all the cells, the grid size is kept */
+	void Reset();
+
+	/** Put a tile into the grid address, the old tile on it will be replaced */
+	void SetTile(int32 inGridAddress, ESGTileType inTileType, bool bEnemyTile, bool bCanLinkEnemy);
+
+	/** Remove the tile from the grid address, the cell becomes empty */
+	void ClearTile(int32 inGridAddress);
+
+	/** Move a tile from one address to another empty address */
+	void MoveTile(int32 inFromAddress, int32 inToAddress);
+
+	/**
+	* Get all the grid addresses which can be linked after the last link tile
+	*
+	* @param inLastGridAddress the last tile address in the link line, -1 means no link line
+	*
+	* @return mask of the linkable grid addresses
+	*/
+	FSGBoardMask GetLinkableMask(int32 inLastGridAddress) const;
+
+	/** Whether the test address can be linked after the last address */
+	bool CanLink(int32 inLastGridAddress, int32 inTestGridAddress) const
+	{
+		return (GetLinkableMask(inLastGridAddress) & AddressToMask(inTestGridAddress)) != 0;
+	}
+
+	/**
+	* Whether any link line of the min length exists on the board. The tiles are split into the connected
+	* components of each tile type and of the enemy links, a component smaller than the min length cannot
+	* hold the link line, so only the large components are searched, and only if the min length is over 3
+	*/
+	bool HasLegalLink(int32 inMinLinkLength) const;
+
+	/** Grow the mask by one cell in the 8 directions */
+	FSGBoardMask DilateMask(FSGBoardMask inMask) const;
+
+	/** Get the mask of the tiles with the tile type */
+	FSGBoardMask GetTypeMask(ESGTileType inTileType) const { return TypeMasks[static_cast<int32>(inTileType)]; }
+
+	/** Get the tile type on the grid address, only valid if the cell is not empty */
+	ESGTileType GetTileType(int32 inGridAddress) const;
+
+	/** Get the cells in the column */
+	FSGBoardMask GetColumnMask(int32 inColumnIndex) const { return ColumnMasks[inColumnIndex]; }
+
+	/** Get the 8 directions neighbor cells of the address, including itself */
+	FSGBoardMask GetNeighborMask(int32 inGridAddress) const { return NeighborMasks[inGridAddress]; }
+
+	/** Get the cells in the same column, and below the grid address */
+	FSGBoardMask GetBelowMask(int32 inGridAddress) const { return BelowMasks[inGridAddress]; }
+
+	/** How many empty cells in the column */
+	int32 GetColumnHoleNum(int32 inColumnIndex) const { return CountBits(EmptyMask & ColumnMasks[inColumnIndex]); }
+
+	/** Whether the grid address is empty */
+	bool IsEmpty(int32 inGridAddress) const { return (EmptyMask & AddressToMask(inGridAddress)) != 0; }
+
+	/** Whether the grid address is an enemy tile */
+	bool IsEnemy(int32 inGridAddress) const { return (EnemyMask & AddressToMask(inGridAddress)) != 0; }
+
+	/** Whether the grid address is selectable */
+	bool IsSelectable(int32 inGridAddress) const { return (SelectableMask & AddressToMask(inGridAddress)) != 0; }
+
+	/** Whether the grid address is linked */
+	bool IsLinked(int32 inGridAddress) const { return (LinkedMask & AddressToMask(inGridAddress)) != 0; }
+
+	int32 GetGridWidth() const { return GridWidth; }
+	int32 GetGridHeight() const { return GridHeight; }
+	int32 GetGridCellNum() const { return GridWidth * GridHeight; }
+
+	/** Mask with all the cells on the grid */
+	FSGBoardMask GetBoardMask() const { return BoardMask; }
+
+	/** Convert a grid address into a single bit mask */
+	static FORCEINLINE FSGBoardMask AddressToMask(int32 inGridAddress)
+	{
+		checkSlow(inGridAddress >= 0 && inGridAddress < MaxGridCells);
+		return FSGBoardMask(1) << inGridAddress;
+	}
+
+	/** Count the set bits in the mask */
+	static FORCEINLINE int32 CountBits(FSGBoardMask inMask)
+	{
+		inMask = inMask - ((inMask >> 1) & 0x5555555555555555ull);
+		inMask = (inMask & 0x3333333333333333ull) + ((inMask >> 2) & 0x3333333333333333ull);
+		inMask = (inMask + (inMask >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+		return static_cast<int32>((inMask * 0x0101010101010101ull) >> 56);
+	}
+
+	/** Get the lowest set bit address, the mask should not be empty */
+	static FORCEINLINE int32 LowestAddress(FSGBoardMask inMask)
+	{
+		checkSlow(inMask != 0);
+		const uint32 LowWord = static_cast<uint32>(inMask);
+		if (LowWord != 0)
+		{
+			return static_cast<int32>(FMath::CountTrailingZeros(LowWord));
+		}
+		return 32 + static_cast<int32>(FMath::CountTrailingZeros(static_cast<uint32>(inMask >> 32)));
+	}
+
+	/** Pop the lowest set bit from the mask, and return its address */
+	static FORCEINLINE int32 PopLowestAddress(FSGBoardMask& inOutMask)
+	{
+		const int32 Address = LowestAddress(inOutMask);
+		inOutMask &= inOutMask - 1;
+		return Address;
+	}
+
+	/** One mask per tile type */
+	FSGBoardMask TypeMasks[MaxTileTypes];
+
+	/** Enemy tiles */
+	FSGBoardMask EnemyMask;
+
+	/** Tiles can link to the enemy tiles (e.g sword or arrow) */
+	FSGBoardMask CanLinkEnemyMask;
+
+	/** Tiles shown as linked, the linked and selectable status move with the tile */
+	FSGBoardMask LinkedMask;
+
+	/** Tiles shown as selectable, a new tile is selectable */
+	FSGBoardMask SelectableMask;
+
+	/** Cells without tile */
+	FSGBoardMask EmptyMask;
+
+private:
+	/** Whether the component holds a link line of the length */
+	bool HasLinkPath(FSGBoardMask inComponentMask, int32 inLinkLength) const;
+
+	/** Depth first search for a link line which links the remaining num tiles after the last address */
+	bool FindLinkPath(int32 inLastGridAddress, FSGBoardMask inVisitedMask, int32 inRemainNum) const;
+
+	int32 GridWidth;
+	int32 GridHeight;
+
+	/** All the cells on the grid */
+	FSGBoardMask BoardMask;
+
+	/** Precomputed cells for each column */
+	FSGBoardMask ColumnMasks[MaxGridCells];
+
+	/** Precomputed 8 directions neighbors for each address, including itself */
+	FSGBoardMask NeighborMasks[MaxGridCells];
+
+	/** The cells below each address in its column, precomputed */
+	FSGBoardMask BelowMasks[MaxGridCells];
+};
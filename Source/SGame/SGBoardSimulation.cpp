@@ -0,0 +1,527 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGame.h"
+#include "SGBoardSimulation.h"
+
+FSGBoardSimulation::FSGBoardSimulation()
+	: SpawnRound(1)
+	, SpawnTableRound(0)
+	, bHasSpawnRamp(false)
+{
+}
+
+bool FSGBoardSimulation::Initialize(int32 inGridWidth, int32 inGridHeight, int32 inRandomSeed)
+{
+	RandomStream.Initialize(inRandomSeed);
+
+	FSGSimTile EmptyTile;
+	EmptyTile.ArchetypeID = INDEX_NONE;
+	FMemory::Memzero(EmptyTile.LifeArmorInfo);
+	Cells.Init(EmptyTile, inGridWidth * inGridHeight);
+
+	return BoardModel.Initialize(inGridWidth, inGridHeight);
+}
+
+void FSGBoardSimulation::SetArchetypes(const TArray<FSGTileArchetype>& inArchetypes)
+{
+	Archetypes = inArchetypes;
+
+	// A new library always rebuilds the spawn table
+	bHasSpawnRamp = false;
+	for (const FSGTileArchetype& Archetype : Archetypes)
+	{
+		bHasSpawnRamp |= (Archetype.ProbabilityGrowthPerRound != 0);
+	}
+	SpawnTableRound = 0;
+	SetSpawnRound(SpawnRound);
+}
+
+void FSGBoardSimulation::SetSpawnRound(int32 inRound)
+{
+	SpawnRound = FMath::Max(inRound, 1);
+
+	// Without a ramp every round spawns by the first round table
+	const int32 TableRound = (bHasSpawnRamp == true) ? SpawnRound : 1;
+	if (Archetypes.Num() > 0 && TableRound != SpawnTableRound)
+	{
+		BuildSpawnTable(TableRound);
+	}
+}
+
+void FSGBoardSimulation::BuildSpawnTable(int32 inRound)
+{
+	const int32 ArchetypeNum = Archetypes.Num();
+	SpawnTableRound = inRound;
+	SpawnAliasProbabilities.SetNumUninitialized(ArchetypeNum);
+	SpawnAliasIndices.SetNumUninitialized(ArchetypeNum);
+	float* AliasProbabilities = SpawnAliasProbabilities.GetData();
+	int32* AliasIndices = SpawnAliasIndices.GetData();
+
+	float TotalProbability = 0;
+	for (const FSGTileArchetype& Archetype : Archetypes)
+	{
+		TotalProbability += Archetype.GetSpawnProbability(inRound);
+	}
+
+	if (TotalProbability <= 0)
+	{
+		// Nothing can spawn by the probability, fall back to the first archetype
+		for (int32 i = 0; i < ArchetypeNum; i++)
+		{
+			AliasProbabilities[i] = 0;
+			AliasIndices[i] = 0;
+		}
+		return;
+	}
+
+	// Scale the probabilities so the average is 1, then pair each under full entry with an over full one
+	TArray<int32, TInlineAllocator<16>> SmallEntries;
+	TArray<int32, TInlineAllocator<16>> LargeEntries;
+	for (int32 i = 0; i < ArchetypeNum; i++)
+	{
+		AliasProbabilities[i] = Archetypes[i].GetSpawnProbability(inRound) * ArchetypeNum / TotalProbability;
+		AliasIndices[i] = i;
+		if (AliasProbabilities[i] < 1.0f)
+		{
+			SmallEntries.Add(i);
+		}
+		else
+		{
+			LargeEntries.Add(i);
+		}
+	}
+
+	while (SmallEntries.Num() > 0 && LargeEntries.Num() > 0)
+	{
+		const int32 SmallEntry = SmallEntries.Pop(false);
+		const int32 LargeEntry = LargeEntries.Pop(false);
+
+		// The small entry is filled up by the large one
+		AliasIndices[SmallEntry] = LargeEntry;
+		AliasProbabilities[LargeEntry] = (AliasProbabilities[LargeEntry] + AliasProbabilities[SmallEntry]) - 1.0f;
+		if (AliasProbabilities[LargeEntry] < 1.0f)
+		{
+			SmallEntries.Add(LargeEntry);
+		}
+		else
+		{
+			LargeEntries.Add(LargeEntry);
+		}
+	}
+
+	// The rest are full, only off by the float rounding
+	for (int32 Entry : SmallEntries)
+	{
+		AliasProbabilities[Entry] = 1.0f;
+	}
+	for (int32 Entry : LargeEntries)
+	{
+		AliasProbabilities[Entry] = 1.0f;
+	}
+}
+
+void FSGBoardSimulation::Reset()
+{
+	for (FSGSimTile& Cell : Cells)
+	{
+		Cell.ArchetypeID = INDEX_NONE;
+	}
+	BoardModel.Reset();
+}
+
+void FSGBoardSimulation::SetTile(int32 inGridAddress, int32 inArchetypeID)
+{
+	checkSlow(Archetypes.IsValidIndex(inArchetypeID));
+	SetTile(inGridAddress, inArchetypeID, Archetypes[inArchetypeID].LifeArmorInfo);
+}
+
+void FSGBoardSimulation::SetTile(int32 inGridAddress, int32 inArchetypeID, const FTileLifeArmorInfo& inLifeArmorInfo)
+{
+	checkSlow(Cells.IsValidIndex(inGridAddress));
+	checkSlow(Archetypes.IsValidIndex(inArchetypeID));
+
+	FSGSimTile& Cell = Cells[inGridAddress];
+	Cell.ArchetypeID = inArchetypeID;
+	Cell.LifeArmorInfo = inLifeArmorInfo;
+
+	const FSGTileArchetype& Archetype = Archetypes[inArchetypeID];
+	BoardModel.SetTile(inGridAddress, Archetype.TileType, Archetype.Abilities.bEnemyTile, Archetype.Abilities.bCanLinkEnemy);
+}
+
+void FSGBoardSimulation::ClearTile(int32 inGridAddress)
+{
+	checkSlow(Cells.IsValidIndex(inGridAddress));
+
+	Cells[inGridAddress].ArchetypeID = INDEX_NONE;
+	BoardModel.ClearTile(inGridAddress);
+}
+
+int32 FSGBoardSimulation::SelectArchetype()
+{
+	const int32 ArchetypeNum = Archetypes.Num();
+	if (ArchetypeNum == 0)
+	{
+		return 0;
+	}
+
+	// Pick an entry of the round table, then keep it or take its alias
+	const int32 ArchetypeID = RandomStream.RandHelper(ArchetypeNum);
+	return (RandomStream.FRand() < SpawnAliasProbabilities[ArchetypeID]) ? ArchetypeID : SpawnAliasIndices[ArchetypeID];
+}
+
+bool FSGBoardSimulation::IsLinkValid(const TArray<int32>& inLinkAddresses, int32 inMinLinkLength) const
+{
+	if (inLinkAddresses.Num() < inMinLinkLength)
+	{
+		return false;
+	}
+
+	FSGBoardMask LinkedMask = 0;
+	int32 LastAddress = -1;
+	for (int32 GridAddress : inLinkAddresses)
+	{
+		if (Cells.IsValidIndex(GridAddress) == false || BoardModel.CanLink(LastAddress, GridAddress) == false)
+		{
+			return false;
+		}
+
+		// A tile can only be linked once
+		const FSGBoardMask Bit = FSGBoardModel::AddressToMask(GridAddress);
+		if ((LinkedMask & Bit) != 0)
+		{
+			return false;
+		}
+		LinkedMask |= Bit;
+		LastAddress = GridAddress;
+	}
+	return true;
+}
+
+void FSGBoardSimulation::EvaluateLink(const TArray<int32>& inLinkAddresses, FSGLinkResult& outResult) const
+{
+	outResult.Reset();
+
+	// First we should find the can take damage tiles in the link line
+	for (int32 GridAddress : inLinkAddresses)
+	{
+		const FSGTileArchetype& Archetype = GetTileArchetype(GridAddress);
+		if (Archetype.Abilities.bCanTakeDamage == true && Archetype.Abilities.bEnemyTile == true)
+		{
+			outResult.DamagedAddresses.Add(GridAddress);
+		}
+		else
+		{
+			// The other tile will be collected after the link
+			outResult.CollectedAddresses.Add(GridAddress);
+		}
+	}
+
+	// Cause damage to the take damage tiles
+	if (outResult.DamagedAddresses.Num() > 0)
+	{
+		// Currently the link line damage is simply the damage info of every damage causing tile
+		for (int32 GridAddress : inLinkAddresses)
+		{
+			const FSGTileArchetype& Archetype = GetTileArchetype(GridAddress);
+			if (Archetype.Abilities.bCanCauseDamage == true && Archetype.Abilities.bEnemyTile == false)
+			{
+				outResult.DamageInfos.Add(Archetype.CauseDamageInfo);
+			}
+		}
+
+		for (int32 GridAddress : outResult.DamagedAddresses)
+		{
+			FTileLifeArmorInfo& LifeArmorInfo = outResult.DamagedLifeArmorInfos[outResult.DamagedLifeArmorInfos.Add(Cells[GridAddress].LifeArmorInfo)];
+			if (TakeTileDamage(outResult.DamageInfos, LifeArmorInfo) == true)
+			{
+				// The killed tile is collected too
+				outResult.CollectedAddresses.Add(GridAddress);
+			}
+		}
+	}
+
+	for (int32 GridAddress : outResult.CollectedAddresses)
+	{
+		AddTileResources(GridAddress, outResult.SumupResources);
+	}
+}
+
+void FSGBoardSimulation::ApplyLinkDamage(const FSGLinkResult& inResult)
+{
+	checkSlow(inResult.DamagedAddresses.Num() == inResult.DamagedLifeArmorInfos.Num());
+	for (int32 i = 0; i < inResult.DamagedAddresses.Num(); i++)
+	{
+		Cells[inResult.DamagedAddresses[i]].LifeArmorInfo = inResult.DamagedLifeArmorInfos[i];
+	}
+}
+
+void FSGBoardSimulation::CollectTiles(const TArray<int32>& inGridAddresses)
+{
+	for (int32 GridAddress : inGridAddresses)
+	{
+		ClearTile(GridAddress);
+	}
+}
+
+int32 FSGBoardSimulation::Refill(TArray<FSGCellMove>& outMoves)
+{
+	CompactColumns(Cells, BoardModel.GetGridWidth(), BoardModel.GetGridHeight(), outMoves);
+
+	int32 NewTileNum = 0;
+	for (FSGCellMove& Move : outMoves)
+	{
+		if (Move.FromAddress >= 0)
+		{
+			// The moves in each column are bottom-up so the target is always empty
+			BoardModel.MoveTile(Move.FromAddress, Move.ToAddress);
+			continue;
+		}
+
+		// Spawn the new tile in the hole
+		Move.ArchetypeID = SelectArchetype();
+		SetTile(Move.ToAddress, Move.ArchetypeID);
+		NewTileNum++;
+	}
+	return NewTileNum;
+}
+
+bool FSGBoardSimulation::Shuffle(int32 inMinLinkLength, TArray<FSGCellMove>& outMoves)
+{
+	outMoves.Reset();
+
+	// The tiles to permute, in the address order
+	TArray<int32> TileAddresses;
+	TArray<FSGSimTile> SourceTiles;
+	FSGBoardMask TileMask = BoardModel.GetLinkableMask(-1);
+	while (TileMask != 0)
+	{
+		const int32 GridAddress = FSGBoardModel::PopLowestAddress(TileMask);
+		TileAddresses.Add(GridAddress);
+		SourceTiles.Add(Cells[GridAddress]);
+	}
+
+	// ShuffleOrder[i] is the source tile put on TileAddresses[i]
+	TArray<int32> ShuffleOrder;
+	ShuffleOrder.SetNum(TileAddresses.Num());
+	for (int32 i = 0; i < ShuffleOrder.Num(); i++)
+	{
+		ShuffleOrder[i] = i;
+	}
+
+	auto ApplyShuffleOrder = [this, &TileAddresses, &SourceTiles, &ShuffleOrder]()
+	{
+		for (int32 i = 0; i < TileAddresses.Num(); i++)
+		{
+			const FSGSimTile& SourceTile = SourceTiles[ShuffleOrder[i]];
+			SetTile(TileAddresses[i], SourceTile.ArchetypeID, SourceTile.LifeArmorInfo);
+		}
+	};
+
+	// A random layout is rarely dead, a few tries are enough
+	static const int32 ShuffleAttemptNum = 8;
+	bool bFound = false;
+	for (int32 Attempt = 0; Attempt < ShuffleAttemptNum && bFound == false; Attempt++)
+	{
+		for (int32 i = ShuffleOrder.Num() - 1; i > 0; i--)
+		{
+			ShuffleOrder.Swap(i, RandomStream.RandHelper(i + 1));
+		}
+		ApplyShuffleOrder();
+		bFound = BoardModel.HasLegalLink(inMinLinkLength);
+	}
+
+	// Lay the most common tile type on a row snake, every two cells in a row of a full board are neighbors
+	if (bFound == false && TileAddresses.Num() == BoardModel.GetGridCellNum())
+	{
+		int32 TypeTileNums[FSGBoardModel::MaxTileTypes] = { 0 };
+		int32 LinkType = 0;
+		for (const FSGSimTile& SourceTile : SourceTiles)
+		{
+			const int32 TileType = static_cast<int32>(Archetypes[SourceTile.ArchetypeID].TileType);
+			if (++TypeTileNums[TileType] > TypeTileNums[LinkType])
+			{
+				LinkType = TileType;
+			}
+		}
+
+		if (TypeTileNums[LinkType] >= inMinLinkLength)
+		{
+			const int32 GridWidth = BoardModel.GetGridWidth();
+			TArray<int32> LinkTiles;
+			TArray<int32> OtherTiles;
+			for (int32 i = 0; i < ShuffleOrder.Num(); i++)
+			{
+				const bool bLinkType = static_cast<int32>(Archetypes[SourceTiles[ShuffleOrder[i]].ArchetypeID].TileType) == LinkType;
+				if (bLinkType == true && LinkTiles.Num() < inMinLinkLength)
+				{
+					LinkTiles.Add(ShuffleOrder[i]);
+				}
+				else
+				{
+					OtherTiles.Add(ShuffleOrder[i]);
+				}
+			}
+
+			// The full board addresses are the tile indices, the odd rows run backward
+			int32 OtherIndex = 0;
+			for (int32 SnakeIndex = 0; SnakeIndex < ShuffleOrder.Num(); SnakeIndex++)
+			{
+				const int32 Row = SnakeIndex / GridWidth;
+				const int32 Column = ((Row % 2) == 0) ? (SnakeIndex % GridWidth) : (GridWidth - 1 - SnakeIndex % GridWidth);
+				ShuffleOrder[Row * GridWidth + Column] = (SnakeIndex < LinkTiles.Num()) ? LinkTiles[SnakeIndex] : OtherTiles[OtherIndex++];
+			}
+			ApplyShuffleOrder();
+			bFound = BoardModel.HasLegalLink(inMinLinkLength);
+		}
+	}
+
+	if (bFound == false)
+	{
+		// Put the board back
+		for (int32 i = 0; i < ShuffleOrder.Num(); i++)
+		{
+			ShuffleOrder[i] = i;
+		}
+		ApplyShuffleOrder();
+		return false;
+	}
+
+	for (int32 i = 0; i < ShuffleOrder.Num(); i++)
+	{
+		if (ShuffleOrder[i] != i)
+		{
+			FSGCellMove& Move = outMoves[outMoves.AddUninitialized()];
+			Move.FromAddress = TileAddresses[ShuffleOrder[i]];
+			Move.ToAddress = TileAddresses[i];
+			Move.FallRows = 0;
+			Move.ArchetypeID = SourceTiles[ShuffleOrder[i]].ArchetypeID;
+		}
+	}
+	return true;
+}
+
+bool FSGBoardSimulation::ResolveEnemies(FSGEnemyAttackResult& outResult) const
+{
+	outResult.EnemyNum = 0;
+	outResult.DamageCanBeShield = 0;
+	outResult.DamageDirectToHP = 0;
+
+	FSGBoardMask EnemyMask = BoardModel.EnemyMask;
+	while (EnemyMask != 0)
+	{
+		const FTileDamageInfo& DamageInfo = GetTileArchetype(FSGBoardModel::PopLowestAddress(EnemyMask)).CauseDamageInfo;
+		outResult.DamageCanBeShield += DamageInfo.InitialDamage * (1 - DamageInfo.PiercingArmorRatio);
+		outResult.DamageDirectToHP += DamageInfo.InitialDamage * DamageInfo.PiercingArmorRatio;
+		outResult.EnemyNum++;
+	}
+
+	return outResult.EnemyNum > 0;
+}
+
+void FSGBoardSimulation::AddTileResources(int32 inGridAddress, float (&inOutSumupResources)[SGResourceTypeNum]) const
+{
+	for (const FTileResourceUnit& Resource : GetTileArchetype(inGridAddress).TileResourceArray)
+	{
+		const int32 ResourceIndex = static_cast<int32>(Resource.ResourceType);
+		checkSlow(ResourceIndex < SGResourceTypeNum);
+		inOutSumupResources[ResourceIndex] += Resource.ResourceAmount;
+	}
+}
+
+bool FSGBoardSimulation::TakeTileDamage(const TArray<FTileDamageInfo>& inDamageInfos, FTileLifeArmorInfo& inOutLifeArmorInfo)
+{
+	for (const FTileDamageInfo& DamageInfo : inDamageInfos)
+	{
+		if (TakeTileDamage(DamageInfo, inOutLifeArmorInfo) == true)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FSGBoardSimulation::TakeTileDamage(const FTileDamageInfo& inDamageInfo, FTileLifeArmorInfo& inOutLifeArmorInfo)
+{
+	// Calculate the piercing damage first
+	inOutLifeArmorInfo.CurrentLife -= inDamageInfo.InitialDamage * inDamageInfo.PiercingArmorRatio;
+	if (inOutLifeArmorInfo.CurrentLife < 0)
+	{
+		return true;
+	}
+
+	// Reduce the tile armor value
+	float ResultDamage = inDamageInfo.InitialDamage * (1 - inDamageInfo.PiercingArmorRatio);
+
+	// Currently the tile armor duracity is fix to 1 (1 armor absorb = 1 damage)
+	if (inOutLifeArmorInfo.CurrentArmor > 0)
+	{
+		const float ArmorBefore = inOutLifeArmorInfo.CurrentArmor;
+		inOutLifeArmorInfo.CurrentArmor = FMath::Clamp(ArmorBefore - ResultDamage, 0.0f, inOutLifeArmorInfo.ArmorMax);
+
+		ResultDamage = FMath::Max(ResultDamage - ArmorBefore, 0.0f);
+	}
+
+	// The damage don't absorb completely
+	if (ResultDamage > 0)
+	{
+		inOutLifeArmorInfo.CurrentLife -= ResultDamage;
+		if (inOutLifeArmorInfo.CurrentLife < 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int32 FSGBoardSimulation::CompactColumns(TArray<FSGSimTile>& inOutCells, int32 inGridWidth, int32 inGridHeight, TArray<FSGCellMove>& outMoves)
+{
+	checkSlow(inOutCells.Num() == inGridWidth * inGridHeight);
+
+	int32 HoleNum = 0;
+	outMoves.Reset();
+
+	for (int32 Column = 0; Column < inGridWidth; Column++)
+	{
+		// The bottom row has the lowest address, the write cursor points to the next row to fill
+		int32 WriteRow = 0;
+		for (int32 ReadRow = 0; ReadRow < inGridHeight; ReadRow++)
+		{
+			const int32 ReadAddress = ReadRow * inGridWidth + Column;
+			if (inOutCells[ReadAddress].ArchetypeID == INDEX_NONE)
+			{
+				continue;
+			}
+
+			if (ReadRow != WriteRow)
+			{
+				// Move the tile down to the write cursor
+				const int32 WriteAddress = WriteRow * inGridWidth + Column;
+				FSGCellMove& Move = outMoves[outMoves.AddUninitialized()];
+				Move.FromAddress = ReadAddress;
+				Move.ToAddress = WriteAddress;
+				Move.FallRows = ReadRow - WriteRow;
+				Move.ArchetypeID = inOutCells[ReadAddress].ArchetypeID;
+
+				inOutCells[WriteAddress] = inOutCells[ReadAddress];
+				inOutCells[ReadAddress].ArchetypeID = INDEX_NONE;
+			}
+			WriteRow++;
+		}
+
+		// The rows above the write cursor are the holes, new tiles spawn above the grid top
+		const int32 ColumnHoleNum = inGridHeight - WriteRow;
+		for (; WriteRow < inGridHeight; WriteRow++)
+		{
+			FSGCellMove& Move = outMoves[outMoves.AddUninitialized()];
+			Move.FromAddress = -1;
+			Move.ToAddress = WriteRow * inGridWidth + Column;
+			Move.FallRows = ColumnHoleNum;
+			Move.ArchetypeID = INDEX_NONE;
+		}
+		HoleNum += ColumnHoleNum;
+	}
+
+	return HoleNum;
+}
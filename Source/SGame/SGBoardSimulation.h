@@ -0,0 +1,298 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SGame.h"
+#include "SGTileStructs.h"
+#include "SGBoardModel.h"
+
+/** Resource slot num, one per resource type */
+static const int32 SGResourceTypeNum = static_cast<int32>(ESGResourceType::ETT_MAX);
+
+/**
+ * The rules of one tile library entry, resolved from the library override or the tile class defaults.
+ * The archetypes never change during the game, the tile on the board only refers to it by the tile type id.
+ */
+struct FSGTileArchetype
+{
+	/** Relative spawn probability of the first round */
+	float Probability;
+
+	/** How much the spawn probability changes each round, e.g. the enemies spawn more and more */
+	float ProbabilityGrowthPerRound;
+
+	/** Tile type, the link rule is by the type */
+	ESGTileType TileType;
+
+	/** What the tile can do */
+	FSGTileAbilities Abilities;
+
+	/** The damage the tile causes */
+	FTileDamageInfo CauseDamageInfo;
+
+	/** The life and armor of a new tile */
+	FTileLifeArmorInfo LifeArmorInfo;
+
+	/** The resources collected with the tile */
+	TArray<FTileResourceUnit> TileResourceArray;
+
+	FSGTileArchetype()
+		: Probability(1)
+		, ProbabilityGrowthPerRound(0)
+		, TileType(ESGTileType::ETT_Sword)
+	{
+		FMemory::Memzero(Abilities);
+		FMemory::Memzero(CauseDamageInfo);
+		FMemory::Memzero(LifeArmorInfo);
+	}
+
+	/** The relative spawn probability in the round, the first round is 1 */
+	float GetSpawnProbability(int32 inRound) const
+	{
+		return FMath::Max(0.0f, Probability + ProbabilityGrowthPerRound * (inRound - 1));
+	}
+};
+
+/** The mutable state of one cell on the simulation board */
+struct FSGSimTile
+{
+	/** The tile type id in the archetype table, INDEX_NONE for an empty cell */
+	int32 ArchetypeID;
+
+	/** Current life and armor of the tile */
+	FTileLifeArmorInfo LifeArmorInfo;
+};
+
+/** One cell move produced by the refill, the falling tiles first and then the new tiles of each column */
+struct FSGCellMove
+{
+	/** The old grid address, -1 for a new tile */
+	int32 FromAddress;
+
+	/** The new grid address */
+	int32 ToAddress;
+
+	/** How many rows the tile falls, for a new tile it is the row num the tile spawns above the address */
+	int32 FallRows;
+
+	/** The tile type id of the moving or new tile */
+	int32 ArchetypeID;
+};
+
+/** The outcome of one link line, evaluated without changing the board */
+struct FSGLinkResult
+{
+	/** The damage infos of the damage causing tiles in the link line */
+	TArray<FTileDamageInfo> DamageInfos;
+
+	/** The linked enemy tiles taking the damage */
+	TArray<int32> DamagedAddresses;
+
+	/** The life and armor of each damaged tile after the damage */
+	TArray<FTileLifeArmorInfo> DamagedLifeArmorInfos;
+
+	/** The tiles to collect, the linked non enemy tiles first, then the killed enemy tiles */
+	TArray<int32> CollectedAddresses;
+
+	/** The collected resources, using the resource type as index */
+	float SumupResources[SGResourceTypeNum];
+
+	FSGLinkResult() { Reset(); }
+
+	/** Clear the result, the array capacity is kept */
+	void Reset()
+	{
+		DamageInfos.Reset();
+		DamagedAddresses.Reset();
+		DamagedLifeArmorInfos.Reset();
+		CollectedAddresses.Reset();
+		FMemory::Memzero(SumupResources);
+	}
+};
+
+/** The enemy attack of one round */
+struct FSGEnemyAttackResult
+{
+	/** How many enemy tiles attack */
+	int32 EnemyNum;
+
+	/** Damage can be absorbed by the player armor */
+	float DamageCanBeShield;
+
+	/** Damage goes directly to the player hp */
+	float DamageDirectToHP;
+};
+
+/**
+ * Deterministic game rules on a plain board, without any actor or world.
+ * The grid actor owns one simulation and the tile actors only show its state, the same
+ * simulation can run headless: given the same seed and the same link lines, the board is
+ * always the same.
+ */
+class SGAME_API FSGBoardSimulation
+{
+public:
+	FSGBoardSimulation();
+
+	/**
+	* Initialize an empty board
+	*
+	* @param inGridWidth	the grid width
+	* @param inGridHeight	the grid height
+	* @param inRandomSeed	seed of the tile spawn random stream
+	*
+	* @return false if the board is too large for the board model
+	*/
+	bool Initialize(int32 inGridWidth, int32 inGridHeight, int32 inRandomSeed);
+
+	/** Set the tile archetype table, the tile type id is the index in the table */
+	void SetArchetypes(const TArray<FSGTileArchetype>& inArchetypes);
+
+	/** Clear all the cells, the grid size, archetypes and random stream are kept */
+	void Reset();
+
+	/** Put a new tile of the archetype on the grid address */
+	void SetTile(int32 inGridAddress, int32 inArchetypeID);
+
+	/** Put a tile of the archetype with the life and armor on the grid address */
+	void SetTile(int32 inGridAddress, int32 inArchetypeID, const FTileLifeArmorInfo& inLifeArmorInfo);
+
+	/** Remove the tile on the grid address */
+	void ClearTile(int32 inGridAddress);
+
+	/** Pick a tile type id by the spawn probability of the spawn round, O(1) by the alias table. Advances the random stream */
+	int32 SelectArchetype();
+
+	/** Set the round whose spawn probabilities the new tiles use, the spawn table is rebuilt when its round changes */
+	void SetSpawnRound(int32 inRound);
+
+	int32 GetSpawnRound() const { return SpawnRound; }
+
+	/** Whether the addresses form a valid link line, long enough and every tile can link to the previous one */
+	bool IsLinkValid(const TArray<int32>& inLinkAddresses, int32 inMinLinkLength) const;
+
+	/**
+	* Evaluate the link line, the linked damage causing tiles hit the linked enemy tiles, the killed
+	* enemy tiles and the other linked tiles are collected. The board is not changed
+	*
+	* @param inLinkAddresses	the link line grid addresses, in the link order
+	* @param outResult			the damage and collect result
+	*/
+	void EvaluateLink(const TArray<int32>& inLinkAddresses, FSGLinkResult& outResult) const;
+
+	/** Commit the damage of the evaluated link line to the damaged tiles */
+	void ApplyLinkDamage(const FSGLinkResult& inResult);
+
+	/** Remove the collected tiles from the board */
+	void CollectTiles(const TArray<int32>& inGridAddresses);
+
+	/** Commit the evaluated link line, the damage and then the collect */
+	void ApplyLink(const FSGLinkResult& inResult)
+	{
+		ApplyLinkDamage(inResult);
+		CollectTiles(inResult.CollectedAddresses);
+	}
+
+	/**
+	* Let the tiles fall to fill the holes, and spawn new tiles on the top of each column
+	*
+	* @param outMoves the falling tiles and the new tiles
+	*
+	* @return how many new tiles are spawned
+	*/
+	int32 Refill(TArray<FSGCellMove>& outMoves);
+
+	/**
+	* Permute the tiles on the board into a layout with a legal link, the tiles keep their life and armor.
+	* A few random layouts are tried first, then the most common tile type is laid on a row snake so it forms a link line
+	*
+	* @param inMinLinkLength	the min link line length
+	* @param outMoves			one move per tile changing its address, FallRows is 0
+	*
+	* @return false if no layout is found, the board is not changed then
+	*/
+	bool Shuffle(int32 inMinLinkLength, TArray<FSGCellMove>& outMoves);
+
+	/**
+	* Sum up the attack of the enemy tiles on the board
+	*
+	* @return true if there is any enemy tile
+	*/
+	bool ResolveEnemies(FSGEnemyAttackResult& outResult) const;
+
+	/** Add the resources of the tile on the grid address */
+	void AddTileResources(int32 inGridAddress, float (&inOutSumupResources)[SGResourceTypeNum]) const;
+
+	/**
+	* Apply the damage to the life and armor, the piercing damage goes to the life directly,
+	* the rest is absorbed by the armor first
+	*
+	* @return true if the tile is dead
+	*/
+	static bool TakeTileDamage(const TArray<FTileDamageInfo>& inDamageInfos, FTileLifeArmorInfo& inOutLifeArmorInfo);
+
+	/** Apply one damage info, the damage infos of a link are applied in order until the tile is dead */
+	static bool TakeTileDamage(const FTileDamageInfo& inDamageInfo, FTileLifeArmorInfo& inOutLifeArmorInfo);
+
+	/**
+	* Compact every column of the cells to the bottom, with a single bottom-up pass per column
+	*
+	* @param inOutCells		the cells, holes have ArchetypeID INDEX_NONE, will be compacted in place
+	* @param inGridWidth	the grid width
+	* @param inGridHeight	the grid height
+	* @param outMoves		the falling tiles and the holes left on the top of each column, the holes have ArchetypeID INDEX_NONE
+	*
+	* @return how many holes are in the move list
+	*/
+	static int32 CompactColumns(TArray<FSGSimTile>& inOutCells, int32 inGridWidth, int32 inGridHeight, TArray<FSGCellMove>& outMoves);
+
+	/** Get the tile on the grid address */
+	const FSGSimTile& GetTile(int32 inGridAddress) const { return Cells[inGridAddress]; }
+
+	/** Get the archetype of the tile type id */
+	const FSGTileArchetype& GetArchetype(int32 inArchetypeID) const { return Archetypes[inArchetypeID]; }
+
+	/** Get the archetype of the tile on the grid address, the cell should not be empty */
+	const FSGTileArchetype& GetTileArchetype(int32 inGridAddress) const { return Archetypes[Cells[inGridAddress].ArchetypeID]; }
+
+	const TArray<FSGTileArchetype>& GetArchetypes() const { return Archetypes; }
+
+	/** Get the bitboard of the board */
+	const FSGBoardModel& GetBoardModel() const { return BoardModel; }
+	FSGBoardModel& GetBoardModel() { return BoardModel; }
+
+	/** Get the tile spawn random stream */
+	FRandomStream& GetRandomStream() { return RandomStream; }
+
+	int32 GetGridCellNum() const { return Cells.Num(); }
+
+private:
+	/** Tile archetypes indexed by the tile type id */
+	TArray<FSGTileArchetype> Archetypes;
+
+	/** Build the spawn alias table of the round, replacing the table of the previous round */
+	void BuildSpawnTable(int32 inRound);
+
+	/** The round of the new tiles, and the round the spawn table is built for, 0 before it is built */
+	int32 SpawnRound;
+	int32 SpawnTableRound;
+
+	/** Whether any archetype changes its probability by the round, if not all the rounds share the first table */
+	bool bHasSpawnRamp;
+
+	/**
+	* Walker/Vose alias table of the spawn round, one entry per archetype.
+	* A draw picks an entry uniformly, then keeps it by its probability or takes its alias
+	*/
+	TArray<float> SpawnAliasProbabilities;
+	TArray<int32> SpawnAliasIndices;
+
+	/** Cells indexed by the grid address */
+	TArray<FSGSimTile> Cells;
+
+	/** Bitboard of the cells */
+	FSGBoardModel BoardModel;
+
+	/** The only random source of the simulation */
+	FRandomStream RandomStream;
+};
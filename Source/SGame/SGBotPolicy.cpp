@@ -0,0 +1,175 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGame.h"
+#include "SGBotPolicy.h"
+
+TUniquePtr<FSGBotPolicy> FSGBotPolicy::Create(const FString& inName)
+{
+	if (inName == TEXT("random"))
+	{
+		return MakeUnique<FSGRandomBotPolicy>();
+	}
+	if (inName == TEXT("greedy"))
+	{
+		return MakeUnique<FSGGreedyBotPolicy>();
+	}
+	if (inName == TEXT("search"))
+	{
+		return MakeUnique<FSGSearchBotPolicy>();
+	}
+	return nullptr;
+}
+
+float FSGBotPolicy::ScoreLink(const FSGLinkResult& inResult, int32 inLinkLength)
+{
+	float Score = 0;
+	for (int32 i = 0; i < SGResourceTypeNum; i++)
+	{
+		Score += inResult.SumupResources[i];
+	}
+
+	// The killed enemies are both damaged and collected
+	const int32 KilledNum = inResult.CollectedAddresses.Num() + inResult.DamagedAddresses.Num() - inLinkLength;
+	Score += inResult.DamagedAddresses.Num() * 1.0f + KilledNum * 5.0f;
+	return Score;
+}
+
+bool FSGRandomBotPolicy::ChooseLink(const FSGBoardSimulation& inSimulation, int32 inMinLinkLength, FRandomStream& inRandomStream, TArray<int32>& outLinkAddresses)
+{
+	const FSGBoardModel& BoardModel = inSimulation.GetBoardModel();
+	const FSGBoardMask TileMask = BoardModel.GetLinkableMask(-1);
+	const int32 TileNum = FSGBoardModel::CountBits(TileMask);
+	if (TileNum == 0)
+	{
+		return false;
+	}
+
+	// A few random starts, most boards have a long enough walk from one of them
+	for (int32 Attempt = 0; Attempt < 8; Attempt++)
+	{
+		// Pick the N-th tile on the board
+		FSGBoardMask StartMask = TileMask;
+		for (int32 Skip = inRandomStream.RandHelper(TileNum); Skip > 0; Skip--)
+		{
+			StartMask &= StartMask - 1;
+		}
+
+		outLinkAddresses.Reset();
+		FSGBoardMask VisitedMask = 0;
+		int32 LastAddress = FSGBoardModel::LowestAddress(StartMask);
+		while (LastAddress >= 0)
+		{
+			outLinkAddresses.Add(LastAddress);
+			VisitedMask |= FSGBoardModel::AddressToMask(LastAddress);
+
+			FSGBoardMask NextMask = BoardModel.GetLinkableMask(LastAddress) & ~VisitedMask;
+			const int32 NextNum = FSGBoardModel::CountBits(NextMask);
+			if (NextNum == 0)
+			{
+				break;
+			}
+			for (int32 Skip = inRandomStream.RandHelper(NextNum); Skip > 0; Skip--)
+			{
+				NextMask &= NextMask - 1;
+			}
+			LastAddress = FSGBoardModel::LowestAddress(NextMask);
+		}
+
+		if (outLinkAddresses.Num() >= inMinLinkLength)
+		{
+			return true;
+		}
+	}
+
+	outLinkAddresses.Reset();
+	return false;
+}
+
+bool FSGGreedyBotPolicy::ChooseLink(const FSGBoardSimulation& inSimulation, int32 inMinLinkLength, FRandomStream& inRandomStream, TArray<int32>& outLinkAddresses)
+{
+	const FSGBoardModel& BoardModel = inSimulation.GetBoardModel();
+	float BestScore = -1;
+	outLinkAddresses.Reset();
+
+	FSGBoardMask StartMask = BoardModel.GetLinkableMask(-1);
+	while (StartMask != 0)
+	{
+		WalkAddresses.Reset();
+		FSGBoardMask VisitedMask = 0;
+		int32 LastAddress = FSGBoardModel::PopLowestAddress(StartMask);
+		while (LastAddress >= 0)
+		{
+			WalkAddresses.Add(LastAddress);
+			VisitedMask |= FSGBoardModel::AddressToMask(LastAddress);
+
+			// Go to the neighbor with the fewest onward links, so the walk does not cut itself off early
+			FSGBoardMask NextMask = BoardModel.GetLinkableMask(LastAddress) & ~VisitedMask;
+			int32 NextAddress = -1;
+			int32 NextOnwardNum = MAX_int32;
+			while (NextMask != 0)
+			{
+				const int32 TestAddress = FSGBoardModel::PopLowestAddress(NextMask);
+				const FSGBoardMask TestVisitedMask = VisitedMask | FSGBoardModel::AddressToMask(TestAddress);
+				const int32 OnwardNum = FSGBoardModel::CountBits(BoardModel.GetLinkableMask(TestAddress) & ~TestVisitedMask);
+				if (OnwardNum < NextOnwardNum)
+				{
+					NextAddress = TestAddress;
+					NextOnwardNum = OnwardNum;
+				}
+			}
+			LastAddress = NextAddress;
+		}
+
+		if (WalkAddresses.Num() < inMinLinkLength)
+		{
+			continue;
+		}
+
+		inSimulation.EvaluateLink(WalkAddresses, LinkResult);
+		const float Score = ScoreLink(LinkResult, WalkAddresses.Num());
+		if (Score > BestScore)
+		{
+			BestScore = Score;
+			outLinkAddresses = WalkAddresses;
+		}
+	}
+
+	return outLinkAddresses.Num() > 0;
+}
+
+FSGSearchBotPolicy::FSGSearchBotPolicy()
+	: NodeBudget(20000)
+{
+}
+
+bool FSGSearchBotPolicy::ChooseLink(const FSGBoardSimulation& inSimulation, int32 inMinLinkLength, FRandomStream& inRandomStream, TArray<int32>& outLinkAddresses)
+{
+	FSGLinkSolverSettings Settings;
+	Settings.MinLinkLength = inMinLinkLength;
+	Settings.TopK = 1;
+	Settings.TimeBudgetSeconds = MAX_flt;
+	Settings.MaxNodeNum = NodeBudget;
+	Solver.Solve(inSimulation, Settings);
+
+	// The best damage path and the best resources path compete by the bot score
+	float BestScore = -1;
+	outLinkAddresses.Reset();
+	for (const TArray<FSGLinkSolution>* Ranking : { &Solver.GetBestByDamage(), &Solver.GetBestByResources() })
+	{
+		if (Ranking->Num() == 0)
+		{
+			continue;
+		}
+
+		const TArray<int32>& LinkAddresses = (*Ranking)[0].LinkAddresses;
+		inSimulation.EvaluateLink(LinkAddresses, LinkResult);
+		const float Score = ScoreLink(LinkResult, LinkAddresses.Num());
+		if (Score > BestScore)
+		{
+			BestScore = Score;
+			outLinkAddresses = LinkAddresses;
+		}
+	}
+
+	return outLinkAddresses.Num() > 0;
+}
@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SGame.h"
+#include "SGBoardSimulation.h"
+#include "SGLinkSolver.h"
+
+/**
+ * A player policy for the headless simulation, picks the link line of each round.
+ * One policy instance plays one game at a time, it may keep scratch data between the rounds.
+ */
+class SGAME_API FSGBotPolicy
+{
+public:
+	virtual ~FSGBotPolicy() {}
+
+	/** Name of the policy, same as the name to create it */
+	virtual const TCHAR* GetName() const = 0;
+
+	/**
+	* Choose the link line on the board
+	*
+	* @param inSimulation		the board to play
+	* @param inMinLinkLength	the min link line length of a valid link
+	* @param inRandomStream		the random stream of the player, so the game can be replayed
+	* @param outLinkAddresses	the chosen link line grid addresses
+	*
+	* @return false if the policy cannot find a valid link line
+	*/
+	virtual bool ChooseLink(const FSGBoardSimulation& inSimulation, int32 inMinLinkLength, FRandomStream& inRandomStream, TArray<int32>& outLinkAddresses) = 0;
+
+	/** Create the policy by name: random, greedy or search. Null for an unknown name */
+	static TUniquePtr<FSGBotPolicy> Create(const FString& inName);
+
+	/** The value of a link line for the bots, resources plus the damaged and killed enemies */
+	static float ScoreLink(const FSGLinkResult& inResult, int32 inLinkLength);
+};
+
+/** Random walk from a random tile, until no tile can be linked */
+class SGAME_API FSGRandomBotPolicy : public FSGBotPolicy
+{
+public:
+	virtual const TCHAR* GetName() const override { return TEXT("random"); }
+	virtual bool ChooseLink(const FSGBoardSimulation& inSimulation, int32 inMinLinkLength, FRandomStream& inRandomStream, TArray<int32>& outLinkAddresses) override;
+};
+
+/** Walk from every tile, always to the neighbor with the fewest onward links, keep the best scored walk */
+class SGAME_API FSGGreedyBotPolicy : public FSGBotPolicy
+{
+public:
+	virtual const TCHAR* GetName() const override { return TEXT("greedy"); }
+	virtual bool ChooseLink(const FSGBoardSimulation& inSimulation, int32 inMinLinkLength, FRandomStream& inRandomStream, TArray<int32>& outLinkAddresses) override;
+
+private:
+	TArray<int32> WalkAddresses;
+	FSGLinkResult LinkResult;
+};
+
+/** Best paths of the link solver with a node budget, picks the best scored of the top damage and top resources paths */
+class SGAME_API FSGSearchBotPolicy : public FSGBotPolicy
+{
+public:
+	FSGSearchBotPolicy();
+
+	virtual const TCHAR* GetName() const override { return TEXT("search"); }
+	virtual bool ChooseLink(const FSGBoardSimulation& inSimulation, int32 inMinLinkLength, FRandomStream& inRandomStream, TArray<int32>& outLinkAddresses) override;
+
+	/** Max visited path num of one search, the bot uses no time budget so the games can be replayed */
+	int32 NodeBudget;
+
+private:
+	FSGLinkSolver Solver;
+	FSGLinkResult LinkResult;
+};
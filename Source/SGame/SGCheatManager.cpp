@@ -6,11 +6,57 @@
 #include "SGEnemyTileBase.h"
 #include "SGPlayerController.h"
 #include "SGGrid.h"
+#include "SGGameMode.h"
 #include "SGSpritePawn.h"
+#include "SGMessageQueue.h"
+#include "SGLinkSolver.h"
+#include "SGParallelLinkSolver.h"
+#include "Async/Async.h"
+#include "iTween/iTEasing.h"
+#include "iTween/iTween.h"
 
-USGCheatManager::USGCheatManager()
+/** The seed of the random boards and tweens of the benchmarks, every run measures the same inputs */
+static const int32 BenchmarkSeed = 0x5347;
+
+/** Run the function the iterations times, and return the total seconds */
+template<typename FunctionType>
+static double TimeIterations(int32 inIterations, FunctionType Function)
+{
+	const double StartSeconds = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < inIterations; Iteration++)
+	{
+		Function();
+	}
+	return FPlatformTime::Seconds() - StartSeconds;
+}
+
+/** Random ease types and alphas of the tweens, the custom curves have no equation to compare with and are left out */
+static void MakeRandomEaseTweens(FRandomStream& inOutRandomStream, int32 inTweenNum, TArray<uint8>& outEaseTypes, TArray<float>& outAlphas)
+{
+	outEaseTypes.SetNumUninitialized(inTweenNum);
+	outAlphas.SetNumUninitialized(inTweenNum);
+	for (int32 i = 0; i < inTweenNum; i++)
+	{
+		outEaseTypes[i] = (uint8)inOutRandomStream.RandRange(0, EEaseType::EaseType::customCurve - 1);
+		outAlphas[i] = inOutRandomStream.FRand();
+	}
+}
+
+void USGCheatManager::ShowResult(const FString& inResult, bool bShowOnClient)
 {
-	MessageEndpoint = FMessageEndpoint::Builder("CheatManagerMessageEP");
+	UE_LOG(LogSGame, Display, TEXT("%s"), *inResult);
+	if (bShowOnClient == true)
+	{
+		GetOuterASGPlayerController()->ClientMessage(inResult);
+	}
+}
+
+void USGCheatManager::ShowResults(const TArray<FString>& inResults)
+{
+	for (const FString& Result : inResults)
+	{
+		ShowResult(Result);
+	}
 }
 
 void USGCheatManager::BeginAttack()
@@ -19,7 +65,10 @@ void USGCheatManager::BeginAttack()
 	for (TActorIterator<ASGEnemyTileBase> It(GetWorld()); It; ++It)
 	{
 		ASGEnemyTileBase* Tile = *It;
-		Tile->EnemyAttack();
+		if (Tile->IsInPool() == false)
+		{
+			Tile->EnemyAttack();
+		}
 	}
 }
 
@@ -34,11 +83,8 @@ void USGCheatManager::UseSkill(int32 inSkillIndex)
 
 void USGCheatManager::StartGame()
 {
-	if (MessageEndpoint.IsValid() == true)
-	{
-		// Test: Send game start message 		
-		MessageEndpoint->Publish(new FMessage_Gameplay_GameStart(), EMessageScope::Process);
-	}
+	// Test: Send game start message
+	FSGMessageQueue::Get().Publish<FMessage_Gameplay_GameStart>();
 
 	// Start the new round
 	NewRound();
@@ -46,34 +92,22 @@ void USGCheatManager::StartGame()
 
 void USGCheatManager::NewRound()
 {
-	if (MessageEndpoint.IsValid() == true)
-	{
-		// Test: Send game start message
-		FMessage_Gameplay_GameStatusUpdate* GameStatusUpdateMesssage = new FMessage_Gameplay_GameStatusUpdate();
-		GameStatusUpdateMesssage->NewGameStatus = ESGGameStatus::EGS_RondBegin;
-		MessageEndpoint->Publish(GameStatusUpdateMesssage, EMessageScope::Process);
-	}
+	// Test: Send new round message
+	FMessage_Gameplay_GameStatusUpdate& GameStatusUpdateMesssage = FSGMessageQueue::Get().Publish<FMessage_Gameplay_GameStatusUpdate>();
+	GameStatusUpdateMesssage.NewGameStatus = ESGGameStatus::EGS_RondBegin;
 }
 
 void USGCheatManager::ForceCollect()
 {
-	if (MessageEndpoint.IsValid() == true)
-	{
-		// Test: Send game start message
-		FMessage_Gameplay_CollectLinkLine* CollectLinkLineMessage = new FMessage_Gameplay_CollectLinkLine();
-		MessageEndpoint->Publish(CollectLinkLineMessage, EMessageScope::Process);
-	}
+	// Test: Send collect link line message
+	FSGMessageQueue::Get().Publish<FMessage_Gameplay_CollectLinkLine>();
 }
 
 void USGCheatManager::PlayerEndBuildPath()
 {
-	if (MessageEndpoint.IsValid() == true)
-	{
-		// Test: Send game start message
-		FMessage_Gameplay_GameStatusUpdate* GameStatusUpdateMesssage = new FMessage_Gameplay_GameStatusUpdate();
-		GameStatusUpdateMesssage->NewGameStatus = ESGGameStatus::EGS_PlayerEndBuildPath;
-		MessageEndpoint->Publish(GameStatusUpdateMesssage, EMessageScope::Process);
-	}
+	// Test: Send end build path message
+	FMessage_Gameplay_GameStatusUpdate& GameStatusUpdateMesssage = FSGMessageQueue::Get().Publish<FMessage_Gameplay_GameStatusUpdate>();
+	GameStatusUpdateMesssage.NewGameStatus = ESGGameStatus::EGS_PlayerEndBuildPath;
 }
 
 void USGCheatManager::SetHealth(int newHealth)
@@ -90,4 +124,339 @@ void USGCheatManager::ResetGrid()
 	{
 		((ASGGrid*)(*It))->ResetGrid();
 	}
-}
\ No newline at end of file
+}
+
+void USGCheatManager::ShuffleGrid()
+{
+	for (TActorIterator<ASGGrid> It(GetWorld()); It; ++It)
+	{
+		It->ShuffleGrid();
+	}
+}
+
+void USGCheatManager::BenchmarkCondense(int32 inMaxGridSize, int32 inIterations)
+{
+	inMaxGridSize = FMath::Clamp(inMaxGridSize, 2, 64);
+	inIterations = FMath::Max(inIterations, 1);
+
+	FRandomStream RandomStream(BenchmarkSeed);
+	TArray<FSGSimTile> SourceCells;
+	TArray<FSGSimTile> WorkingCells;
+	TArray<FSGCellMove> CellMoves;
+
+	for (int32 GridSize = 6; GridSize <= inMaxGridSize; GridSize = (GridSize < 8) ? 8 : GridSize * 2)
+	{
+		const int32 CellNum = GridSize * GridSize;
+		SourceCells.SetNumZeroed(CellNum);
+		for (int32 i = 0; i < CellNum; i++)
+		{
+			// About one third of the cells become holes, like a long link collect
+			SourceCells[i].ArchetypeID = RandomStream.FRand() < 0.33f ? INDEX_NONE : 0;
+		}
+		CellMoves.Reserve(CellNum);
+
+		double TotalSeconds = 0;
+		int32 TotalMoves = 0;
+		for (int32 Iteration = 0; Iteration < inIterations; Iteration++)
+		{
+			WorkingCells = SourceCells;
+
+			const double StartSeconds = FPlatformTime::Seconds();
+			FSGBoardSimulation::CompactColumns(WorkingCells, GridSize, GridSize, CellMoves);
+			TotalSeconds += FPlatformTime::Seconds() - StartSeconds;
+			TotalMoves += CellMoves.Num();
+		}
+
+		ShowResult(FString::Printf(TEXT("Condense %dx%d: %.3f us per run, %d moves per run"), GridSize, GridSize, TotalSeconds * 1000000.0 / inIterations, TotalMoves / inIterations));
+	}
+}
+
+void USGCheatManager::ShowMessageStats()
+{
+	const FSGMessageQueue& MessageQueue = FSGMessageQueue::Get();
+	ShowResult(FString::Printf(TEXT("Message allocations: %d total, %d this frame"), MessageQueue.GetAllocationNum(), MessageQueue.GetFrameAllocationNum()));
+}
+
+void USGCheatManager::BenchmarkLinkSolver(int32 inIterations, int32 inTopK, float inTimeBudgetMs)
+{
+	inIterations = FMath::Max(inIterations, 1);
+
+	ASGGameMode* GameMode = Cast<ASGGameMode>(UGameplayStatics::GetGameMode(this));
+	if (GameMode == nullptr || GameMode->GetCurrentGrid() == nullptr)
+	{
+		return;
+	}
+
+	FSGLinkSolverSettings Settings;
+	Settings.MinLinkLength = GameMode->GetMinimunLengthLinkLineRequired();
+	Settings.TopK = inTopK;
+	Settings.TimeBudgetSeconds = inTimeBudgetMs / 1000.0f;
+
+	FSGLinkSolver Solver;
+	double TotalSeconds = 0;
+	double MaxSeconds = 0;
+	int32 BudgetExceededNum = 0;
+	for (int32 Iteration = 0; Iteration < inIterations; Iteration++)
+	{
+		const double StartSeconds = FPlatformTime::Seconds();
+		if (Solver.Solve(GameMode->GetCurrentGrid()->GetSimulation(), Settings) == false)
+		{
+			BudgetExceededNum++;
+		}
+		const double Seconds = FPlatformTime::Seconds() - StartSeconds;
+		TotalSeconds += Seconds;
+		MaxSeconds = FMath::Max(MaxSeconds, Seconds);
+	}
+
+	TArray<FString> Results;
+	Results.Add(FString::Printf(TEXT("Link solver: %.3f ms avg, %.3f ms max, %d nodes, %d pruned, %d of %d runs out of budget"),
+		TotalSeconds * 1000.0 / inIterations, MaxSeconds * 1000.0, Solver.GetVisitedNodeNum(), Solver.GetPrunedNodeNum(), BudgetExceededNum, inIterations));
+	for (const FSGLinkSolution& Solution : Solver.GetBestByDamage())
+	{
+		Results.Add(FString::Printf(TEXT("  Damage %.1f, resources %.1f, killed %d, path %s"), Solution.DamageDealt, Solution.Resources, Solution.KilledNum,
+			*FString::JoinBy(Solution.LinkAddresses, TEXT(" "), [](int32 GridAddress) { return FString::FromInt(GridAddress); })));
+	}
+	for (const FSGLinkSolution& Solution : Solver.GetBestByResources())
+	{
+		Results.Add(FString::Printf(TEXT("  Resources %.1f, damage %.1f, killed %d, path %s"), Solution.Resources, Solution.DamageDealt, Solution.KilledNum,
+			*FString::JoinBy(Solution.LinkAddresses, TEXT(" "), [](int32 GridAddress) { return FString::FromInt(GridAddress); })));
+	}
+
+	ShowResults(Results);
+}
+
+/** Collect the link masks of both rankings, in the ranking order */
+static void AddSolutionMasks(const TArray<FSGLinkSolution>& inBestByDamage, const TArray<FSGLinkSolution>& inBestByResources, TArray<FSGBoardMask>& outMasks)
+{
+	for (const FSGLinkSolution& Solution : inBestByDamage)
+	{
+		outMasks.Add(Solution.LinkMask);
+	}
+	for (const FSGLinkSolution& Solution : inBestByResources)
+	{
+		outMasks.Add(Solution.LinkMask);
+	}
+}
+
+void USGCheatManager::BenchmarkParallelLinkSolver(int32 inGridSize, int32 inBoardNum, int32 inNodeBudget)
+{
+	inBoardNum = FMath::Max(inBoardNum, 1);
+
+	ASGGameMode* GameMode = Cast<ASGGameMode>(UGameplayStatics::GetGameMode(this));
+	if (GameMode == nullptr || GameMode->GetCurrentGrid() == nullptr)
+	{
+		return;
+	}
+
+	TArray<FString> Results;
+
+	// Random boards with the current tile rules, the same seeds every run
+	TArray<FSGBoardSimulation> Boards;
+	Boards.SetNum(inBoardNum);
+	TArray<FSGCellMove> CellMoves;
+	for (int32 BoardIndex = 0; BoardIndex < inBoardNum; BoardIndex++)
+	{
+		if (Boards[BoardIndex].Initialize(inGridSize, inGridSize, BenchmarkSeed + BoardIndex) == false)
+		{
+			Results.Add(FString::Printf(TEXT("Parallel link solver: %dx%d board is not supported, the board model holds at most %d cells"), inGridSize, inGridSize, FSGBoardModel::MaxGridCells));
+			Boards.Reset();
+			break;
+		}
+		Boards[BoardIndex].SetArchetypes(GameMode->GetCurrentGrid()->GetSimulation().GetArchetypes());
+		Boards[BoardIndex].Refill(CellMoves);
+	}
+
+	if (Boards.Num() > 0)
+	{
+		FSGLinkSolverSettings Settings;
+		Settings.MinLinkLength = GameMode->GetMinimunLengthLinkLineRequired();
+		Settings.TimeBudgetSeconds = MAX_flt;
+		Settings.MaxNodeNum = inNodeBudget;
+
+		// The serial solver is the baseline, the node budget applies to its whole search
+		FSGLinkSolver SerialSolver;
+		TArray<FSGBoardMask> BaseMasks;
+		int64 BaseNodeNum = 0;
+		bool bBaseFinished = true;
+		const double BaseStartSeconds = FPlatformTime::Seconds();
+		for (const FSGBoardSimulation& Board : Boards)
+		{
+			bBaseFinished &= SerialSolver.Solve(Board, Settings);
+			BaseNodeNum += SerialSolver.GetVisitedNodeNum();
+			AddSolutionMasks(SerialSolver.GetBestByDamage(), SerialSolver.GetBestByResources(), BaseMasks);
+		}
+		const double BaseSeconds = FPlatformTime::Seconds() - BaseStartSeconds;
+		Results.Add(FString::Printf(TEXT("Link solver: serial, %.3f ms per board, %lld nodes%s"),
+			BaseSeconds * 1000.0 / Boards.Num(), BaseNodeNum, (bBaseFinished == true) ? TEXT("") : TEXT(", out of budget")));
+
+		// The node budget applies to each frontier item, the results only match when both searches finish
+		FSGParallelLinkSolver Solver;
+		for (int32 WorkerNum = 1; WorkerNum <= 8; WorkerNum *= 2)
+		{
+			TArray<FSGBoardMask> Masks;
+			int64 NodeNum = 0;
+			bool bFinished = true;
+			const double StartSeconds = FPlatformTime::Seconds();
+			for (const FSGBoardSimulation& Board : Boards)
+			{
+				bFinished &= Solver.Solve(Board, Settings, WorkerNum);
+				NodeNum += Solver.GetVisitedNodeNum();
+				AddSolutionMasks(Solver.GetBestByDamage(), Solver.GetBestByResources(), Masks);
+			}
+			const double Seconds = FPlatformTime::Seconds() - StartSeconds;
+
+			const TCHAR* Match = (bFinished == false || bBaseFinished == false) ? TEXT("out of budget") : ((Masks == BaseMasks) ? TEXT("match") : TEXT("DIFFER"));
+			Results.Add(FString::Printf(TEXT("Parallel link solver: %d workers, %.3f ms per board, %lld nodes, %d items, speedup %.2f, results %s"),
+				WorkerNum, Seconds * 1000.0 / Boards.Num(), NodeNum, Solver.GetFrontierNum(), BaseSeconds / FMath::Max(Seconds, SMALL_NUMBER), Match));
+		}
+
+		// Cancel a solve running on the thread pool, like a touch on the board does
+		Settings.MaxNodeNum = 0;
+		TFuture<bool> SolveFuture = Async<bool>(EAsyncExecution::ThreadPool, [&Solver, &Boards, &Settings]()
+		{
+			return Solver.Solve(Boards[0], Settings);
+		});
+		FPlatformProcess::Sleep(0.005f);
+		const double CancelSeconds = FPlatformTime::Seconds();
+		Solver.Cancel();
+		const bool bFinished = SolveFuture.Get();
+		Results.Add(FString::Printf(TEXT("Parallel link solver: cancel took %.3f ms, %s"),
+			(FPlatformTime::Seconds() - CancelSeconds) * 1000.0, (bFinished == true) ? TEXT("finished before the cancel") : TEXT("cancelled")));
+	}
+
+	ShowResults(Results);
+}
+
+void USGCheatManager::BenchmarkTweenEasing(int32 inIterations)
+{
+	inIterations = FMath::Max(inIterations, 1);
+
+	FRandomStream RandomStream(BenchmarkSeed);
+	TArray<uint8> EaseTypes;
+	TArray<float> Alphas;
+	TArray<float> ScalarEased;
+	TArray<float> BatchEased;
+	TArray<int32> ScratchIndices;
+	TArray<float> ScratchValues;
+
+	for (int32 TweenNum : { 1000, 10000 })
+	{
+		MakeRandomEaseTweens(RandomStream, TweenNum, EaseTypes, Alphas);
+		ScalarEased.SetNumUninitialized(TweenNum);
+		BatchEased.SetNumUninitialized(TweenNum);
+
+		const double ScalarSeconds = TimeIterations(inIterations, [&]()
+		{
+			for (int32 i = 0; i < TweenNum; i++)
+			{
+				ScalarEased[i] = FiTweenEasing::Evaluate((EEaseType::EaseType)EaseTypes[i], Alphas[i]);
+			}
+		});
+		const double BatchSeconds = TimeIterations(inIterations, [&]()
+		{
+			FiTweenEasing::EvaluateGrouped(EaseTypes.GetData(), Alphas.GetData(), BatchEased.GetData(), TweenNum, ScratchIndices, ScratchValues);
+		});
+
+		float MaxError = 0;
+		for (int32 i = 0; i < TweenNum; i++)
+		{
+			MaxError = FMath::Max(MaxError, FMath::Abs(ScalarEased[i] - BatchEased[i]));
+		}
+
+		ShowResult(FString::Printf(TEXT("Easing %d tweens: scalar %.3f us, batched %.3f us per pass, %.2fx, max error %g"),
+			TweenNum, ScalarSeconds * 1000000.0 / inIterations, BatchSeconds * 1000000.0 / inIterations, ScalarSeconds / FMath::Max(BatchSeconds, 1e-9), MaxError));
+	}
+
+	// Every curve over the whole alpha range, including the ends
+	const int32 SampleNum = 1001;
+	const float MaxAllowedError = 1e-4f;
+	const UEnum* EaseTypeEnum = FindObject<UEnum>(ANY_PACKAGE, TEXT("EEaseType"));
+	Alphas.SetNumUninitialized(SampleNum);
+	ScalarEased.SetNumUninitialized(SampleNum);
+	BatchEased.SetNumUninitialized(SampleNum);
+	for (int32 i = 0; i < SampleNum; i++)
+	{
+		Alphas[i] = (float)i / (SampleNum - 1);
+	}
+
+	int32 FailedNum = 0;
+	for (int32 EaseType = 0; EaseType < EEaseType::EaseType::customCurve; EaseType++)
+	{
+		FiTweenEasing::EvaluateBatch((EEaseType::EaseType)EaseType, Alphas.GetData(), BatchEased.GetData(), SampleNum);
+
+		float MaxError = 0;
+		for (int32 i = 0; i < SampleNum; i++)
+		{
+			MaxError = FMath::Max(MaxError, FMath::Abs(FiTweenEasing::Evaluate((EEaseType::EaseType)EaseType, Alphas[i]) - BatchEased[i]));
+		}
+
+		const bool bFailed = MaxError > MaxAllowedError;
+		FailedNum += bFailed ? 1 : 0;
+		const FString EaseName = (EaseTypeEnum != nullptr) ? EaseTypeEnum->GetNameStringByIndex(EaseType) : FString::FromInt(EaseType);
+		ShowResult(FString::Printf(TEXT("Easing %s: max error %g %s"), *EaseName, MaxError, bFailed ? TEXT("FAIL") : TEXT("ok")), bFailed);
+	}
+
+	ShowResult(FString::Printf(TEXT("Easing accuracy: %d of %d curves failed"), FailedNum, (int32)EEaseType::EaseType::customCurve));
+}
+
+void USGCheatManager::BenchmarkEasingTables(int32 inResolution, int32 inIterations)
+{
+	inIterations = FMath::Max(inIterations, 1);
+
+	const int32 TweenNum = 10000;
+	FRandomStream RandomStream(BenchmarkSeed);
+	TArray<uint8> EaseTypes;
+	TArray<float> Alphas;
+	TArray<float> Eased;
+	MakeRandomEaseTweens(RandomStream, TweenNum, EaseTypes, Alphas);
+	Eased.SetNumUninitialized(TweenNum);
+
+	const double AnalyticSeconds = TimeIterations(inIterations, [&]()
+	{
+		for (int32 i = 0; i < TweenNum; i++)
+		{
+			Eased[i] = FiTweenEasing::EvaluateAnalytic((EEaseType::EaseType)EaseTypes[i], Alphas[i]);
+		}
+	});
+	const double BakeSeconds = TimeIterations(1, [inResolution]()
+	{
+		FiTweenEasing::BakeTables(inResolution, TArray<FiTweenEasingTableResolution>());
+	});
+	const double TableSeconds = TimeIterations(inIterations, [&]()
+	{
+		for (int32 i = 0; i < TweenNum; i++)
+		{
+			Eased[i] = FiTweenEasing::Evaluate((EEaseType::EaseType)EaseTypes[i], Alphas[i]);
+		}
+	});
+
+	TArray<FiTweenEasingTableError> Errors;
+	FiTweenEasing::GetTableErrors(Errors);
+
+	float WorstError = 0;
+	FString WorstName;
+	for (const FiTweenEasingTableError& Error : Errors)
+	{
+		ShowResult(FString::Printf(TEXT("Easing table %s: %d samples, max error %g at %.4f, mean error %g"), *Error.name, Error.resolution, Error.maxError, Error.maxErrorAlpha, Error.meanError), false);
+		if (Error.maxError > WorstError)
+		{
+			WorstError = Error.maxError;
+			WorstName = Error.name;
+		}
+	}
+
+	ShowResult(FString::Printf(TEXT("Easing tables of %d samples: baked in %.3f ms, %d tweens equations %.3f us, tables %.3f us per pass, %.2fx, worst error %g (%s)"),
+		inResolution, BakeSeconds * 1000.0, TweenNum, AnalyticSeconds * 1000000.0 / inIterations, TableSeconds * 1000000.0 / inIterations,
+		AnalyticSeconds / FMath::Max(TableSeconds, 1e-9), WorstError, *WorstName));
+
+	// Put back the tables the tweens were using, or the equations if no aux holds tables
+	AiTAux* Aux = (FiTweenEasing::AreTablesRetained() == true) ? UiTween::GetAux() : nullptr;
+	if (Aux != nullptr && Aux->IsRetainingEasingTables() == true)
+	{
+		Aux->BakeEasingTables();
+	}
+	else if (FiTweenEasing::AreTablesRetained() == false)
+	{
+		FiTweenEasing::ClearTables();
+	}
+}
@@ -3,7 +3,6 @@
 #pragma once
 
 #include "GameFramework/CheatManager.h"
-#include "MessageEndpoint.h"
 #include "SGameMessages.h"
 #include "SGCheatManager.generated.h"
 
@@ -16,8 +15,6 @@ class SGAME_API USGCheatManager : public UCheatManager
 	GENERATED_BODY()
 
 public:
-	USGCheatManager();
-
 	// Player finish builld the link line
 	UFUNCTION(exec)
 	void BeginAttack();
@@ -49,8 +46,37 @@ public:
 	UFUNCTION(exec)
 	void ResetGrid();
 
+	// Move the tiles on the grid into a new layout with a legal link
+	UFUNCTION(exec)
+	void ShuffleGrid();
+
+	// Benchmark the grid column compaction on square boards up to the max grid size
+	UFUNCTION(exec)
+	void BenchmarkCondense(int32 inMaxGridSize = 64, int32 inIterations = 1000);
+
+	// Show the gameplay message allocations, it should not grow in the steady state
+	UFUNCTION(exec)
+	void ShowMessageStats();
+
+	// Solve the best link paths on the current board, and show the solve time and the best paths
+	UFUNCTION(exec)
+	void BenchmarkLinkSolver(int32 inIterations = 100, int32 inTopK = 3, float inTimeBudgetMs = 2.0f);
+
+	// Solve random boards with the tile rules of the current grid on 1 to 8 workers, show the speedup and check the results match
+	UFUNCTION(exec)
+	void BenchmarkParallelLinkSolver(int32 inGridSize = 8, int32 inBoardNum = 8, int32 inNodeBudget = 20000);
+
+	// Ease 1k and 10k random tweens with the scalar easing and the batched easing, show the speedup and check every curve matches
+	UFUNCTION(exec)
+	void BenchmarkTweenEasing(int32 inIterations = 100);
+
+	// Bake the easing tables at the resolution, show their errors against the equations and the speedup on 10k random tweens
+	UFUNCTION(exec)
+	void BenchmarkEasingTables(int32 inResolution = 256, int32 inIterations = 100);
+
 private:
+	// Log a benchmark result line, and show it on the client unless asked not to
+	void ShowResult(const FString& inResult, bool bShowOnClient = true);
 
-	// Holds the messaging endpoint.
-	TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> MessageEndpoint;
+	void ShowResults(const TArray<FString>& inResults);
 };
@@ -3,6 +3,7 @@
 #include "SGame.h"
 #include "SGGameMode.h"
 #include "SGEnemyTileBase.h"
+#include "SGMessageQueue.h"
 
 ASGEnemyTileBase::ASGEnemyTileBase()
 {
@@ -55,36 +56,48 @@ void ASGEnemyTileBase::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Create its own message endpoint, noted that this class may
-	// have two message endpoint, one for its parent messages and handlers, and 
-	// one for itself
-	FString EndPointName = FString::Printf(TEXT("Gameplay_Tile_%d_Enemylogic"), GridAddress);
-	MessageEndpoint = FMessageEndpoint::Builder(*EndPointName)
-		.Handling<FMessage_Gameplay_EnemyBeginAttack>(this, &ASGEnemyTileBase::HandleBeginAttack)
-		.Handling<FMessage_Gameplay_EnemyGetHit>(this, &ASGEnemyTileBase::HandlePlayHit);
+	// Subscribe the enemy logic events
+	FSGMessageQueue::Get().Subscribe(this, &ASGEnemyTileBase::HandleBeginAttack);
+	FSGMessageQueue::Get().Subscribe(this, &ASGEnemyTileBase::HandlePlayHit);
 
-	if (MessageEndpoint.IsValid() == true)
-	{
-		// Subscribe the tile need events
-		MessageEndpoint->Subscribe<FMessage_Gameplay_EnemyBeginAttack>();
-		MessageEndpoint->Subscribe<FMessage_Gameplay_EnemyGetHit>();
-	}
+	// The stats text is set when the tile is acquired, the type is not known yet
+}
+
+void ASGEnemyTileBase::OnTileAcquired()
+{
+	Super::OnTileAcquired();
 
-	// Set the stats text
+	// Make sure the rotation and scale back to origin
+	checkSlow(GetRenderComponent());
+	GetRenderComponent()->SetRelativeRotation(FRotator(0, 0, 0));
+	GetRenderComponent()->SetWorldScale3D(FVector(1.0f, 1.0f, 1.0f));
+
+	// Set the stats text with the new data
+	UpdateStatsText();
+}
+
+void ASGEnemyTileBase::UpdateStatsText()
+{
 	checkSlow(Text_HP);
-	Text_HP->SetText(FText::AsNumber(Data.LifeArmorInfo.CurrentLife));
+	Text_HP->SetText(FText::AsNumber(CurrentLifeArmorInfo.CurrentLife));
 	checkSlow(Text_Armor);
-	Text_Armor->SetText(FText::AsNumber(Data.LifeArmorInfo.CurrentArmor));
+	Text_Armor->SetText(FText::AsNumber(CurrentLifeArmorInfo.CurrentArmor));
 	checkSlow(Text_Attack);
-	Text_Attack->SetText(FText::AsNumber(Data.CauseDamageInfo.InitialDamage));
+	Text_Attack->SetText(FText::AsNumber(GetTileCausedDamage()));
 }
 
-void ASGEnemyTileBase::HandleBeginAttack(const FMessage_Gameplay_EnemyBeginAttack& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGEnemyTileBase::HandleBeginAttack(const FMessage_Gameplay_EnemyBeginAttack& Message)
 {
+	if (IsInPool() == true)
+	{
+		// Pooled tile is not on the grid
+		return;
+	}
+
 	EnemyAttack();
 }
 
-void ASGEnemyTileBase::HandlePlayHit(const FMessage_Gameplay_EnemyGetHit& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGEnemyTileBase::HandlePlayHit(const FMessage_Gameplay_EnemyGetHit& Message)
 {
 	FILTER_MESSAGE;
 	BeginPlayHit();
@@ -98,15 +111,10 @@ void ASGEnemyTileBase::BeginPlayHit()
 	if (CachedDamageMessage.TileID == TileID)
 	{
 		// Do the take damage now
-		if (OnTakeTileDamage(CachedDamageMessage.DamageInfos, Data.LifeArmorInfo) == false)
+		if (OnTakeTileDamage(CachedDamageMessage.DamageInfos, CurrentLifeArmorInfo) == false)
 		{
 			// Update the new stats
-			checkSlow(Text_HP);
-			Text_HP->SetText(FText::AsNumber(Data.LifeArmorInfo.CurrentLife));
-			checkSlow(Text_Armor);
-			Text_Armor->SetText(FText::AsNumber(Data.LifeArmorInfo.CurrentArmor));
-			checkSlow(Text_Attack);
-			Text_Attack->SetText(FText::AsNumber(Data.CauseDamageInfo.InitialDamage));
+			UpdateStatsText();
 		}
 		else
 		{
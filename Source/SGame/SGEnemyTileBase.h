@@ -30,6 +30,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = Hit)
 	void BeginPlayHit();
 
+	/** Reset the sprite, transform and stats text for the reused tile */
+	virtual void OnTileAcquired() override;
+
 protected:
 	// The sprite asset for attcking state
 	UPROPERTY(Category = Sprite, EditAnywhere, BlueprintReadOnly, meta = (DisplayThumbnail = "true"))
@@ -68,15 +71,12 @@ protected:
 	void StartPlayHitAnimation();
 
 private:
-	// Holds the messaging endpoint.
-	// Noted that this class may have two message endpoint, 
-	// one for its parent messages and handlers, and 
-	// one for itself
-	TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> MessageEndpoint;
+	/** Show the current life, armor and attack */
+	void UpdateStatsText();
 
 	/** Handle begin attack message */
-	void HandleBeginAttack(const FMessage_Gameplay_EnemyBeginAttack& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandleBeginAttack(const FMessage_Gameplay_EnemyBeginAttack& Message);
 
 	/** Handle play hit animation and effects */
-	void HandlePlayHit(const FMessage_Gameplay_EnemyGetHit& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandlePlayHit(const FMessage_Gameplay_EnemyGetHit& Message);
 };
@@ -4,17 +4,25 @@
 #include "SGGameMode.h"
 #include "SGPlayerController.h"
 #include "SGEnemyTileBase.h"
+#include "SGMessageQueue.h"
 
 ASGGameMode::ASGGameMode(const FObjectInitializer& ObjectInitializer)
 {
 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
 	PrimaryActorTick.bCanEverTick = true;
+
+	// Tick after the other actors, so the messages published in this frame are delivered in this frame
+	PrimaryActorTick.TickGroup = TG_PostUpdateWork;
 	DefaultPawnClass = nullptr;
 	PlayerControllerClass = ASGPlayerController::StaticClass();
 	CurrentRound = 0;
 	MinimunLengthLinkLineRequired = 3;
 	CurrentPlayerPawn = 0;
 	bShouldReplayLinkAnimation = true;
+	CurrentGameGameStatus = ESGGameStatus::EGS_Init;
+	PendingGameStatus = ESGGameStatus::EGS_Init;
+	bHasPendingGameStatus = false;
+	bRunningGameFlow = false;
 
 	PlayerSkillManager = CreateDefaultSubobject<USGPlayerSkillManager>(TEXT("PlayerSkillManager"));
 }
@@ -23,25 +31,14 @@ void ASGGameMode::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Create messaeng end point for game mode
-	MessageEndpoint = FMessageEndpoint::Builder("Gameplay_GameMode")
-		.Handling<FMessage_Gameplay_GameStart>(this, &ASGGameMode::HandleGameStart)
-		.Handling<FMessage_Gameplay_GameStatusUpdate>(this, &ASGGameMode::HandleGameStatusUpdate)
-		.Handling<FMessage_Gameplay_AllTileFinishMove>(this, &ASGGameMode::HandleAllTileFinishMoving)
-		.Handling<FMessage_Gameplay_EnemyBeginAttack>(this, &ASGGameMode::HandleBeginAttack)
-		.Handling<FMessage_Gameplay_CollectLinkLine>(this, &ASGGameMode::HandleCollectLinkLine)
-		.Handling<FMessage_Gameplay_NewTilePicked>(this, &ASGGameMode::HandleNewTileIsPicked)
-		.WithInbox();
-	if (MessageEndpoint.IsValid() == true)
-	{
-		// Subscribe the game mode needed messages
-		MessageEndpoint->Subscribe<FMessage_Gameplay_GameStart>();
-		MessageEndpoint->Subscribe<FMessage_Gameplay_GameStatusUpdate>();
-		MessageEndpoint->Subscribe<FMessage_Gameplay_AllTileFinishMove>();
-		MessageEndpoint->Subscribe<FMessage_Gameplay_EnemyBeginAttack>();
-		MessageEndpoint->Subscribe<FMessage_Gameplay_CollectLinkLine>();
-		MessageEndpoint->Subscribe<FMessage_Gameplay_NewTilePicked>();
-	}
+	// Subscribe the game mode needed messages
+	FSGMessageQueue& MessageQueue = FSGMessageQueue::Get();
+	MessageQueue.Subscribe(this, &ASGGameMode::HandleGameStart);
+	MessageQueue.Subscribe(this, &ASGGameMode::HandleGameStatusUpdate);
+	MessageQueue.Subscribe(this, &ASGGameMode::HandleAllTileFinishMoving);
+	MessageQueue.Subscribe(this, &ASGGameMode::HandleBeginAttack);
+	MessageQueue.Subscribe(this, &ASGGameMode::HandleCollectLinkLine);
+	MessageQueue.Subscribe(this, &ASGGameMode::HandleNewTileIsPicked);
 
 	// Find the grid actor in the world
 	CurrentGrid = nullptr;
@@ -90,16 +87,12 @@ void ASGGameMode::OnBeginRound()
 	UE_LOG(LogSGameProcedure, Log, TEXT("New round begin!"));
 	CurrentRound++;
 
-	// Change the next status to new round begin
-	if (MessageEndpoint.IsValid())
-	{
-		FMessage_Gameplay_GameStatusUpdate* GameStatusUpdateMesssage = new FMessage_Gameplay_GameStatusUpdate();
-		GameStatusUpdateMesssage->NewGameStatus = ESGGameStatus::EGS_PlayerTurnBegin;
-		MessageEndpoint->Publish(GameStatusUpdateMesssage, EMessageScope::Process);
-	}
+	// The tiles refilled in this round spawn by the round probabilities
+	checkSlow(CurrentGrid != nullptr);
+	CurrentGrid->GetSimulation().SetSpawnRound(CurrentRound);
 }
 
-void ASGGameMode::HandleCollectLinkLine(const FMessage_Gameplay_CollectLinkLine& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGGameMode::HandleCollectLinkLine(const FMessage_Gameplay_CollectLinkLine& Message)
 {
 	checkSlow(CurrentLinkLine != nullptr);
 
@@ -110,29 +103,27 @@ void ASGGameMode::HandleCollectLinkLine(const FMessage_Gameplay_CollectLinkLine&
 	}
 
 	// Post a tile disappear message
-	FMessage_Gameplay_LinkedTilesCollect* DisappearMessage = new FMessage_Gameplay_LinkedTilesCollect();
+	FMessage_Gameplay_LinkedTilesCollect& DisappearMessage = FSGMessageQueue::Get().Publish<FMessage_Gameplay_LinkedTilesCollect>();
+	DisappearMessage.TilesAddressToCollect.Reset();
 	for (int i = 0; i < CurrentLinkLine->LinkLineTiles.Num(); i++)
 	{
 		checkSlow(CurrentLinkLine->LinkLineTiles[i]);
-		DisappearMessage->TilesAddressToCollect.Push(CurrentLinkLine->LinkLineTiles[i]->GetGridAddress());
-	}
-
-	if (MessageEndpoint.IsValid() == true)
-	{
-		MessageEndpoint->Publish(DisappearMessage, EMessageScope::Process);
+		DisappearMessage.TilesAddressToCollect.Push(CurrentLinkLine->LinkLineTiles[i]->GetGridAddress());
 	}
 }
 
 bool ASGGameMode::CollectTileArray(TArray<ASGTileBase*> inTileArrayToCollect)
 {
+	checkSlow(CurrentGrid);
+	const FSGBoardSimulation& Simulation = CurrentGrid->GetSimulation();
+
 	// Collect resouce array, using the resource type as index
-	TArray<float> SumupResource;
-	SumupResource.AddZeroed(static_cast<int32>(ESGResourceType::ETT_MAX));
+	float SumupResource[SGResourceTypeNum] = { 0 };
 
 	// Array of tile address should be collected, used for condense the grid
 	TArray<int32> CollectedTileAddressArray;
 
-	// Iterate the link tiles, retrieve their resources
+	// Iterate the link tiles, retrieve their resources from the simulation
 	for (int i = 0; i < inTileArrayToCollect.Num(); i++)
 	{
 		const ASGTileBase* Tile = inTileArrayToCollect[i];
@@ -142,32 +133,18 @@ bool ASGGameMode::CollectTileArray(TArray<ASGTileBase*> inTileArrayToCollect)
 		CollectedTileAddressArray.Add(Tile->GetGridAddress());
 
 		// Collecte the resouces
-		TArray<FTileResourceUnit> TileResource = Tile->GetTileResource();
-		for (int j = 0; j < TileResource.Num(); j++)
-		{
-			// Sumup the resource
-			SumupResource[static_cast<int32>(TileResource[j].ResourceType)] += TileResource[j].ResourceAmount;
-		}
+		Simulation.AddTileResources(Tile->GetGridAddress(), SumupResource);
 	}
 
-	if (SumupResource.Num() > 0)
-	{
-		FMessage_Gameplay_ResourceCollect* ResouceCollectMessage = new FMessage_Gameplay_ResourceCollect();
-		ResouceCollectMessage->SummupResouces = SumupResource;
-
-		checkSlow(MessageEndpoint.IsValid());
-		MessageEndpoint->Publish(ResouceCollectMessage, EMessageScope::Process);
-	}
+	FMessage_Gameplay_ResourceCollect& ResouceCollectMessage = FSGMessageQueue::Get().Publish<FMessage_Gameplay_ResourceCollect>();
+	ResouceCollectMessage.SummupResouces.Reset();
+	ResouceCollectMessage.SummupResouces.Append(SumupResource, SGResourceTypeNum);
 
 	// Finally, sent the message indicate the tiles are collected
 	if (CollectedTileAddressArray.Num() > 0)
 	{
-		FMessage_Gameplay_LinkedTilesCollect* Message = new FMessage_Gameplay_LinkedTilesCollect();
-		Message->TilesAddressToCollect = CollectedTileAddressArray;
-		if (MessageEndpoint.IsValid() == true)
-		{
-			MessageEndpoint->Publish(Message, EMessageScope::Process);
-		}
+		FMessage_Gameplay_LinkedTilesCollect& Message = FSGMessageQueue::Get().Publish<FMessage_Gameplay_LinkedTilesCollect>();
+		Message.TilesAddressToCollect = CollectedTileAddressArray;
 	}
 
 	return true;
@@ -180,40 +157,16 @@ void ASGGameMode::OnPlayerTurnBegin()
 	// Reset the link line 
 	checkSlow(CurrentLinkLine);
 	CurrentLinkLine->ResetLinkState();
-
-	// Change the next status to player regenerate
-	if (MessageEndpoint.IsValid())
-	{
-		FMessage_Gameplay_GameStatusUpdate* GameStatusUpdateMesssage = new FMessage_Gameplay_GameStatusUpdate();
-		GameStatusUpdateMesssage->NewGameStatus = ESGGameStatus::EGS_PlayerRegengerate;
-		MessageEndpoint->Publish(GameStatusUpdateMesssage, EMessageScope::Process);
-	}
 }
 
 void ASGGameMode::OnPlayerRegenerate()
 {
 	UE_LOG(LogSGameProcedure, Log, TEXT("Player regenerate!"));
-
-	// Change the next status to player skill CD
-	if (MessageEndpoint.IsValid())
-	{
-		FMessage_Gameplay_GameStatusUpdate* GameStatusUpdateMesssage = new FMessage_Gameplay_GameStatusUpdate();
-		GameStatusUpdateMesssage->NewGameStatus = ESGGameStatus::EGS_PlayerSkillCD;
-		MessageEndpoint->Publish(GameStatusUpdateMesssage, EMessageScope::Process);
-	}
 }
 
 void ASGGameMode::OnPlayerSkillCD()
 {
 	UE_LOG(LogSGameProcedure, Log, TEXT("Player skill CD!"));
-
-	// Change the next status to player begin input
-	if (MessageEndpoint.IsValid())
-	{
-		FMessage_Gameplay_GameStatusUpdate* GameStatusUpdateMesssage = new FMessage_Gameplay_GameStatusUpdate();
-		GameStatusUpdateMesssage->NewGameStatus = ESGGameStatus::EGS_PlayerBeginInput;
-		MessageEndpoint->Publish(GameStatusUpdateMesssage, EMessageScope::Process);
-	}
 }
 
 void ASGGameMode::OnPlayerBeginInputStage()
@@ -221,10 +174,7 @@ void ASGGameMode::OnPlayerBeginInputStage()
 	UE_LOG(LogSGameProcedure, Log, TEXT("Player begin input!"));
 
 	// Tell the player, he begin input now
-	if (MessageEndpoint.IsValid())
-	{
-		MessageEndpoint->Publish(new FMessage_Gameplay_PlayerBeginInput(), EMessageScope::Process);
-	}
+	FSGMessageQueue::Get().Publish<FMessage_Gameplay_PlayerBeginInput>();
 
 	// Reset the link line.
 	checkSlow(CurrentLinkLine);
@@ -243,33 +193,33 @@ void ASGGameMode::OnPlayerEndBuildPathStage()
 	if (IsLinkLineValid() == false)
 	{
 		// If not, set back the stage to player input
-		FMessage_Gameplay_GameStatusUpdate* GameStatusUpdateMesssage = new FMessage_Gameplay_GameStatusUpdate();
-		GameStatusUpdateMesssage->NewGameStatus = ESGGameStatus::EGS_PlayerBeginInput;
-		MessageEndpoint->Publish(GameStatusUpdateMesssage, EMessageScope::Process);
+		ChangeGameStatus(ESGGameStatus::EGS_PlayerBeginInput);
 		return;
 	}
 
-	// First we need to calculate the link line for resource and damage to enemy
-	CalculateLinkLine();
+	// The link is committed, the board will change and the hint search should not take the cores any more.
+	// A dropped short link goes back to the input above with the search still running
+	checkSlow(CurrentGrid);
+	CurrentGrid->GetHintEngine().Cancel();
 
-	// Change the next status to player end input
-	if (MessageEndpoint.IsValid())
-	{
-		FMessage_Gameplay_GameStatusUpdate* GameStatusUpdateMesssage = new FMessage_Gameplay_GameStatusUpdate();
-		GameStatusUpdateMesssage->NewGameStatus = ESGGameStatus::EGS_PlayerEndInput;
-		MessageEndpoint->Publish(GameStatusUpdateMesssage, EMessageScope::Process);
-	}
+	// First we need to calculate the link line for resource and damage to enemy, then the flow goes to player end input
+	CalculateLinkLine();
 }
 
 void ASGGameMode::Tick(float DeltaSeconds)
 {
 	Super::Tick(DeltaSeconds);
 
-	// Need to process the inbox to make sure the callbacks function work
-	if (MessageEndpoint.IsValid())
-	{
-		MessageEndpoint->ProcessInbox();
-	}
+	// Deliver the gameplay messages published in this frame
+	FSGMessageQueue::Get().ProcessMessages();
+}
+
+void ASGGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// The messages of this level should not be delivered to the next level
+	FSGMessageQueue::Get().DiscardMessages();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 bool ASGGameMode::IsLinkLineValid()
@@ -283,7 +233,7 @@ bool ASGGameMode::IsLinkLineValid()
 	return false;
 }
 
-void ASGGameMode::HandleBeginAttack(const FMessage_Gameplay_EnemyBeginAttack& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGGameMode::HandleBeginAttack(const FMessage_Gameplay_EnemyBeginAttack& Message)
 {
 	float ShiledDamage = 0;
 	float DirectDamage = 0;
@@ -293,12 +243,9 @@ void ASGGameMode::HandleBeginAttack(const FMessage_Gameplay_EnemyBeginAttack& Me
 		UE_LOG(LogSGame, Log, TEXT("Enemy will cause %f shield damage, and %f direct damage "), ShiledDamage, DirectDamage);
 
 		// Send player pawn take damage message
-		FMessage_Gameplay_PlayerTakeDamage* PlayerTakeDamageMessage = new FMessage_Gameplay_PlayerTakeDamage{ 0 };
-		PlayerTakeDamageMessage->ShiledDamage = ShiledDamage;
-		PlayerTakeDamageMessage->DirectDamage = DirectDamage;
-
-		checkSlow(MessageEndpoint.IsValid());
-		MessageEndpoint->Publish(PlayerTakeDamageMessage, EMessageScope::Process);
+		FMessage_Gameplay_PlayerTakeDamage& PlayerTakeDamageMessage = FSGMessageQueue::Get().Publish<FMessage_Gameplay_PlayerTakeDamage>();
+		PlayerTakeDamageMessage.ShiledDamage = ShiledDamage;
+		PlayerTakeDamageMessage.DirectDamage = DirectDamage;
 
 		CurrentGrid->StartAttackFadeAnimation();
 	}
@@ -308,118 +255,58 @@ bool ASGGameMode::CalculateEnemyDamageToPlayer(float& outDamageCanBeShield, floa
 {
 	checkSlow(CurrentGrid);
 
-	// Iterate the grid to find the enemy tiles
-	TArray<FTileDamageInfo> EnemyCauseDamageInfoArray;
-	const TArray<ASGTileBase*>& GridTiles = CurrentGrid->GetGridTiles();
-	for (int i = 0; i < GridTiles.Num(); i++)
-	{
-		const ASGEnemyTileBase* EnemyTile = Cast<ASGEnemyTileBase>(GridTiles[i]);
-		if (EnemyTile != nullptr)
-		{
-			EnemyCauseDamageInfoArray.Add(EnemyTile->Data.CauseDamageInfo);
-		}
-	}
-
-	if (EnemyCauseDamageInfoArray.Num() == 0)
+	// The enemy tiles on the board are found by the simulation
+	FSGEnemyAttackResult AttackResult;
+	if (CurrentGrid->GetSimulation().ResolveEnemies(AttackResult) == false)
 	{
 		// We don't find enemy tiles, so return false, means that there is no pending attack
 		return false;
 	}
 
-	// Iterate the damage info array, calculate the final
-	for (int i = 0; i < EnemyCauseDamageInfoArray.Num(); i++)
-	{
-		outDamageCanBeShield += EnemyCauseDamageInfoArray[i].InitialDamage * (1 - EnemyCauseDamageInfoArray[i].PiercingArmorRatio);
-		outDamageDirectToHP += EnemyCauseDamageInfoArray[i].InitialDamage * (EnemyCauseDamageInfoArray[i].PiercingArmorRatio);
-	}
-
+	outDamageCanBeShield += AttackResult.DamageCanBeShield;
+	outDamageDirectToHP += AttackResult.DamageDirectToHP;
 	return true;
 }
 
-TArray<FTileDamageInfo> ASGGameMode::CaculateLinkLineDamage(TArray<ASGTileBase*>& CauseDamageTiles)
-{
-	// We can do complex damage calculation here
-	// But currently, we just simply retrieve the damage info
-	TArray<FTileDamageInfo> ResultDamageInfo;
-	for (int i = 0; i < CauseDamageTiles.Num(); i++)
-	{
-		const ASGTileBase* Tile = CauseDamageTiles[i];
-		checkSlow(Tile);
-
-		ResultDamageInfo.Add(Tile->Data.CauseDamageInfo);
-	}
-
-	return ResultDamageInfo;
-}
-
 void ASGGameMode::CalculateLinkLine()
 {
-	TArray<ASGTileBase*> TakeDamageTiles;
-	TArray<ASGTileBase*> CollectedTiles;
-
-	// First we should find the can take damage tiles in the link line
 	checkSlow(CurrentLinkLine != nullptr);
+	checkSlow(CurrentGrid);
+
+	// The link line is evaluated by the simulation
+	LinkAddresses.Reset();
 	for (int i = 0; i < CurrentLinkLine->LinkLineTiles.Num(); i++)
 	{
 		checkSlow(CurrentLinkLine->LinkLineTiles[i]);
-		ASGTileBase* Tile = CurrentLinkLine->LinkLineTiles[i];
-		if (Tile->Abilities.bCanTakeDamage == true && Tile->Abilities.bEnemyTile)
-		{
-			TakeDamageTiles.Add(Tile);
-		}
-		else
-		{
-			// The other tile will be collected after the link
-			CollectedTiles.Add(Tile);
-		}
+		LinkAddresses.Add(CurrentLinkLine->LinkLineTiles[i]->GetGridAddress());
 	}
 
-	// Cause damage to the take damage tiles
-	if (TakeDamageTiles.Num() > 0)
+	FSGBoardSimulation& Simulation = CurrentGrid->GetSimulation();
+	Simulation.EvaluateLink(LinkAddresses, LinkResult);
+	Simulation.ApplyLinkDamage(LinkResult);
+
+	// Send the harm message to the damaged tiles, they show the damage
+	for (int i = 0; i < LinkResult.DamagedAddresses.Num(); i++)
 	{
-		// If it contains the take damage tiles, we should calculate the damage then
-		TArray<ASGTileBase*> CauseDamageTiles;
-		for (int i = 0; i < CurrentLinkLine->LinkLineTiles.Num(); i++)
-		{
-			checkSlow(CurrentLinkLine->LinkLineTiles[i]);
-			ASGTileBase* Tile = CurrentLinkLine->LinkLineTiles[i];
-			if (Tile->Abilities.bCanCauseDamage == true && Tile->Abilities.bEnemyTile == false)
-			{
-				CauseDamageTiles.Add(Tile);
-			}
-		}
+		const ASGTileBase* Tile = CurrentGrid->GetTileFromGridAddress(LinkResult.DamagedAddresses[i]);
+		checkSlow(Tile);
 
-		// Calculate the linked tiles damage
-		TArray<FTileDamageInfo> DamageInfos = CaculateLinkLineDamage(CauseDamageTiles);
+		FMessage_Gameplay_DamageToTile Message;
+		Message.TileID = Tile->GetTileID();
+		Message.DamageInfos = LinkResult.DamageInfos;
+		CurrentGrid->GetTileEventRouter().Send(Message);
+	}
 
-		// Then instigate the damage to the take damage tiles
-		for (int i = 0; i < TakeDamageTiles.Num(); i++)
-		{
-			checkSlow(TakeDamageTiles[i]);
-			ASGTileBase* Tile = TakeDamageTiles[i];
-
-			// Evaluate if the tile can suirve, for add the tile to collect tile array
-			if (Tile->EvaluateDamageToTile(DamageInfos) == true)
-			{
-				CollectedTiles.Add(Tile);
-			}
-
-			// Send the harm message to the tile
-			FMessage_Gameplay_DamageToTile* Message = new FMessage_Gameplay_DamageToTile{ 0 };
-			Message->TileID = Tile->GetTileID();
-			Message->DamageInfos = DamageInfos;
-			if (MessageEndpoint.IsValid() == true)
-			{
-				MessageEndpoint->Publish(Message, EMessageScope::Process);
-			}
-		}
+	// The collected tiles, including the killed enemy tiles
+	TArray<ASGTileBase*> CollectedTiles;
+	for (int i = 0; i < LinkResult.CollectedAddresses.Num(); i++)
+	{
+		CollectedTiles.Add(CurrentGrid->GetTileFromGridAddress(LinkResult.CollectedAddresses[i]));
 	}
 
 	// Replay the link animation if needed
 	if (ShouldReplayLinkAnimation() == false)
 	{
-		checkSlow(ParentGrid);
-
 		// Finally collect the tile resources
 		CollectTileArray(CollectedTiles);
 
@@ -447,27 +334,9 @@ bool ASGGameMode::CanLinkToLastTile(const ASGTileBase* inTestTile)
 	const ASGTileBase* LastTile = CurrentLinkLine->LinkLineTiles.Last();
 	checkSlow(LastTile != nullptr);
 
-	// Currently only the neighbor tiles can be selected
+	// Neighbor, same type and enemy link rules are all answered by the board model
 	checkSlow(CurrentGrid);
-	if (CurrentGrid->AreAddressesNeighbors(inTestTile->GetGridAddress(), LastTile->GetGridAddress()) == false)
-	{
-		return false;
-	}
-
-	// Same tile type can always link together
-	if (LastTile->Data.TileType == inTestTile->Data.TileType)
-	{
-		return true;
-	}
-
-	// Enemy links 
-	if ((LastTile->Abilities.bCanLinkEnemy == true && inTestTile->Abilities.bEnemyTile == true) ||
-		(LastTile->Abilities.bEnemyTile == true && inTestTile->Abilities.bCanLinkEnemy == true))
-	{
-		return true;
-	}
-
-	return false;
+	return CurrentGrid->GetBoardModel().CanLink(LastTile->GetGridAddress(), inTestTile->GetGridAddress());
 }
 
 ASGSkillBase* ASGGameMode::CreatePlayerSkilkByName(FString inSkillName)
@@ -476,7 +345,7 @@ ASGSkillBase* ASGGameMode::CreatePlayerSkilkByName(FString inSkillName)
 	return PlayerSkillManager->CreateSkillByName(this, inSkillName);
 }
 
-void ASGGameMode::HandleGameStart(const FMessage_Gameplay_GameStart& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGGameMode::HandleGameStart(const FMessage_Gameplay_GameStart& Message)
 {
 	UE_LOG(LogSGameProcedure, Log, TEXT("Game start!"));
 
@@ -488,56 +357,95 @@ void ASGGameMode::HandleGameStart(const FMessage_Gameplay_GameStart& Message, co
 	
 }
 
-void ASGGameMode::HandleGameStatusUpdate(const FMessage_Gameplay_GameStatusUpdate& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGGameMode::HandleGameStatusUpdate(const FMessage_Gameplay_GameStatusUpdate& Message)
+{
+	// The player input and the cheats still request the status change by message
+	ChangeGameStatus(Message.NewGameStatus);
+}
+
+const FSGGameStage& ASGGameMode::GetGameStage(ESGGameStatus inStatus)
+{
+	// The game flow table, one row per ESGGameStatus in the enum order
+	static const FSGGameStage GameStages[] =
+	{
+		// Enter stage								Next status								Suspend
+		{ nullptr,									ESGGameStatus::EGS_Init,				true },		// EGS_Init
+		{ nullptr,									ESGGameStatus::EGS_GameStart,			true },		// EGS_GameStart
+		{ &ASGGameMode::OnBeginRound,				ESGGameStatus::EGS_PlayerTurnBegin,		false },	// EGS_RondBegin
+		{ &ASGGameMode::OnPlayerTurnBegin,			ESGGameStatus::EGS_PlayerRegengerate,	false },	// EGS_PlayerTurnBegin
+		{ &ASGGameMode::OnPlayerRegenerate,			ESGGameStatus::EGS_PlayerSkillCD,		false },	// EGS_PlayerRegengerate
+		{ &ASGGameMode::OnPlayerSkillCD,			ESGGameStatus::EGS_PlayerBeginInput,	false },	// EGS_PlayerSkillCD
+		{ &ASGGameMode::OnPlayerBeginInputStage,	ESGGameStatus::EGS_PlayerBeginInput,	true },		// EGS_PlayerBeginInput, wait for the player input
+		{ &ASGGameMode::OnPlayerEndBuildPathStage,	ESGGameStatus::EGS_PlayerEndInput,		false },	// EGS_PlayerEndBuildPath
+		{ &ASGGameMode::OnPlayerEndInputStage,		ESGGameStatus::EGS_PlayerEndInput,		true },		// EGS_PlayerEndInput, wait for the link and falling animation
+		{ &ASGGameMode::OnEnemyAttackStage,			ESGGameStatus::EGS_RoundEnd,			false },	// EGS_EnemyAttack
+		{ &ASGGameMode::OnRoundEndStage,			ESGGameStatus::EGS_RondBegin,			false },	// EGS_RoundEnd
+		{ &ASGGameMode::OnGameOver,					ESGGameStatus::EGS_GameOver,			true },		// EGS_GameOver
+	};
+	static_assert(ARRAY_COUNT(GameStages) == static_cast<int32>(ESGGameStatus::EGS_GameOver) + 1, "Game flow table should cover all the game status");
+
+	checkSlow(static_cast<int32>(inStatus) < ARRAY_COUNT(GameStages));
+	return GameStages[static_cast<int32>(inStatus)];
+}
+
+void ASGGameMode::ChangeGameStatus(ESGGameStatus inNewStatus)
 {
-	CurrentGameGameStatus = Message.NewGameStatus;
-	switch (CurrentGameGameStatus)
+	PendingGameStatus = inNewStatus;
+	bHasPendingGameStatus = true;
+
+	// Called inside a stage, the running flow will pick it up
+	if (bRunningGameFlow == true)
 	{
-	case ESGGameStatus::EGS_RondBegin:
-		OnBeginRound();
-		break;
-	case ESGGameStatus::EGS_PlayerTurnBegin:
-		OnPlayerTurnBegin();
-		break;
-	case ESGGameStatus::EGS_PlayerRegengerate:
-		OnPlayerRegenerate();
-		break;
-	case ESGGameStatus::EGS_PlayerSkillCD:
-		OnPlayerSkillCD();
-		break;
-	case ESGGameStatus::EGS_PlayerBeginInput:
-		OnPlayerBeginInputStage();
-		break;
-	case ESGGameStatus::EGS_PlayerEndBuildPath:
-		OnPlayerEndBuildPathStage();
-		break;
-	case ESGGameStatus::EGS_PlayerEndInput:
-		OnPlayerEndInputStage();
-		break;
-	case ESGGameStatus::EGS_EnemyAttack:
-		OnEnemyAttackStage();
-		break;
-	case ESGGameStatus::EGS_RoundEnd:
-		OnRoundEndStage();
-		break;
-	case ESGGameStatus::EGS_GameOver:
-		OnGameOver();
-		break;
-	default:
-		UE_LOG(LogSGameProcedure, Error, TEXT("Unhandled game status!"));
-		break;
+		return;
+	}
+
+	// Run the stages back to back, until one stage suspends
+	bRunningGameFlow = true;
+	int32 StageNum = 0;
+	while (bHasPendingGameStatus == true)
+	{
+		bHasPendingGameStatus = false;
+
+		const ESGGameStatus OldStatus = CurrentGameGameStatus;
+		CurrentGameGameStatus = PendingGameStatus;
+		OnGameStatusChanged.Broadcast(OldStatus, CurrentGameGameStatus);
+
+		const FSGGameStage& Stage = GetGameStage(CurrentGameGameStatus);
+		if (Stage.EnterStage != nullptr)
+		{
+			(this->*Stage.EnterStage)();
+		}
+
+		// The stage may choose the next status itself, e.g. back to the player input
+		if (bHasPendingGameStatus == false && Stage.bSuspend == false)
+		{
+			PendingGameStatus = Stage.NextStatus;
+			bHasPendingGameStatus = true;
+		}
+
+		// A round never passes more stages than the table rows, more means the flow is looping
+		if (++StageNum > static_cast<int32>(ESGGameStatus::EGS_GameOver) + 1 && bHasPendingGameStatus == true)
+		{
+			UE_LOG(LogSGameProcedure, Error, TEXT("Game flow does not suspend, stop at status %d"), static_cast<int32>(CurrentGameGameStatus));
+			bHasPendingGameStatus = false;
+		}
 	}
+	bRunningGameFlow = false;
 }
 
-void ASGGameMode::HandleAllTileFinishMoving(const FMessage_Gameplay_AllTileFinishMove& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGGameMode::HandleAllTileFinishMoving(const FMessage_Gameplay_AllTileFinishMove& Message)
 {
+	// The flow holds its status while a dead board is shuffled, the shuffled tiles send their own finish message
+	checkSlow(CurrentGrid);
+	if (CurrentGrid->SettleBoard() == false)
+	{
+		return;
+	}
+
 	if (CurrentGameGameStatus == ESGGameStatus::EGS_PlayerEndInput)
 	{
-		// Send to enemy attack stage
-		checkSlow(MessageEndpoint.IsValid());
-		FMessage_Gameplay_GameStatusUpdate* GameStatusUpdateMesssage = new FMessage_Gameplay_GameStatusUpdate();
-		GameStatusUpdateMesssage->NewGameStatus = ESGGameStatus::EGS_EnemyAttack;
-		MessageEndpoint->Publish(GameStatusUpdateMesssage, EMessageScope::Process);
+		// Go to enemy attack stage
+		ChangeGameStatus(ESGGameStatus::EGS_EnemyAttack);
 	}
 }
 
@@ -545,19 +453,11 @@ void ASGGameMode::OnEnemyAttackStage()
 {
 	UE_LOG(LogSGameProcedure, Log, TEXT("Enemy attack stage!"));
 
-	checkSlow(MessageEndpoint.IsValid());
-
-	// Enemy attack stage
-	FMessage_Gameplay_EnemyBeginAttack* Message = new FMessage_Gameplay_EnemyBeginAttack();
-	MessageEndpoint->Publish(Message, EMessageScope::Process);
-
-	// Send next stage to round end
-	FMessage_Gameplay_GameStatusUpdate* GameStatusUpdateMesssage = new FMessage_Gameplay_GameStatusUpdate();
-	GameStatusUpdateMesssage->NewGameStatus = ESGGameStatus::EGS_RoundEnd;
-	MessageEndpoint->Publish(GameStatusUpdateMesssage, EMessageScope::Process);
+	// Enemy attack stage, then the flow goes to round end
+	FSGMessageQueue::Get().Publish<FMessage_Gameplay_EnemyBeginAttack>();
 }
 
-void ASGGameMode::HandleNewTileIsPicked(const FMessage_Gameplay_NewTilePicked& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGGameMode::HandleNewTileIsPicked(const FMessage_Gameplay_NewTilePicked& Message)
 {
 	UE_LOG(LogSGame, Log, TEXT("Player Build Path with TileID: %d"), Message.TileID);
 
@@ -594,22 +494,10 @@ void ASGGameMode::OnRoundEndStage()
 {
 	UE_LOG(LogSGameProcedure, Log, TEXT("Round end!"));
 
-	checkSlow(MessageEndpoint.IsValid());
-
-	// Check if game over
+	// Check if game over, if not the flow starts a new round
 	if (CheckGameOver() == true)
 	{
-		// If then, send next state to game over
-		FMessage_Gameplay_GameStatusUpdate* GameStatusUpdateMesssage = new FMessage_Gameplay_GameStatusUpdate();
-		GameStatusUpdateMesssage->NewGameStatus = ESGGameStatus::EGS_GameOver;
-		MessageEndpoint->Publish(GameStatusUpdateMesssage, EMessageScope::Process);
-	}
-	else
-	{
-		// If not, start a new round
-		FMessage_Gameplay_GameStatusUpdate* GameStatusUpdateMesssage = new FMessage_Gameplay_GameStatusUpdate();
-		GameStatusUpdateMesssage->NewGameStatus = ESGGameStatus::EGS_RondBegin;
-		MessageEndpoint->Publish(GameStatusUpdateMesssage, EMessageScope::Process);
+		ChangeGameStatus(ESGGameStatus::EGS_GameOver);
 	}
 }
 
@@ -3,8 +3,6 @@
 #pragma once
 
 #include "GameFramework/GameMode.h"
-#include "MessageEndpoint.h"
-#include "MessageEndpointBuilder.h"
 #include "SGTileBase.h"
 #include "SGameMessages.h"
 #include "SGLinkLine.h"
@@ -14,6 +12,24 @@
 
 #include "SGGameMode.generated.h"
 
+class ASGGameMode;
+
+/** Called when the game status changed, with the old status and the new status */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FSGOnGameStatusChanged, ESGGameStatus, ESGGameStatus);
+
+/** One row of the game flow table */
+struct FSGGameStage
+{
+	/** Called when entering the stage, can be null */
+	void (ASGGameMode::*EnterStage)();
+
+	/** The status after this stage, used if the stage does not suspend and does not choose another status */
+	ESGGameStatus NextStatus;
+
+	/** The stage waits for the animation or the player input, the flow stops until the status is changed from outside */
+	bool bSuspend;
+};
+
 /**
  * The Gameplay mode
  */
@@ -79,9 +95,23 @@ public:
 	/** Check if game over */
 	bool CheckGameOver();
 
+	/**
+	* Change the game status, the stages which don't suspend will run one by one in this frame.
+	* If called inside a stage, the status is changed after the current stage returns
+	*
+	* @param inNewStatus the new game status
+	*/
+	void ChangeGameStatus(ESGGameStatus inNewStatus);
+
+	/** Observers of the game status change, every stage passed in the same frame is broadcast */
+	FSGOnGameStatusChanged OnGameStatusChanged;
+
 	/** Override the parent tick to do some customized tick operations*/
 	virtual void Tick(float DeltaSeconds) override;
 
+	/** Drop the gameplay messages not delivered */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	ASGGrid* GetCurrentGrid() const { return CurrentGrid; }
 	void SetCurrentGrid(ASGGrid* val) { checkSlow(val != nullptr);  CurrentGrid = val; }
 
@@ -92,6 +122,8 @@ public:
 
 	bool ShouldReplayLinkAnimation() const { return bShouldReplayLinkAnimation; }
 
+	int32 GetMinimunLengthLinkLineRequired() const { return MinimunLengthLinkLineRequired; }
+
 	/** Tell wheter can link to test tile */
 	UFUNCTION(BlueprintCallable, Category = Tile)
 	bool CanLinkToLastTile(const ASGTileBase* inTestTile);
@@ -134,35 +166,37 @@ protected:
 	/** Current grid */
 	UPROPERTY(BlueprintReadOnly, Category = Game)
 	ASGGrid*			CurrentGrid;
-
-	/**
-	* Calculate the linkline damage
-	*/
-	TArray<FTileDamageInfo> CaculateLinkLineDamage(TArray<ASGTileBase*>& CauseDamageTiles);
 private:
 	/** Handles Game start messages. */
-	void HandleGameStart(const FMessage_Gameplay_GameStart& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandleGameStart(const FMessage_Gameplay_GameStart& Message);
 
 	/** Handles the game status update messages. */
-	void HandleGameStatusUpdate(const FMessage_Gameplay_GameStatusUpdate& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandleGameStatusUpdate(const FMessage_Gameplay_GameStatusUpdate& Message);
 
 	/** Handle all tile has finish moving message, push the game procesdure to next stage */
-	void HandleAllTileFinishMoving(const FMessage_Gameplay_AllTileFinishMove& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandleAllTileFinishMoving(const FMessage_Gameplay_AllTileFinishMove& Message);
 
 	/** Handle begin attack event*/
-	void HandleBeginAttack(const FMessage_Gameplay_EnemyBeginAttack& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandleBeginAttack(const FMessage_Gameplay_EnemyBeginAttack& Message);
 
 	/** Handle collect the link line*/
-	void HandleCollectLinkLine(const FMessage_Gameplay_CollectLinkLine& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandleCollectLinkLine(const FMessage_Gameplay_CollectLinkLine& Message);
 
 	/** Handles the player picked new tile*/
-	void HandleNewTileIsPicked(const FMessage_Gameplay_NewTilePicked& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandleNewTileIsPicked(const FMessage_Gameplay_NewTilePicked& Message);
+
+	/** Get the game flow table row of the status */
+	static const FSGGameStage& GetGameStage(ESGGameStatus inStatus);
 
 	/** Current game status for this mode*/
 	ESGGameStatus CurrentGameGameStatus;
 
-	// Holds the messaging endpoint.
-	TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> MessageEndpoint;
+	/** The status to enter after the current stage, valid if bHasPendingGameStatus is true */
+	ESGGameStatus PendingGameStatus;
+	bool bHasPendingGameStatus;
+
+	/** Whether the game flow is running the stages now */
+	bool bRunningGameFlow;
 
 	/** Current round number*/
 	int32				CurrentRound;
@@ -170,6 +204,10 @@ private:
 	/** Current link line */
 	ASGLinkLine*		CurrentLinkLine;
 
+	/** The link line grid addresses and its simulation result */
+	TArray<int32>		LinkAddresses;
+	FSGLinkResult		LinkResult;
+
 	/** Current player pawn (master) */
 	ASGSpritePawn*		CurrentPlayerPawn;
 };
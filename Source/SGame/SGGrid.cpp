@@ -6,6 +6,7 @@
 #include "SGGrid.h"
 #include "SGGameMode.h"
 #include "SGEnemyTileBase.h"
+#include "SGMessageQueue.h"
 
 // Sets default values
 ASGGrid::ASGGrid(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
@@ -16,6 +17,8 @@ ASGGrid::ASGGrid(const FObjectInitializer& ObjectInitializer) : Super(ObjectInit
 	LevelTileManager = nullptr;
 	TileSize.Set(106.67f, 106.67f);
 	CurrentFallingTileNum = 0;
+	RandomSeed = 0;
+	bPublishHintWhenReady = false;
 }
 
 // Called when the game starts or when spawned
@@ -23,23 +26,32 @@ void ASGGrid::BeginPlay()
 {
 	Super::BeginPlay();
 	
-	MessageEndpoint = FMessageEndpoint::Builder("Gameplay_Grid")
-		.Handling<FMessage_Gameplay_LinkedTilesCollect>(this, &ASGGrid::HandleTileArrayCollect)
-		.Handling<FMessage_Gameplay_TileBeginMove>(this, &ASGGrid::HandleTileBeginMove)
-		.Handling<FMessage_Gameplay_TileEndMove>(this, &ASGGrid::HandleTileEndMove);
-	if (MessageEndpoint.IsValid() == true)
-	{
-		// Subscribe the grid needed messages
-		MessageEndpoint->Subscribe<FMessage_Gameplay_LinkedTilesCollect>();
-		MessageEndpoint->Subscribe<FMessage_Gameplay_NewTilePicked>();
-		MessageEndpoint->Subscribe<FMessage_Gameplay_TileBeginMove>();
-		MessageEndpoint->Subscribe<FMessage_Gameplay_TileEndMove>();
-	}
+	// Subscribe the grid needed messages
+	FSGMessageQueue::Get().Subscribe(this, &ASGGrid::HandleTileArrayCollect);
+	FSGMessageQueue::Get().Subscribe(this, &ASGGrid::HandleTileEndMove);
+
+	// The address tables come first, every other system looks up the grid through them
+	BuildGridCells();
 
 	// Initialize the grid
 	GridTiles.Empty(GridWidth * GridHeight);
 	GridTiles.AddZeroed(GridWidth * GridHeight);
 
+	// The move list never holds more than one entry per cell
+	TileMoves.Reserve(GridWidth * GridHeight);
+	CellMoves.Reserve(GridWidth * GridHeight);
+
+	// Initialize the tile message router
+	TileEventRouter.Initialize(GridWidth * GridHeight);
+
+	// Initialize the board simulation
+	const int32 SimulationSeed = (RandomSeed != 0) ? RandomSeed : FMath::Rand();
+	if (Simulation.Initialize(GridWidth, GridHeight, SimulationSeed) == false)
+	{
+		UE_LOG(LogSGame, Error, TEXT("Board model initialize failed, grid size %d x %d is not supported"), GridWidth, GridHeight);
+	}
+	UE_LOG(LogSGame, Log, TEXT("Board simulation seed %d"), SimulationSeed);
+
 	// Spawn the tile manager
 	checkSlow(GetWorld());
 
@@ -49,6 +61,14 @@ void ASGGrid::BeginPlay()
 	SpawnParams.Instigator = nullptr;
 	LevelTileManager = GetWorld()->SpawnActor<ASGLevelTileManager>(LevelTileManagerClass, SpawnParams);
 	checkSlow(LevelTileManager);
+
+	// The simulation spawns the tiles by the tile library rules
+	TArray<FSGTileArchetype> TileArchetypes;
+	LevelTileManager->BuildTileArchetypes(TileArchetypes);
+	Simulation.SetArchetypes(TileArchetypes);
+
+	// Spawn the pooled tiles now, so the game never spawns tile actors after a collect
+	LevelTileManager->PrewarmTilePool(this, GridWidth * GridHeight);
 	
 	// Find the link line actor in the world
 	CurrentLinkLine = nullptr;
@@ -70,6 +90,29 @@ void ASGGrid::BeginPlay()
 void ASGGrid::Tick( float DeltaTime )
 {
 	Super::Tick( DeltaTime );
+
+	// The hint search took longer than the falling animation
+	if (bPublishHintWhenReady == true)
+	{
+		if (HintEngine.IsHintReady() == true)
+		{
+			PublishLinkHint();
+		}
+		else if (HintEngine.IsSearching() == false)
+		{
+			// Cancelled by the committed link
+			bPublishHintWhenReady = false;
+		}
+	}
+}
+
+void ASGGrid::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// The search works on its own board copy, but it still belongs to this grid
+	HintEngine.Cancel();
+	HintEngine.Wait();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void ASGGrid::ResetGrid()
@@ -84,10 +127,12 @@ void ASGGrid::ResetGrid()
 			
 			// Destroy the tile
 			checkSlow(GridTiles[gridAddress] && GetTileManager());
+			TileEventRouter.UnbindTile(GridTiles[gridAddress], gridAddress);
 			GetTileManager()->DestroyTileWithID(GridTiles[gridAddress]->GetTileID());
 
 			// Empty the current grid tile
 			GridTiles[gridAddress] = nullptr;
+			Simulation.ClearTile(gridAddress);
 		}
 	}
 
@@ -97,117 +142,141 @@ void ASGGrid::ResetGrid()
 
 void ASGGrid::Condense()
 {
-	TMap<int32, int32> GridHoleNumMap;
+	// Build the falling tile moves and the refill slots
+	BuildTileMoves();
 
-	// Iterate the each colum of grid tiles arry, find the holes
-	for (int columnIndex = 0; columnIndex < GridWidth; columnIndex++)
+	// Refill the top empty holes
+	RefillGrid();
+}
+
+void ASGGrid::ShuffleGrid()
+{
+	if (CurrentFallingTileNum > 0)
 	{
-		for (int rowIndex = 0; rowIndex < GridHeight; rowIndex++)
-		{
-			// If it is hole already, pass it
-			int gridAddress = ColumnRowToGridAddress(columnIndex, rowIndex);
-			if (GridTiles[gridAddress] == nullptr)
-			{
-				continue;
-			}
-
-			int currentGridHoleNum = 0;
-			// Search below, to find if there is any NULL tiles
-			for (int j = rowIndex + 1; j < GridHeight; j++)
-			{
-				int testAddress = ColumnRowToGridAddress(columnIndex, j);
-				if (GridTiles[testAddress] == nullptr)
-				{
-					currentGridHoleNum++;
-				}
-			}
-
-			if (currentGridHoleNum > 0)
-			{
-				// Insert it into the map
-				GridHoleNumMap.Add(ColumnRowToGridAddress(columnIndex, rowIndex), currentGridHoleNum);
-
-				UE_LOG(LogSGame, Log, TEXT("Tile Address: %d will move down %d"), ColumnRowToGridAddress(columnIndex, rowIndex), currentGridHoleNum);
-			}
-		}
+		UE_LOG(LogSGame, Warning, TEXT("Cannot shuffle the grid while the tiles are moving"));
+		return;
 	}
 
-	// Iterate the each column of grid tiles arry, move down the tiles
-	for (int columnIndex = 0; columnIndex < GridWidth; columnIndex++)
+	ASGGameMode* GameMode = Cast<ASGGameMode>(UGameplayStatics::GetGameMode(this));
+	checkSlow(GameMode);
+	const int32 MinLinkLength = GameMode->GetMinimunLengthLinkLineRequired();
+	if (Simulation.Shuffle(MinLinkLength, CellMoves) == false)
+	{
+		// Not enough tiles of any type to link, only new tiles can help
+		UE_LOG(LogSGame, Warning, TEXT("No layout of the tiles has a legal link, reset the grid"));
+		ResetGrid();
+		return;
+	}
+
+	// The moves form cycles, take the tiles off their old addresses first
+	TileMoves.Reset();
+	for (const FSGCellMove& CellMove : CellMoves)
+	{
+		FSGTileMove& Move = TileMoves[TileMoves.AddUninitialized()];
+		Move.Tile = GridTiles[CellMove.FromAddress];
+		Move.FromAddress = CellMove.FromAddress;
+		Move.ToAddress = CellMove.ToAddress;
+		Move.FallRows = 0;
+		Move.TileTypeID = CellMove.ArchetypeID;
+
+		checkSlow(Move.Tile != nullptr);
+		TileEventRouter.UnbindTile(Move.Tile, Move.FromAddress);
+	}
+	for (const FSGTileMove& Move : TileMoves)
+	{
+		GridTiles[Move.ToAddress] = Move.Tile;
+		TileEventRouter.BindTile(Move.Tile, Move.ToAddress);
+	}
+
+	// The tiles slide to their new addresses with the falling animation
+	for (const FSGTileMove& Move : TileMoves)
 	{
-		// From down to up
-		for (int rowIndex = GridHeight - 1; rowIndex >= 0; rowIndex--)
+		SendTileBeginMove(Move.Tile->GetTileID(), Move.FromAddress, Move.ToAddress);
+	}
+	TileMoves.Reset();
+	UE_LOG(LogSGame, Log, TEXT("Grid shuffled, %d tiles moved"), CellMoves.Num());
+
+	ResetTileLinkInfo();
+	ResetTileSelectInfo();
+
+	HintEngine.BeginHint(Simulation, CellMoves, MinLinkLength);
+	bPublishHintWhenReady = false;
+}
+
+bool ASGGrid::HasLegalLink() const
+{
+	ASGGameMode* GameMode = Cast<ASGGameMode>(UGameplayStatics::GetGameMode(this));
+	checkSlow(GameMode);
+	return GetBoardModel().HasLegalLink(GameMode->GetMinimunLengthLinkLineRequired());
+}
+
+void ASGGrid::BuildTileMoves()
+{
+	// The simulation decides the falling tiles and the new tile types
+	Simulation.Refill(CellMoves);
+
+	// Move the grid tiles along, the moves in each column are bottom-up so the target is always empty
+	TileMoves.Reset();
+	for (const FSGCellMove& CellMove : CellMoves)
+	{
+		FSGTileMove& Move = TileMoves[TileMoves.AddUninitialized()];
+		Move.Tile = nullptr;
+		Move.FromAddress = CellMove.FromAddress;
+		Move.ToAddress = CellMove.ToAddress;
+		Move.FallRows = CellMove.FallRows;
+		Move.TileTypeID = CellMove.ArchetypeID;
+
+		if (CellMove.FromAddress >= 0)
 		{
-			int testAddress = ColumnRowToGridAddress(columnIndex, rowIndex);
-			if (GridHoleNumMap.Find(testAddress) == nullptr)
-			{
-				// No holes below, continue,
-				continue;
-			}
-
-			int MoveDownNum = GridHoleNumMap[testAddress];
-
-			// Send tile move message to the tile
-			ASGTileBase* testTile = GridTiles[testAddress];
-			checkSlow(testTile);
-
-			// Update the tile new address
-			FMessage_Gameplay_TileBeginMove* TileMoveMessage = new FMessage_Gameplay_TileBeginMove();
-			TileMoveMessage->TileID = testTile->GetTileID();
-			TileMoveMessage->OldTileAddress = testTile->GetGridAddress();
-			TileMoveMessage->NewTileAddress = ColumnRowToGridAddress(columnIndex, rowIndex + MoveDownNum);
-
-			// Publish the message
-			if (MessageEndpoint.IsValid() == true)
-			{
-				MessageEndpoint->Publish(TileMoveMessage, EMessageScope::Process);
-			}
-			
-			// Upate the grid address
-			GridTiles[TileMoveMessage->NewTileAddress] = testTile;
-			GridTiles[TileMoveMessage->OldTileAddress] = nullptr;
+			Move.Tile = GridTiles[CellMove.FromAddress];
+			checkSlow(Move.Tile != nullptr);
+			GridTiles[CellMove.ToAddress] = Move.Tile;
+			GridTiles[CellMove.FromAddress] = nullptr;
+			TileEventRouter.MoveTile(Move.Tile, CellMove.FromAddress, CellMove.ToAddress);
 		}
 	}
-
-	// Refill the top empty holes
-	RefillGrid();
 }
 
 void ASGGrid::RefillGrid()
 {
+	// The move list is built by condense, build it here if the grid is refilled directly (e.g. game start)
+	if (TileMoves.Num() == 0)
+	{
+		BuildTileMoves();
+	}
+
+	ASGGameMode* GameMode = Cast<ASGGameMode>(UGameplayStatics::GetGameMode(this));
+	checkSlow(GameMode);
+	int CurrentRound = GameMode->GetCurrentRound();
+
 	bool bNeedRefill = false;
-	for (int32 Col = 0; Col < GridWidth; ++Col)
+	for (FSGTileMove& Move : TileMoves)
 	{
-		int TopGridAddress = ColumnRowToGridAddress(Col, 0);
-		const ASGTileBase* CurrentColumnTopTile = GridTiles[TopGridAddress];
-		if (CurrentColumnTopTile != nullptr)
+		if (Move.Tile != nullptr)
 		{
-			// There is tile on top row, so no need to refill
+			// Falling tile, the grid and simulation are already updated
+			SendTileBeginMove(Move.Tile->GetTileID(), Move.FromAddress, Move.ToAddress);
 			continue;
 		}
 
-		// Find how many empty space we have
-		int32 RowNum = 0;
-		while (RowNum < GridHeight)
-		{
-			int32 NewGridAddress = ColumnRowToGridAddress(Col, RowNum);
-			const ASGTileBase* CurrentTile = GetTileFromGridAddress(NewGridAddress);
-			if (CurrentTile == nullptr)
-			{
-				++RowNum;
-			}
-			else
-			{
-				break;
-			}
-		}
+		// Refill slot, spawn location should be moved upper
+		FVector SpawnLocation = GetLocationFromGridAddress(Move.ToAddress);
+		SpawnLocation.Z += TileSize.Y * Move.FallRows;
 
-		if (RowNum > 0)
+		// Create the tile view of the simulation new tile at the specified location
+		ASGTileBase* NewTile = GetTileManager()->CreateTile(this, SpawnLocation, Move.ToAddress, Move.TileTypeID, CurrentRound);
+		if (NewTile == nullptr)
 		{
-			RefillColumn(Col, RowNum);
-			bNeedRefill = true;
+			UE_LOG(LogSGame, Error, TEXT("Cannot create tile at grid address %d"), Move.ToAddress);
+			continue;
 		}
+
+		// Refill the grid with tile
+		Move.Tile = NewTile;
+		RefillGridAddressWithTile(Move.ToAddress, NewTile);
+		bNeedRefill = true;
 	}
+	TileMoves.Reset();
 
 	if (bNeedRefill == false)
 	{
@@ -217,37 +286,10 @@ void ASGGrid::RefillGrid()
 	// After all reset the tile state
 	ResetTileLinkInfo();
 	ResetTileSelectInfo();
-}
-
-void ASGGrid::RefillColumn(int32 inColumnIndex, int32 inNum)
-{
-	ASGGameMode* GameMode = Cast<ASGGameMode>(UGameplayStatics::GetGameMode(this));
-	checkSlow(GameMode);
-	int CurrentRound = GameMode->GetCurrentRound();
-	
-	// We always start fill the first row [0 index row]
-	for (int startRow = 0; startRow < inNum; startRow++)
-	{
-		// Calculate the new grid address
-		int32 TileID = GetTileManager()->SelectTileFromLibrary();
-		int32 GridAddress;
-		FVector SpawnLocation;
-		GridAddress = ColumnRowToGridAddress(inColumnIndex, startRow);
-		SpawnLocation = GetLocationFromGridAddress(GridAddress);
 
-		// Spawn location should be moved upper
-		SpawnLocation.Z += TileSize.Y * inNum;
-
-		// create the tile at the specified location
-		ASGTileBase* NewTile = GetTileManager()->CreateTile(this, SpawnLocation, GridAddress, TileID, CurrentRound);
-		if (NewTile == nullptr)
-		{
-			UE_LOG(LogSGame, Error, TEXT("Cannot create tile at location %d, %d"), inColumnIndex, startRow);
-		}
-
-		// Refill the grid with tile
-		RefillGridAddressWithTile(GridAddress, NewTile);
-	}
+	// The board is settled in the simulation already, search the hint while the tiles fall
+	HintEngine.BeginHint(Simulation, CellMoves, GameMode->GetMinimunLengthLinkLineRequired());
+	bPublishHintWhenReady = false;
 }
 
 void ASGGrid::RefillGridAddressWithTile(int32 inGridAddress, ASGTileBase* inTile)
@@ -255,19 +297,27 @@ void ASGGrid::RefillGridAddressWithTile(int32 inGridAddress, ASGTileBase* inTile
 	checkSlow(GridTiles.IsValidIndex(inGridAddress));
 	checkSlow(inTile != nullptr);
 
+	GridTiles[inGridAddress] = inTile;
+	TileEventRouter.BindTile(inTile, inGridAddress);
+
 	// Send the tile move message to the tile
-	FMessage_Gameplay_TileBeginMove* TileMoveMessage = new FMessage_Gameplay_TileBeginMove();
-	TileMoveMessage->TileID = inTile->GetTileID();
-	TileMoveMessage->OldTileAddress = -1;
-	TileMoveMessage->NewTileAddress = inGridAddress;
+	SendTileBeginMove(inTile->GetTileID(), -1, inGridAddress);
 
-	// Publish the message
-	if (MessageEndpoint.IsValid() == true)
-	{
-		MessageEndpoint->Publish(TileMoveMessage, EMessageScope::Process);
-	}
+	Simulation.SetTile(inGridAddress, inTile->TileTypeID, inTile->CurrentLifeArmorInfo);
+}
 
-	GridTiles[inGridAddress] = inTile;
+void ASGGrid::SendTileBeginMove(int32 inTileID, int32 inOldAddress, int32 inNewAddress)
+{
+	checkSlow(CurrentFallingTileNum >= 0);
+
+	// Count the falling tile before the tile handles the message, the tile end move will decrease it
+	CurrentFallingTileNum++;
+
+	FMessage_Gameplay_TileBeginMove TileMoveMessage;
+	TileMoveMessage.TileID = inTileID;
+	TileMoveMessage.OldTileAddress = inOldAddress;
+	TileMoveMessage.NewTileAddress = inNewAddress;
+	TileEventRouter.Send(TileMoveMessage);
 }
 
 void ASGGrid::ResetTiles()
@@ -291,15 +341,7 @@ ASGTileBase* ASGGrid::GetTileFromGridAddress(int32 GridAddress)
 
 ASGTileBase* ASGGrid::GetTileFromTileID(int32 inTileID)
 {
-	for (int i = 0; i < GridTiles.Num(); i++)
-	{
-		if (GridTiles[i] != nullptr && GridTiles[i]->GetTileID() == inTileID)
-		{
-			return GridTiles[i];
-		}
-	}
-
-	return nullptr;
+	return TileEventRouter.FindTile(inTileID);
 }
 
 FVector ASGGrid::GetLocationFromGridAddress(int32 GridAddress, bool bNeedYOffset)
@@ -308,41 +350,120 @@ FVector ASGGrid::GetLocationFromGridAddress(int32 GridAddress, bool bNeedYOffset
 	checkSlow(TileSize.Y > 0.0f);
 	checkSlow(GridWidth > 0);
 	checkSlow(GridHeight > 0);
-	FVector Center = GetActorLocation();
-	FVector OutLocation = FVector(-(GridWidth / 2.0f) * TileSize.X + (TileSize.X * 0.5f), 0.0f, -(GridHeight / 2.0f) * TileSize.Y + (TileSize.Y * 0.5f));
-	OutLocation.X += TileSize.X * (float)(GridAddress % GridWidth);
-	OutLocation.Z += TileSize.Y * (float)(GridAddress / GridWidth);
+	FVector OutLocation = GetGridCell(GridAddress).LocalLocation;
 	if (bNeedYOffset == true)
 	{
 		OutLocation.Y = 10;
 	}
 
-	OutLocation += Center;
+	OutLocation += GetActorLocation();
 
 	return OutLocation;
 }
 
-bool ASGGrid::GetGridAddressWithOffset(int32 InitialGridAddress, int32 XOffset, int32 YOffset, int32 &ReturnGridAddress)
+void ASGGrid::BuildGridCells()
 {
 	checkSlow(TileSize.X > 0.0f);
 	checkSlow(TileSize.Y > 0.0f);
 	checkSlow(GridWidth > 0);
 	checkSlow(GridHeight > 0);
-	int32 NewAxisValue;
+
+	const int32 CellNum = GridWidth * GridHeight;
+	const FVector FirstLocation = FVector(-(GridWidth / 2.0f) * TileSize.X + (TileSize.X * 0.5f), 0.0f, -(GridHeight / 2.0f) * TileSize.Y + (TileSize.Y * 0.5f));
+	GridCells.SetNum(CellNum);
+	for (int32 Row = 0; Row < GridHeight; Row++)
+	{
+		for (int32 Column = 0; Column < GridWidth; Column++)
+		{
+			FSGGridCell& Cell = GridCells[Row * GridWidth + Column];
+			Cell.Coords = FIntPoint(Column, Row);
+			Cell.LocalLocation = FirstLocation + FVector(TileSize.X * Column, 0.0f, TileSize.Y * Row);
+		}
+	}
+}
+
+bool ASGGrid::GetGridCoordsFromRay(const FVector& inRayOrigin, const FVector& inRayDirection, FIntPoint& outGridCoords) const
+{
+	checkSlow(TileSize.X > 0.0f);
+	checkSlow(TileSize.Y > 0.0f);
+
+	// The tiles lie on the XZ plane through the grid actor, the same layout as GetLocationFromGridAddress
+	const FVector Center = GetActorLocation();
+	if (FMath::Abs(inRayDirection.Y) < KINDA_SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	const float HitDistance = (Center.Y - inRayOrigin.Y) / inRayDirection.Y;
+	if (HitDistance < 0.0f)
+	{
+		return false;
+	}
+
+	const FVector HitLocation = inRayOrigin + inRayDirection * HitDistance - Center;
+	outGridCoords.X = FMath::FloorToInt(HitLocation.X / TileSize.X + GridWidth / 2.0f);
+	outGridCoords.Y = FMath::FloorToInt(HitLocation.Z / TileSize.Y + GridHeight / 2.0f);
+	return true;
+}
+
+int32 ASGGrid::GridCoordsToGridAddress(const FIntPoint& inGridCoords) const
+{
+	if (inGridCoords.X < 0 || inGridCoords.X >= GridWidth || inGridCoords.Y < 0 || inGridCoords.Y >= GridHeight)
+	{
+		return -1;
+	}
+	return inGridCoords.Y * GridWidth + inGridCoords.X;
+}
+
+void ASGGrid::RasterizeGridSegment(const FIntPoint& inFromCoords, const FIntPoint& inToCoords, TArray<int32>& outGridAddresses) const
+{
+	// Bresenham, the step goes on both axes when the error allows, so a fast swipe never skips a cell or links a non neighbor
+	const int32 DeltaX = FMath::Abs(inToCoords.X - inFromCoords.X);
+	const int32 DeltaY = -FMath::Abs(inToCoords.Y - inFromCoords.Y);
+	const int32 StepX = (inFromCoords.X < inToCoords.X) ? 1 : -1;
+	const int32 StepY = (inFromCoords.Y < inToCoords.Y) ? 1 : -1;
+	int32 Error = DeltaX + DeltaY;
+
+	FIntPoint Coords = inFromCoords;
+	while (Coords != inToCoords)
+	{
+		const int32 DoubleError = Error * 2;
+		if (DoubleError >= DeltaY)
+		{
+			Error += DeltaY;
+			Coords.X += StepX;
+		}
+		if (DoubleError <= DeltaX)
+		{
+			Error += DeltaX;
+			Coords.Y += StepY;
+		}
+
+		const int32 GridAddress = GridCoordsToGridAddress(Coords);
+		if (GridAddress != -1)
+		{
+			outGridAddresses.Add(GridAddress);
+		}
+	}
+}
+
+bool ASGGrid::GetGridAddressWithOffset(int32 InitialGridAddress, int32 XOffset, int32 YOffset, int32 &ReturnGridAddress)
+{
+	const FIntPoint& InitialCoords = GetGridCoords(InitialGridAddress);
 
 	// Initialize to an invalid address.
 	ReturnGridAddress = -1;
 
 	// Check for going off the map in the X direction.
-	NewAxisValue = (InitialGridAddress % GridWidth) + XOffset;
-	if (NewAxisValue != FMath::Clamp(NewAxisValue, 0, (GridWidth - 1)))
+	const uint32 NewColumn = static_cast<uint32>(InitialCoords.X + XOffset);
+	if (NewColumn >= static_cast<uint32>(GridWidth))
 	{
 		return false;
 	}
 
 	// Check for going off the map in the Y direction.
-	NewAxisValue = (InitialGridAddress / GridWidth) + YOffset;
-	if (NewAxisValue != FMath::Clamp(NewAxisValue, 0, (GridHeight - 1)))
+	const uint32 NewRow = static_cast<uint32>(InitialCoords.Y + YOffset);
+	if (NewRow >= static_cast<uint32>(GridHeight))
 	{
 		return false;
 	}
@@ -395,18 +516,14 @@ bool ASGGrid::AreAddressesNeighbors(int32 GridAddressA, int32 GridAddressB)
 		return false;
 	}
 
-	auto AddressARow = GridAddressA / GridWidth;
-	auto AddressAColumn = GridAddressA % GridWidth;
-	auto AddressBRow = GridAddressB / GridWidth;
-	auto AddressBColumn = GridAddressB % GridWidth;
-
-	// The two address are neighbors only if there row and column distance less than 1
-	if (FMath::Abs(AddressARow - AddressBRow) <= 1 && FMath::Abs(AddressAColumn - AddressBColumn) <= 1)
+	// The bitboard holds at most 64 cells, a larger grid is not supported by the simulation anyway
+	if (GridWidth * GridHeight > FSGBoardModel::MaxGridCells)
 	{
-		return true;
+		return false;
 	}
 
-	return false;
+	// The two address are neighbors only if there row and column distance less than 1
+	return (GetBoardModel().GetNeighborMask(GridAddressA) & FSGBoardModel::AddressToMask(GridAddressB)) != 0;
 }
 
 void ASGGrid::RefreshGridState()
@@ -420,40 +537,36 @@ void ASGGrid::RefreshGridState()
 
 bool ASGGrid::IsThreePointsSameLine(int32 Point1, int32 Point2, int32 Point3)
 {
-	return ((Point1 - Point2) * (Point1 % GridWidth - Point3 % GridWidth) == (Point1 - Point3) * (Point1 % GridWidth - Point2 % GridWidth));
+	// The cross product of the two directions is zero
+	const FIntPoint Direction2 = GetGridCoords(Point2) - GetGridCoords(Point1);
+	const FIntPoint Direction3 = GetGridCoords(Point3) - GetGridCoords(Point1);
+	return Direction2.X * Direction3.Y == Direction2.Y * Direction3.X;
 }
 
-void ASGGrid::HandleTileArrayCollect(const FMessage_Gameplay_LinkedTilesCollect& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGGrid::HandleTileArrayCollect(const FMessage_Gameplay_LinkedTilesCollect& Message)
 {
 	for (int i = 0; i < Message.TilesAddressToCollect.Num(); i++)
 	{
 		int32 disappearTileAddress = Message.TilesAddressToCollect[i];
-		checkSlow(GridTiles[disappearTileAddress] != nullptr);
+		ASGTileBase* CollectedTile = GridTiles[disappearTileAddress];
+		checkSlow(CollectedTile != nullptr);
 
 		// Tell the tiles, it was collected
-		FMessage_Gameplay_TileCollect* CollectMessage = new FMessage_Gameplay_TileCollect{ 0 };
-		CollectMessage->TileID = GridTiles[disappearTileAddress]->GetTileID();
-		if (MessageEndpoint.IsValid() == true)
-		{
-			MessageEndpoint->Publish(CollectMessage, EMessageScope::Process);
-		}
+		FMessage_Gameplay_TileCollect CollectMessage{ 0 };
+		CollectMessage.TileID = CollectedTile->GetTileID();
+		TileEventRouter.Send(CollectMessage);
 
 		// Set null to the grid tiles array
+		TileEventRouter.UnbindTile(CollectedTile, disappearTileAddress);
 		GridTiles[disappearTileAddress] = nullptr;
+		Simulation.ClearTile(disappearTileAddress);
 	}
 
 	// Condense the grid
 	Condense();
 }
 
-void ASGGrid::HandleTileBeginMove(const FMessage_Gameplay_TileBeginMove& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
-{
-	checkSlow(CurrentFallingTileNum >= 0);
-
-	CurrentFallingTileNum++;
-}
-
-void ASGGrid::HandleTileEndMove(const FMessage_Gameplay_TileEndMove& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGGrid::HandleTileEndMove(const FMessage_Gameplay_TileEndMove& Message)
 {
 	checkSlow(CurrentFallingTileNum > 0);
 
@@ -461,12 +574,65 @@ void ASGGrid::HandleTileEndMove(const FMessage_Gameplay_TileEndMove& Message, co
 	if (CurrentFallingTileNum == 0)
 	{
 		// Send the message indicate that all the tiles have finished falling
-		if (MessageEndpoint.IsValid() == true)
+		FSGMessageQueue::Get().Publish<FMessage_Gameplay_AllTileFinishMove>();
+	}
+}
+
+bool ASGGrid::SettleBoard()
+{
+	// A dead board is shuffled, the hint comes after the shuffle settles
+	if (HasLegalLink() == false)
+	{
+		UE_LOG(LogSGame, Log, TEXT("No legal link on the grid, shuffle the tiles"));
+		ShuffleGrid();
+
+		// The tiles settle again with another message, unless nothing could move
+		if (CurrentFallingTileNum > 0)
 		{
-			FMessage_Gameplay_AllTileFinishMove* FinishMoveMessage = new FMessage_Gameplay_AllTileFinishMove();
-			MessageEndpoint->Publish(FinishMoveMessage, EMessageScope::Process);
+			return false;
 		}
 	}
+
+	if (HintEngine.IsHintOf(Simulation) == false)
+	{
+		// The board changed without a refill, e.g. the link only damaged the enemies, the search is short
+		ASGGameMode* GameMode = Cast<ASGGameMode>(UGameplayStatics::GetGameMode(this));
+		checkSlow(GameMode);
+		CellMoves.Reset();
+		HintEngine.BeginHint(Simulation, CellMoves, GameMode->GetMinimunLengthLinkLineRequired());
+	}
+
+	if (HintEngine.IsHintReady() == true)
+	{
+		PublishLinkHint();
+	}
+	else
+	{
+		bPublishHintWhenReady = HintEngine.IsSearching();
+	}
+	return true;
+}
+
+void ASGGrid::PublishLinkHint()
+{
+	bPublishHintWhenReady = false;
+
+	FMessage_Gameplay_LinkHint& HintMessage = FSGMessageQueue::Get().Publish<FMessage_Gameplay_LinkHint>();
+	HintMessage.HintAddresses = HintEngine.GetHintAddresses();
+
+	UE_LOG(LogSGame, Log, TEXT("Link hint of %d tiles, %d nodes visited, %d tiles searched again, %d solutions reused"),
+		HintMessage.HintAddresses.Num(), HintEngine.GetVisitedNodeNum(), HintEngine.GetDirtyTileNum(), HintEngine.GetReusedSolutionNum());
+}
+
+bool ASGGrid::GetLinkHint(TArray<int32>& outHintAddresses) const
+{
+	if (HintEngine.IsHintReady() == false)
+	{
+		return false;
+	}
+
+	outHintAddresses = HintEngine.GetHintAddresses();
+	return true;
 }
 
 void ASGGrid::UpdateTileSelectState()
@@ -480,83 +646,76 @@ void ASGGrid::UpdateTileSelectState()
 		return;
 	}
 
-	// Iterator all the grid tiles, update the tile selectable status
-	for (int32 i = 0; i < 36; i++)
-	{
-		const ASGTileBase* testTile = GetTileFromGridAddress(i);
-		checkSlow(testTile);
-
-		FMessage_Gameplay_TileSelectableStatusChange* SelectableMessage = new FMessage_Gameplay_TileSelectableStatusChange{ 0 };
-		SelectableMessage->TileID = testTile->GetTileID();
-		
-		ASGGameMode* GameMode = Cast<ASGGameMode>(UGameplayStatics::GetGameMode(this));
-		checkSlow(GameMode);
-		if (GameMode->CanLinkToLastTile(testTile) == true)
-		{
-			// The neighbor tile become selectable
-			SelectableMessage->NewSelectableStatus = true;
-			MessageEndpoint->Publish(SelectableMessage, EMessageScope::Process);
-		}
-		else
-		{
-			// The other tile become unselectable
-			SelectableMessage->NewSelectableStatus = false;
-			MessageEndpoint->Publish(SelectableMessage, EMessageScope::Process);
-		}
-	}
+	// Only the linkable tiles around the last tile can be selected
+	const ASGTileBase* LastTile = CurrentLinkLine->LinkLineTiles.Last();
+	checkSlow(LastTile);
+	SendBoardSelectableStatus(GetBoardModel().GetLinkableMask(LastTile->GetGridAddress()));
 }
 
 void ASGGrid::ResetTileSelectInfo()
 {
-	// Tell all the tiles that they can be selected
-	if (MessageEndpoint.IsValid() == true)
-	{
-		FMessage_Gameplay_TileSelectableStatusChange* SelectableMessage = new FMessage_Gameplay_TileSelectableStatusChange{ 0 };
+	// All the tiles can be selected
+	SendBoardSelectableStatus(GetBoardModel().GetLinkableMask(-1));
+}
 
-		// Set the target address to all
-		SelectableMessage->TileID = -1;
-		SelectableMessage->NewSelectableStatus = true;
-		MessageEndpoint->Publish(SelectableMessage, EMessageScope::Process);
+void ASGGrid::SendBoardSelectableStatus(FSGBoardMask inSelectableMask)
+{
+	FSGBoardModel& BoardModel = Simulation.GetBoardModel();
+	const FSGBoardMask ChangedMask = BoardModel.SelectableMask ^ inSelectableMask;
+	BoardModel.SelectableMask = inSelectableMask;
+	if (ChangedMask == 0)
+	{
+		return;
 	}
+
+	// Only the tiles whose bit flipped will receive the message
+	FMessage_Gameplay_BoardSelectableStatusChange SelectableMessage;
+	SelectableMessage.SelectableMask = inSelectableMask;
+	SelectableMessage.ChangedMask = ChangedMask;
+	TileEventRouter.Send(SelectableMessage);
 }
 
 void ASGGrid::UpdateTileLinkState()
 {
 	checkSlow(CurrentLinkLine != nullptr);
 
-	// Iterator all the grid tiles, only the neighbor tile between the head can be selected
-	checkSlow(CurrentGrid != nullptr);
-	for (int32 i = 0; i < 36; i++)
+	// Build the linked mask from the link line
+	FSGBoardMask LinkedMask = 0;
+	for (const ASGTileBase* LinkTile : CurrentLinkLine->LinkLineTiles)
 	{
-		const ASGTileBase* testTile = GetTileFromGridAddress(i);
-		checkSlow(testTile);
-		FMessage_Gameplay_TileLinkedStatusChange* SelectableMessage = new FMessage_Gameplay_TileLinkedStatusChange{ 0 };
-		SelectableMessage->TileID = testTile->GetTileID();
-		if (CurrentLinkLine->ContainsTileAddress(i) == true)
-		{
-			// Current line is linked
-			SelectableMessage->NewLinkStatus = true;
-			MessageEndpoint->Publish(SelectableMessage, EMessageScope::Process);
-		}
-		else
-		{
-			// Current line is not linked
-			SelectableMessage->NewLinkStatus = false;
-			MessageEndpoint->Publish(SelectableMessage, EMessageScope::Process);
-		}
+		checkSlow(LinkTile);
+		LinkedMask |= FSGBoardModel::AddressToMask(LinkTile->GetGridAddress());
 	}
+
+	SendBoardLinkedStatus(LinkedMask);
 }
 
 void ASGGrid::ResetTileLinkInfo()
 {
-	// Tell all the tiles that they can be selected
-	if (MessageEndpoint.IsValid() == true)
-	{
-		FMessage_Gameplay_TileLinkedStatusChange* LinkStatusChangeMessage = new FMessage_Gameplay_TileLinkedStatusChange{ 0 };
+	// No tile is linked
+	SendBoardLinkedStatus(0);
+}
 
-		// Set the target address to all
-		LinkStatusChangeMessage->TileID = -1;
-		LinkStatusChangeMessage->NewLinkStatus = false;
-		MessageEndpoint->Publish(LinkStatusChangeMessage, EMessageScope::Process);
+void ASGGrid::SetTileLinkedStatus(int32 inGridAddress, bool bLinked)
+{
+	const FSGBoardMask Bit = FSGBoardModel::AddressToMask(inGridAddress);
+	const FSGBoardMask LinkedMask = GetBoardModel().LinkedMask;
+	SendBoardLinkedStatus((bLinked == true) ? (LinkedMask | Bit) : (LinkedMask & ~Bit));
+}
+
+void ASGGrid::SendBoardLinkedStatus(FSGBoardMask inLinkedMask)
+{
+	FSGBoardModel& BoardModel = Simulation.GetBoardModel();
+	const FSGBoardMask ChangedMask = BoardModel.LinkedMask ^ inLinkedMask;
+	BoardModel.LinkedMask = inLinkedMask;
+	if (ChangedMask == 0)
+	{
+		return;
 	}
+
+	// Only the tiles whose bit flipped will receive the message
+	FMessage_Gameplay_BoardLinkedStatusChange LinkStatusChangeMessage;
+	LinkStatusChangeMessage.LinkedMask = inLinkedMask;
+	LinkStatusChangeMessage.ChangedMask = ChangedMask;
+	TileEventRouter.Send(LinkStatusChangeMessage);
 }
\ No newline at end of file
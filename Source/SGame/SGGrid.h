@@ -5,14 +5,44 @@
 #include "GameFramework/Actor.h"
 
 #include "SGTileBase.h"
-#include "MessageEndpoint.h"
-#include "MessageEndpointBuilder.h"
 #include "SGameMessages.h"
 #include "SGLevelTileManager.h"
 #include "SGLinkLine.h"
+#include "SGBoardSimulation.h"
+#include "SGTileEventRouter.h"
+#include "SGHintEngine.h"
 
 #include "SGGrid.generated.h"
 
+/** One tile move on the grid, produced by condense and consumed by the falling animation and refill */
+struct FSGTileMove
+{
+	/** The moving tile, null for a refill slot that a new tile will fill */
+	ASGTileBase* Tile;
+
+	/** The old grid address, -1 for a refill slot */
+	int32 FromAddress;
+
+	/** The new grid address */
+	int32 ToAddress;
+
+	/** How many rows the tile falls, for a refill slot it is the row num the new tile spawns above the address */
+	int32 FallRows;
+
+	/** The tile type id of the new tile, picked by the simulation */
+	int32 TileTypeID;
+};
+
+/** The precomputed info of one grid address, so the hot paths do no division */
+struct FSGGridCell
+{
+	/** X is the column, Y is the row from the bottom */
+	FIntPoint Coords;
+
+	/** The tile location relative to the grid actor */
+	FVector LocalLocation;
+};
+
 UCLASS()
 class SGAME_API ASGGrid : public AActor
 {
@@ -26,6 +56,9 @@ public:
 	// Called every frame
 	virtual void Tick( float DeltaSeconds ) override;
 
+	/** Stop the hint search before the grid goes away */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/** Reset grid */
 	UFUNCTION(BlueprintCallable, Category = Refill)
 	void ResetGrid();
@@ -34,6 +67,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = Refill)
 	void RefillGrid();
 
+	/** Move the tiles on the grid into a layout with a legal link, no tile is destroyed or spawned */
+	UFUNCTION(BlueprintCallable, Category = Refill)
+	void ShuffleGrid();
+
+	/** Whether any legal link line is left on the grid */
+	UFUNCTION(BlueprintCallable, Category = Grid)
+	bool HasLegalLink() const;
+
+	/**
+	* Called by the game mode when all the tiles finished moving. A dead board is shuffled, else the hint is published once ready
+	*
+	* @return false if the board was shuffled and the tiles are moving again, they finish with another message
+	*/
+	bool SettleBoard();
+
 	/** Reset the tile select info */
 	UFUNCTION(BlueprintCallable, Category = Grid)
 	void ResetTiles();
@@ -66,6 +114,38 @@ public:
 		return (GridHeight - rowIndex - 1) * GridWidth + columnIndex;
 	}
 
+	int32 GetGridWidth() const { return GridWidth; }
+	int32 GetGridHeight() const { return GridHeight; }
+
+	/** Get the precomputed info of the grid address */
+	const FSGGridCell& GetGridCell(int32 inGridAddress) const
+	{
+		checkSlow(GridCells.IsValidIndex(inGridAddress));
+		return GridCells[inGridAddress];
+	}
+
+	/** Get the column and the row from the bottom of the grid address */
+	const FIntPoint& GetGridCoords(int32 inGridAddress) const { return GetGridCell(inGridAddress).Coords; }
+
+	/**
+	* Intersect the pointer ray with the grid plane, and get the grid coordinates under it, no collision query is made
+	*
+	* @param outGridCoords	X is the column, Y is the row from the bottom, same as the grid address. Can be out of the grid
+	*
+	* @return false if the ray does not hit the grid plane
+	*/
+	bool GetGridCoordsFromRay(const FVector& inRayOrigin, const FVector& inRayDirection, FIntPoint& outGridCoords) const;
+
+	/** Get the grid address of the grid coordinates, -1 if out of the grid */
+	int32 GridCoordsToGridAddress(const FIntPoint& inGridCoords) const;
+
+	/**
+	* Rasterize the segment between two grid coordinates, each cell is an 8 neighbor of the last one
+	*
+	* @param outGridAddresses	the cells after the start cell are appended in order, the cells out of the grid are skipped
+	*/
+	void RasterizeGridSegment(const FIntPoint& inFromCoords, const FIntPoint& inToCoords, TArray<int32>& outGridAddresses) const;
+
 	/** Helper to get tile manager */
 	ASGLevelTileManager* GetTileManager() const 
 	{  
@@ -95,11 +175,44 @@ public:
 
 	const TArray<ASGTileBase*>& GetGridTiles() { return GridTiles; }
 
+	/** Get the bitboard model of the grid */
+	const FSGBoardModel& GetBoardModel() const { return Simulation.GetBoardModel(); }
+
+	/** Get the rule simulation of the grid, the tiles on the grid are the view of it */
+	FSGBoardSimulation& GetSimulation() { return Simulation; }
+	const FSGBoardSimulation& GetSimulation() const { return Simulation; }
+
+	/** Show the tile on the grid address as linked or not, only the tile itself is updated */
+	void SetTileLinkedStatus(int32 inGridAddress, bool bLinked);
+
+	/** Get the router which delivers the tile messages to the tiles on this grid */
+	FSGTileEventRouter& GetTileEventRouter() { return TileEventRouter; }
+
+	/** Get the engine which searches the link hint in the background */
+	FSGHintEngine& GetHintEngine() { return HintEngine; }
+
+	/**
+	* Get the best link line of the current board, it is searched while the tiles fall so it never searches here
+	*
+	* @param outHintAddresses the hint link line grid addresses, in the link order
+	*
+	* @return false if the hint is not ready
+	*/
+	UFUNCTION(BlueprintCallable, Category = Hint)
+	bool GetLinkHint(TArray<int32>& outHintAddresses) const;
+
 protected:
 	/** Contains the tile only on the grid */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	TArray<ASGTileBase*> GridTiles;
 
+	/** The game rules and the board state, the GridTiles follow its tile moves */
+	FSGBoardSimulation Simulation;
+
+	/** Seed of the tile spawn random stream, 0 means a new seed every game */
+	UPROPERTY(EditAnywhere, Category = Refill)
+	int32 RandomSeed;
+
 	/** Reset the tile select info */
 	UFUNCTION(BlueprintCallable, Category = Grid)
 	void ResetTileSelectInfo();
@@ -112,14 +225,11 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = Refill)
 	void Condense();
 
-	/** Refill one column on the grid
-	*
-	* @param inColumnIndex columnIndex to fill
-	* @param inNum		   how many rows to fill
-	*
-	*/
-	UFUNCTION(BlueprintCallable, Category = Refill)
-	void RefillColumn(int32 inColumnIndex, int32 inNum);
+	/** Build the move list from the simulation refill, and move the grid tiles along */
+	void BuildTileMoves();
+
+	/** Build the per address tables from the grid size and tile size */
+	void BuildGridCells();
 
 	/** Refill a specific grid address with the tile */
 	UFUNCTION(BlueprintCallable, Category = Refill)
@@ -149,20 +259,44 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = TileManager)
 	ASGLevelTileManager* LevelTileManager;
 private:
-	// Holds the messaging endpoint.
-	TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> MessageEndpoint;
-
 	/** Handle tile grid event*/
-	void HandleTileArrayCollect(const FMessage_Gameplay_LinkedTilesCollect& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
-
-	/** Handle when some tile begin move, just increase the count*/
-	void HandleTileBeginMove(const FMessage_Gameplay_TileBeginMove& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandleTileArrayCollect(const FMessage_Gameplay_LinkedTilesCollect& Message);
 
 	/** Handle when some tile end move, just decrease the count*/
-	void HandleTileEndMove(const FMessage_Gameplay_TileEndMove& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandleTileEndMove(const FMessage_Gameplay_TileEndMove& Message);
+
+	/** Publish the ready hint to the gameplay */
+	void PublishLinkHint();
 
 	void UpdateTileSelectState();
 	void UpdateTileLinkState();
+
+	/** Update the selectable mask, and tell the tiles whose selectable bit flipped */
+	void SendBoardSelectableStatus(FSGBoardMask inSelectableMask);
+
+	/** Update the linked mask, and tell the tiles whose linked bit flipped */
+	void SendBoardLinkedStatus(FSGBoardMask inLinkedMask);
+
+	/** Tell the tile it begins moving to the new address, and count the falling tile */
+	void SendTileBeginMove(int32 inTileID, int32 inOldAddress, int32 inNewAddress);
+
+	/** Delivers the tile messages, indexed by the tile id and the grid address */
+	FSGTileEventRouter TileEventRouter;
+
+	/** Per grid address coordinates, locations and neighbors, built at BeginPlay */
+	TArray<FSGGridCell> GridCells;
+
+	/** Pending tile moves of the current condense, the only input of the falling and refill */
+	TArray<FSGTileMove> TileMoves;
+
+	/** Cell moves of the simulation refill */
+	TArray<FSGCellMove> CellMoves;
+
+	/** Searches the best link line of the refilled board while the tiles fall */
+	FSGHintEngine HintEngine;
+
+	/** The board settled before the hint search returned, publish it when ready */
+	bool bPublishHintWhenReady;
 	
 	ASGLinkLine* CurrentLinkLine;
 };
@@ -0,0 +1,287 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGame.h"
+#include "SGHintEngine.h"
+#include "SGBotPolicy.h"
+#include "Async/Async.h"
+
+FSGHintEngine::FSGHintEngine()
+	: DirtyMask(0)
+	, bCacheValid(false)
+	, bCancelled(false)
+	, bHintReady(false)
+	, VisitedNodeNum(0)
+	, ReusedSolutionNum(0)
+{
+	// The search runs while the tiles fall, it has a lot more time than an input time search
+	Settings.TimeBudgetSeconds = 0.25;
+	CachedByDamage.bComplete = false;
+	CachedByResources.bComplete = false;
+	Solver.SetCancelFlag(&bCancelled);
+}
+
+FSGHintEngine::~FSGHintEngine()
+{
+	Cancel();
+	Wait();
+}
+
+void FSGHintEngine::BeginHint(const FSGBoardSimulation& inSimulation, const TArray<FSGCellMove>& inCellMoves, int32 inMinLinkLength)
+{
+	checkSlow(IsInGameThread());
+
+	// The search owns the board copy and the cache until it returns
+	Cancel();
+	Wait();
+	bCancelled = false;
+
+	Board = inSimulation;
+	HintAddresses.Reset();
+	bHintReady = false;
+	VisitedNodeNum = 0;
+	ReusedSolutionNum = 0;
+
+	if (SearchSettings.MinLinkLength != inMinLinkLength || SearchSettings.TopK != Settings.TopK || CachedTiles.Num() != Board.GetGridCellNum())
+	{
+		bCacheValid = false;
+	}
+	SearchSettings = Settings;
+	SearchSettings.MinLinkLength = inMinLinkLength;
+
+	if (bCacheValid == true)
+	{
+		// The refilled cells
+		DirtyMask = 0;
+		for (const FSGCellMove& CellMove : inCellMoves)
+		{
+			DirtyMask |= FSGBoardModel::AddressToMask(CellMove.ToAddress);
+		}
+
+		// The cells changed without a move, e.g. a damaged enemy, or a refill whose search was cancelled
+		for (int32 GridAddress = 0; GridAddress < CachedTiles.Num(); GridAddress++)
+		{
+			const FSGSimTile& Tile = Board.GetTile(GridAddress);
+			const FSGSimTile& CachedTile = CachedTiles[GridAddress];
+			if (Tile.ArchetypeID != CachedTile.ArchetypeID || FMemory::Memcmp(&Tile.LifeArmorInfo, &CachedTile.LifeArmorInfo, sizeof(FTileLifeArmorInfo)) != 0)
+			{
+				DirtyMask |= FSGBoardModel::AddressToMask(GridAddress);
+			}
+		}
+		SearchSettings.RequiredMask = DirtyMask;
+	}
+	else
+	{
+		DirtyMask = Board.GetBoardModel().GetLinkableMask(-1);
+		SearchSettings.RequiredMask = 0;
+	}
+
+	SearchFuture = Async<void>(EAsyncExecution::ThreadPool, [this]()
+	{
+		RunSearch();
+	});
+}
+
+void FSGHintEngine::Cancel()
+{
+	bCancelled = true;
+}
+
+void FSGHintEngine::Wait()
+{
+	if (SearchFuture.IsValid() == true)
+	{
+		SearchFuture.Wait();
+	}
+}
+
+bool FSGHintEngine::IsSearching() const
+{
+	return SearchFuture.IsValid() == true && SearchFuture.IsReady() == false;
+}
+
+bool FSGHintEngine::IsHintReady() const
+{
+	return SearchFuture.IsValid() == true && SearchFuture.IsReady() == true && bHintReady == true;
+}
+
+bool FSGHintEngine::IsHintOf(const FSGBoardSimulation& inSimulation) const
+{
+	// The board copy is only written by the game thread when a hint begins
+	if (Board.GetGridCellNum() != inSimulation.GetGridCellNum())
+	{
+		return false;
+	}
+
+	for (int32 GridAddress = 0; GridAddress < Board.GetGridCellNum(); GridAddress++)
+	{
+		const FSGSimTile& Tile = inSimulation.GetTile(GridAddress);
+		const FSGSimTile& HintTile = Board.GetTile(GridAddress);
+		if (Tile.ArchetypeID != HintTile.ArchetypeID || FMemory::Memcmp(&Tile.LifeArmorInfo, &HintTile.LifeArmorInfo, sizeof(FTileLifeArmorInfo)) != 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+const TArray<int32>& FSGHintEngine::GetHintAddresses() const
+{
+	static const TArray<int32> EmptyAddresses;
+	return (IsHintReady() == true) ? HintAddresses : EmptyAddresses;
+}
+
+void FSGHintEngine::RunSearch()
+{
+	bool bFinished = true;
+	bool bBestKnown = false;
+	if (bCacheValid == true)
+	{
+		// Only the paths linking a changed tile can differ from the cache
+		static const TArray<FSGLinkSolution> NoSolutions;
+		const TArray<FSGLinkSolution>* DirtyByDamage = &NoSolutions;
+		const TArray<FSGLinkSolution>* DirtyByResources = &NoSolutions;
+		if (DirtyMask != 0 && bCancelled == false)
+		{
+			bFinished = Solver.Solve(Board, SearchSettings);
+			VisitedNodeNum = Solver.GetVisitedNodeNum();
+			DirtyByDamage = &Solver.GetBestByDamage();
+			DirtyByResources = &Solver.GetBestByResources();
+		}
+
+		if (bCancelled == true)
+		{
+			// The cache still matches its own board, the next hint compares against it
+			return;
+		}
+
+		if (bFinished == true)
+		{
+			const bool bBestByDamageKnown = MergeRanking(CachedByDamage, true, *DirtyByDamage, DirtyByDamage->Num() < SearchSettings.TopK);
+			const bool bBestByResourcesKnown = MergeRanking(CachedByResources, false, *DirtyByResources, DirtyByResources->Num() < SearchSettings.TopK);
+			bBestKnown = bBestByDamageKnown && bBestByResourcesKnown;
+		}
+	}
+
+	if (bBestKnown == false)
+	{
+		if (bCancelled == true)
+		{
+			// The merge may have dropped cached paths already
+			bCacheValid = false;
+			return;
+		}
+
+		// Search the whole board
+		DirtyMask = Board.GetBoardModel().GetLinkableMask(-1);
+		SearchSettings.RequiredMask = 0;
+		ReusedSolutionNum = 0;
+		bFinished = Solver.Solve(Board, SearchSettings);
+		VisitedNodeNum += Solver.GetVisitedNodeNum();
+		if (bCancelled == true)
+		{
+			bCacheValid = false;
+			return;
+		}
+
+		SetRanking(CachedByDamage, Solver.GetBestByDamage(), bFinished);
+		SetRanking(CachedByResources, Solver.GetBestByResources(), bFinished);
+	}
+
+	// Only an exhaustive search can be reused, a budget cut ranking may miss the best paths
+	bCacheValid = bFinished;
+	CachedTiles.SetNum(Board.GetGridCellNum());
+	for (int32 GridAddress = 0; GridAddress < CachedTiles.Num(); GridAddress++)
+	{
+		CachedTiles[GridAddress] = Board.GetTile(GridAddress);
+	}
+
+	// The best damage path and the best resources path compete by the bot score, the same choice as the search bot
+	FSGLinkResult LinkResult;
+	float BestScore = -1;
+	for (const FHintRanking* Ranking : { &CachedByDamage, &CachedByResources })
+	{
+		if (Ranking->Solutions.Num() == 0)
+		{
+			continue;
+		}
+
+		const TArray<int32>& LinkAddresses = Ranking->Solutions[0].LinkAddresses;
+		Board.EvaluateLink(LinkAddresses, LinkResult);
+		const float Score = FSGBotPolicy::ScoreLink(LinkResult, LinkAddresses.Num());
+		if (Score > BestScore)
+		{
+			BestScore = Score;
+			HintAddresses = LinkAddresses;
+		}
+	}
+	bHintReady = true;
+}
+
+bool FSGHintEngine::MergeRanking(FHintRanking& inOutRanking, bool bByDamage, const TArray<FSGLinkSolution>& inDirtySolutions, bool bDirtyComplete)
+{
+	const int32 TopK = SearchSettings.TopK;
+
+	// The cached paths not touching a changed tile link the same tiles, so they keep their values
+	TArray<FSGLinkSolution> MergedSolutions;
+	for (const FSGLinkSolution& Solution : inOutRanking.Solutions)
+	{
+		if ((Solution.LinkMask & DirtyMask) == 0)
+		{
+			MergedSolutions.Add(Solution);
+		}
+	}
+	ReusedSolutionNum += MergedSolutions.Num();
+
+	// A dirty path never has the same tiles as a kept path, no need to dedupe
+	MergedSolutions.Append(inDirtySolutions);
+	MergedSolutions.StableSort([bByDamage](const FSGLinkSolution& A, const FSGLinkSolution& B)
+	{
+		return FSGLinkSolver::IsBetterSolution(bByDamage, A.DamageDealt, A.Resources, B);
+	});
+
+	const bool bComplete = inOutRanking.bComplete == true && bDirtyComplete == true && MergedSolutions.Num() <= TopK;
+	int32 ExactNum = FMath::Min(MergedSolutions.Num(), TopK);
+	if (inOutRanking.bComplete == false && inOutRanking.Solutions.Num() > 0)
+	{
+		// An unchanged path out of the cache ranks no better than the last cached one, only the strictly better ones are sure
+		const FSGLinkSolution& LastCached = inOutRanking.Solutions.Last();
+		int32 BetterNum = 0;
+		while (BetterNum < ExactNum && FSGLinkSolver::IsBetterSolution(bByDamage, MergedSolutions[BetterNum].DamageDealt, MergedSolutions[BetterNum].Resources, LastCached) == true)
+		{
+			BetterNum++;
+		}
+		ExactNum = BetterNum;
+	}
+	else if (inOutRanking.bComplete == false)
+	{
+		// Nothing is known about the unchanged paths
+		ExactNum = 0;
+	}
+
+	if (bDirtyComplete == false && inDirtySolutions.Num() > 0)
+	{
+		// A dirty path out of the search ranks no better than the last found one
+		const FSGBoardMask LastDirtyMask = inDirtySolutions.Last().LinkMask;
+		for (int32 i = 0; i < ExactNum; i++)
+		{
+			if (MergedSolutions[i].LinkMask == LastDirtyMask)
+			{
+				ExactNum = i + 1;
+				break;
+			}
+		}
+	}
+
+	MergedSolutions.SetNum(ExactNum);
+	inOutRanking.Solutions = MoveTemp(MergedSolutions);
+	inOutRanking.bComplete = bComplete;
+	return inOutRanking.Solutions.Num() > 0 || bComplete == true;
+}
+
+void FSGHintEngine::SetRanking(FHintRanking& outRanking, const TArray<FSGLinkSolution>& inSolutions, bool bFinished)
+{
+	outRanking.Solutions = inSolutions;
+
+	// A finished search not filling the ranking found every path
+	outRanking.bComplete = bFinished == true && inSolutions.Num() < SearchSettings.TopK;
+}
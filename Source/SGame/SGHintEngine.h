@@ -0,0 +1,116 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SGame.h"
+#include "SGParallelLinkSolver.h"
+#include "Async/Future.h"
+
+/**
+ * Finds the best link line of the settled board on the thread pool, while the falling animation plays.
+ * The search runs on a copy of the board, so the game thread never waits for it. The rankings of the last
+ * finished search are cached, a cached path not touching the changed tiles keeps its value, so after a
+ * refill only the paths linking a changed tile are searched and the rest comes from the cache. When the
+ * cache cannot tell the best path any more, e.g. every cached path is broken, the whole board is searched.
+ */
+class SGAME_API FSGHintEngine
+{
+public:
+	FSGHintEngine();
+
+	/** Cancels and waits for the running search */
+	~FSGHintEngine();
+
+	/**
+	* Start searching the hint of the board, the running search is cancelled
+	*
+	* @param inSimulation		the refilled board, copied before the search starts
+	* @param inCellMoves		the cell moves of the refill, the changed tiles are searched again
+	* @param inMinLinkLength	shorter paths are not legal links
+	*/
+	void BeginHint(const FSGBoardSimulation& inSimulation, const TArray<FSGCellMove>& inCellMoves, int32 inMinLinkLength);
+
+	/** Stop the running search, e.g. the player touched the board. If the hint is not ready yet, it will not be */
+	void Cancel();
+
+	/** Block until the running search returns */
+	void Wait();
+
+	/** Whether a search is started and not finished yet */
+	bool IsSearching() const;
+
+	/** Whether the hint of the last board is ready, never blocks */
+	bool IsHintReady() const;
+
+	/** Whether the last hint is of the board, the board may change without a refill, e.g. a link only damaging the enemies */
+	bool IsHintOf(const FSGBoardSimulation& inSimulation) const;
+
+	/** The best link line of the last board, empty if not ready or there is no legal link */
+	const TArray<int32>& GetHintAddresses() const;
+
+	/** How many paths the last search visited */
+	int32 GetVisitedNodeNum() const { return VisitedNodeNum; }
+
+	/** How many solutions of the last search came from the cache */
+	int32 GetReusedSolutionNum() const { return ReusedSolutionNum; }
+
+	/** How many tiles the last search had to search again, all the tiles for a full search */
+	int32 GetDirtyTileNum() const { return FSGBoardModel::CountBits(DirtyMask); }
+
+	/** The settings of the searches, the min link length is set by each hint */
+	FSGLinkSolverSettings Settings;
+
+private:
+	/** The cached solutions of one ranking */
+	struct FHintRanking
+	{
+		/** The best solutions, any path not in the list ranks no better than the last one */
+		TArray<FSGLinkSolution> Solutions;
+
+		/** The list holds every path of the ranking */
+		bool bComplete;
+	};
+
+	/** Search the board copy, runs on the thread pool */
+	void RunSearch();
+
+	/**
+	* Merge the cached paths not touching the dirty tiles with the new dirty paths, and keep the part known to be exact
+	*
+	* @return false if the best path of the ranking is not known
+	*/
+	bool MergeRanking(FHintRanking& inOutRanking, bool bByDamage, const TArray<FSGLinkSolution>& inDirtySolutions, bool bDirtyComplete);
+
+	/** Take the rankings of a full search as the cache */
+	void SetRanking(FHintRanking& outRanking, const TArray<FSGLinkSolution>& inSolutions, bool bFinished);
+
+	/** The board of the current search */
+	FSGBoardSimulation Board;
+
+	/** The tiles changed since the cached search */
+	FSGBoardMask DirtyMask;
+
+	/** Searches the paths linking the dirty tiles */
+	FSGParallelLinkSolver Solver;
+
+	/** The search settings of the current board, the cache is dropped if they change */
+	FSGLinkSolverSettings SearchSettings;
+
+	/** Rankings of the last finished search, and the board they are on */
+	FHintRanking CachedByDamage;
+	FHintRanking CachedByResources;
+	TArray<FSGSimTile> CachedTiles;
+	bool bCacheValid;
+
+	/** Set by a cancel until the next hint begins, the solver stops by it */
+	FThreadSafeBool bCancelled;
+
+	/** The result of the current search, written by the search and read after it is done */
+	TArray<int32> HintAddresses;
+	bool bHintReady;
+	int32 VisitedNodeNum;
+	int32 ReusedSolutionNum;
+
+	/** The running search */
+	TFuture<void> SearchFuture;
+};
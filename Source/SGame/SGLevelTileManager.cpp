@@ -2,6 +2,7 @@
 
 #include "SGame.h"
 #include "SGLevelTileManager.h"
+#include "SGGrid.h"
 #include "PaperSpriteComponent.h"
 
 
@@ -11,6 +12,7 @@ ASGLevelTileManager::ASGLevelTileManager()
  	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
 	PrimaryActorTick.bCanEverTick = true;
 
+	PrewarmExtraTileNum = 4;
 }
 
 // Called when the game starts or when spawned
@@ -20,6 +22,8 @@ void ASGLevelTileManager::BeginPlay()
 
 	// Make sure the transient tiles is deleted!
 	AllTiles.Empty();
+	TileIDToSlot.Empty();
+	FreeTileIDs.Empty();
 }
 
 // Called every frame
@@ -35,99 +39,192 @@ ASGTileBase* ASGLevelTileManager::CreateTile(AActor* inOwner, FVector SpawnLocat
 	checkSlow(TileLibrary[TileTypeID]);
 	checkSlow(TileLibrary[TileTypeID].TileClass);
 
-	// Check for a valid World:
-	UWorld* const World = inOwner->GetWorld();
-	if (World)
+	// Take the tile from the pool, or spawn it if the pool is empty
+	const FSGTileType& TileType = TileLibrary[TileTypeID];
+	ASGTileBase* const NewTile = AcquireTile(inOwner, TileType.TileClass, SpawnLocation);
+	if (NewTile == nullptr)
 	{
-		// Set the spawn parameters.
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.Owner = inOwner;
-		SpawnParams.Instigator = nullptr;
+		return nullptr;
+	}
+
+	// The tile data and abilities are not copied, the tile reads the shared archetype of its type id
+	NewTile->TileTypeID = TileTypeID;
+	NewTile->SetGridAddress(SpawnGridAddress);
+	NewTile->SetTileID((FreeTileIDs.Num() > 0) ? FreeTileIDs.Pop(false) : TileIDToSlot.Add(INDEX_NONE));
+	NewTile->SetSpawnedRound(CurrentRound);
+
+	// Reset the tile state and display with the new data
+	NewTile->OnTileAcquired();
+
+	// Add the gamemode to the global tile array, and index it by the tile id
+	checkSlow(TileIDToSlot[NewTile->GetTileID()] == INDEX_NONE);
+	TileIDToSlot[NewTile->GetTileID()] = AllTiles.Add(NewTile);
+
+	return NewTile;
+}
 
-		// Tiles never rotate
-		FRotator SpawnRotation = FRotator(0.0f, 0.0f, 0.0f);
+void ASGLevelTileManager::PrewarmTilePool(AActor* inOwner, int32 inGridCellNum)
+{
+	checkSlow(inOwner);
 
-		// Spawn the tile.
-		ASGTileBase* const NewTile = World->SpawnActor<ASGTileBase>(TileLibrary[TileTypeID].TileClass, SpawnLocation, SpawnRotation, SpawnParams);
+	float NormalizingFactor = 0;
+	for (auto& TileBase : TileLibrary)
+	{
+		NormalizingFactor += TileBase.Probability;
+	}
+	if (NormalizingFactor <= 0)
+	{
+		UE_LOG(LogSGame, Warning, TEXT("Tile library is empty, nothing to prewarm"));
+		return;
+	}
 
-		// Override the base tile data and abilities
-		if (TileLibrary[TileTypeID].OverrideBaseAbilities == true)
+	// Expected tile num of each class on the grid, several library entries may share one class
+	TMap<UClass*, int32> PrewarmNumMap;
+	for (auto& TileBase : TileLibrary)
+	{
+		if (TileBase.TileClass == nullptr)
 		{
-			NewTile->Abilities = TileLibrary[TileTypeID].Abilities;
+			continue;
 		}
-		if (TileLibrary[TileTypeID].OverrideBaseData == true)
+		int32& PrewarmNum = PrewarmNumMap.FindOrAdd(TileBase.TileClass);
+		PrewarmNum += FMath::CeilToInt(inGridCellNum * TileBase.Probability / NormalizingFactor);
+	}
+
+	for (auto& PrewarmPair : PrewarmNumMap)
+	{
+		FSGTilePool& TilePool = TilePools.FindOrAdd(PrewarmPair.Key);
+		const int32 TargetNum = PrewarmPair.Value + PrewarmExtraTileNum;
+		TilePool.FreeTiles.Reserve(TargetNum);
+		while (TilePool.FreeTiles.Num() < TargetNum)
 		{
-			NewTile->Data = TileLibrary[TileTypeID].Data;
+			ASGTileBase* NewTile = SpawnTileActor(inOwner, PrewarmPair.Key, inOwner->GetActorLocation());
+			if (NewTile == nullptr)
+			{
+				break;
+			}
+			ReleaseTile(NewTile);
 		}
+	}
+}
 
-		// Of course we want to move the tile
-		NewTile->GetRenderComponent()->SetMobility(EComponentMobility::Movable);
+ASGTileBase* ASGLevelTileManager::AcquireTile(AActor* inOwner, TSubclassOf<ASGTileBase> inTileClass, const FVector& inLocation)
+{
+	checkSlow(inOwner);
+	checkSlow(inTileClass);
 
-		NewTile->TileTypeID = TileTypeID;
-		NewTile->SetGridAddress(SpawnGridAddress);
-		NewTile->SetTileID(NextTileID);
-		NewTile->SetSpawnedRound(CurrentRound);
+	// Reuse the pooled tile first
+	FSGTilePool* TilePool = TilePools.Find(inTileClass);
+	if (TilePool != nullptr && TilePool->FreeTiles.Num() > 0)
+	{
+		ASGTileBase* PooledTile = TilePool->FreeTiles.Pop(false);
+		checkSlow(PooledTile && PooledTile->IsInPool());
+		PooledTile->SetActorLocation(inLocation);
+		return PooledTile;
+	}
 
-		check(NextTileID < INTMAX_MAX - 1);
-		NextTileID++;
+	return SpawnTileActor(inOwner, inTileClass, inLocation);
+}
+
+ASGTileBase* ASGLevelTileManager::SpawnTileActor(AActor* inOwner, TSubclassOf<ASGTileBase> inTileClass, const FVector& inLocation)
+{
+	// Check for a valid World:
+	UWorld* const World = inOwner->GetWorld();
+	if (World == nullptr)
+	{
+		return nullptr;
+	}
 
-		// Add the gamemode to the global tile array
-		AllTiles.AddUnique(NewTile);
+	// Set the spawn parameters.
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = inOwner;
+	SpawnParams.Instigator = nullptr;
 
-		// Cache the world pointter for delete the tile
-		CachedWorld = World;
+	// Tiles never rotate
+	FRotator SpawnRotation = FRotator(0.0f, 0.0f, 0.0f);
 
-		return NewTile;
+	// Spawn the tile.
+	ASGTileBase* const NewTile = World->SpawnActor<ASGTileBase>(inTileClass, inLocation, SpawnRotation, SpawnParams);
+	if (NewTile == nullptr)
+	{
+		UE_LOG(LogSGame, Error, TEXT("Spawn tile actor failed"));
+		return nullptr;
 	}
 
-	return nullptr;
+	// Of course we want to move the tile
+	NewTile->GetRenderComponent()->SetMobility(EComponentMobility::Movable);
+
+	return NewTile;
+}
+
+void ASGLevelTileManager::ReleaseTile(ASGTileBase* inTile)
+{
+	checkSlow(inTile);
+	checkSlow(inTile->IsInPool() == false);
+
+	inTile->OnTileReleased();
+	TilePools.FindOrAdd(inTile->GetClass()).FreeTiles.Push(inTile);
 }
 
 int32 ASGLevelTileManager::SelectTileFromLibrary()
 {
-	float NormalizingFactor = 0;
-	for (auto& TileBase : TileLibrary)
+	// The tiles are spawned by the simulation rules, so the grid random stream stays the only random source
+	ASGGrid* Grid = Cast<ASGGrid>(GetOwner());
+	if (Grid == nullptr)
 	{
-		NormalizingFactor += TileBase.Probability;
+		UE_LOG(LogSGame, Warning, TEXT("Tile manager is not owned by a grid, cannot select tile"));
+		return 0;
 	}
-	float TestNumber = FMath::FRandRange(0.0f, NormalizingFactor);
-	float CompareTo = 0;
-	for (int32 ArrayChecked = 0; ArrayChecked != TileLibrary.Num(); ArrayChecked++)
+	return Grid->GetSimulation().SelectArchetype();
+}
+
+void ASGLevelTileManager::BuildTileArchetypes(TArray<FSGTileArchetype>& outArchetypes) const
+{
+	outArchetypes.Reset(TileLibrary.Num());
+	for (const FSGTileType& TileType : TileLibrary)
 	{
-		CompareTo += TileLibrary[ArrayChecked].Probability;
-		if (TestNumber <= CompareTo)
+		FSGTileArchetype& Archetype = outArchetypes[outArchetypes.AddDefaulted()];
+		Archetype.Probability = TileType.Probability;
+		Archetype.ProbabilityGrowthPerRound = TileType.ProbabilityGrowthPerRound;
+		if (TileType.TileClass == nullptr)
 		{
-			return ArrayChecked;
+			UE_LOG(LogSGame, Warning, TEXT("Tile library entry %d has no tile class"), outArchetypes.Num() - 1);
+			continue;
 		}
+
+		// Same override rule as the created tile
+		const ASGTileBase* DefaultTile = TileType.TileClass->GetDefaultObject<ASGTileBase>();
+		checkSlow(DefaultTile);
+		const FSGTileData& Data = (TileType.OverrideBaseData == true) ? TileType.Data : DefaultTile->Data;
+		Archetype.Abilities = (TileType.OverrideBaseAbilities == true) ? TileType.Abilities : DefaultTile->Abilities;
+		Archetype.TileType = Data.TileType;
+		Archetype.CauseDamageInfo = Data.CauseDamageInfo;
+		Archetype.LifeArmorInfo = Data.LifeArmorInfo;
+		Archetype.TileResourceArray = Data.TileResourceArray;
 	}
-	return 0;
 }
 
 bool ASGLevelTileManager::DestroyTileWithID(int32 TileIDToDelete)
 {
-	checkSlow(CachedWorld);
-
-	ASGTileBase* TileToDelete = nullptr;
-	for (int i = 0; i < AllTiles.Num(); i++)
-	{
-		checkSlow(AllTiles[i] != nullptr);
-		if (AllTiles[i]->GetTileID() == TileIDToDelete)
-		{
-			TileToDelete = AllTiles[i];
-			break;
-		}
-	}
-	if (TileToDelete == nullptr)
+	const int32 Slot = TileIDToSlot.IsValidIndex(TileIDToDelete) ? TileIDToSlot[TileIDToDelete] : INDEX_NONE;
+	if (Slot == INDEX_NONE)
 	{
 		UE_LOG(LogSGame, Warning, TEXT("Cannot find tile id %d in the global tile array"), TileIDToDelete);
 		return false;
 	}
+	ASGTileBase* TileToDelete = AllTiles[Slot];
+	checkSlow(TileToDelete != nullptr && TileToDelete->GetTileID() == TileIDToDelete);
 
-	// Destroy the tile actor
-	CachedWorld->DestroyActor(TileToDelete);
+	// Put the tile actor back to the pool, instead of destroying it
+	ReleaseTile(TileToDelete);
 
-	// Move it out of global tile array
-	AllTiles.Remove(TileToDelete);
+	// Move it out of global tile array, the last tile takes its slot
+	AllTiles.RemoveAtSwap(Slot, 1, false);
+	if (AllTiles.IsValidIndex(Slot))
+	{
+		TileIDToSlot[AllTiles[Slot]->GetTileID()] = Slot;
+	}
+	TileIDToSlot[TileIDToDelete] = INDEX_NONE;
+	FreeTileIDs.Push(TileIDToDelete);
 
 	return true;
 }
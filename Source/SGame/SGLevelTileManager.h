@@ -4,9 +4,21 @@
 
 #include "GameFramework/Actor.h"
 #include "SGTileBase.h"
+#include "SGBoardSimulation.h"
 
 #include "SGLevelTileManager.generated.h"
 
+/** Released tiles of one tile class, waiting for reuse */
+USTRUCT()
+struct FSGTilePool
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** The tiles in the pool, all hidden, without collision and not ticking */
+	UPROPERTY()
+	TArray<ASGTileBase*> FreeTiles;
+};
+
 UCLASS()
 class SGAME_API ASGLevelTileManager : public AActor
 {
@@ -23,12 +35,44 @@ public:
 	virtual void Tick( float DeltaSeconds ) override;
 
 	ASGTileBase* CreateTile(AActor* inOwner, FVector SpawnLocation, int32 SpawnGridAddress, int32 TileTypeID, int32 CurrentRound);
+
+	/** Pick a tile type id from the library, by the random stream of the owner grid simulation */
 	int32 SelectTileFromLibrary();
+
+	/** Resolve the tile library into the simulation tile archetypes, indexed by the tile type id */
+	void BuildTileArchetypes(TArray<FSGTileArchetype>& outArchetypes) const;
+
+	/** Remove the tile from the game, the tile actor is released to the pool instead of destroyed */
 	bool DestroyTileWithID(int32 TileIDToDelete);
 
+	/** Get the alive tile with the tile id, null if the tile is destroyed */
+	ASGTileBase* GetTileWithID(int32 inTileID) const
+	{
+		const int32 Slot = TileIDToSlot.IsValidIndex(inTileID) ? TileIDToSlot[inTileID] : INDEX_NONE;
+		return Slot != INDEX_NONE ? AllTiles[Slot] : nullptr;
+	}
+
+	/**
+	* Spawn the pooled tiles before the game starts, so that no tile actor is spawned during the game
+	*
+	* @param inOwner		the owner of the tiles
+	* @param inGridCellNum	how many cells on the grid, the pool size is estimated from the tile probability
+	*/
+	void PrewarmTilePool(AActor* inOwner, int32 inGridCellNum);
+
+	/** Take a tile of the class from the pool, spawn a new one if the pool is empty */
+	ASGTileBase* AcquireTile(AActor* inOwner, TSubclassOf<ASGTileBase> inTileClass, const FVector& inLocation);
+
+	/** Hide the tile and put it back into its class pool */
+	void ReleaseTile(ASGTileBase* inTile);
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = TileManager)
 	TArray<FSGTileType> TileLibrary;
 
+	/** Extra tiles to prewarm for each tile class, on top of the expected tile num on the grid */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = TileManager)
+	int32 PrewarmExtraTileNum;
+
 	void Initialize();
 
 protected:
@@ -36,7 +80,17 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	TArray<ASGTileBase*> AllTiles;
 
+	/** Slot in the AllTiles array for each tile id, INDEX_NONE if the tile is destroyed. The ids of the destroyed tiles are reused, so the index is as large as the most tiles alive at once */
+	TArray<int32> TileIDToSlot;
+
+	/** The ids of the destroyed tiles, given to the next created tiles */
+	TArray<int32> FreeTileIDs;
+
+	/** Released tile actors for reuse, keyed by the tile class */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TMap<UClass*, FSGTilePool> TilePools;
+
 private:
-	int32		NextTileID;
-	UWorld*		CachedWorld;
+	/** Spawn a new tile actor, only when the pool is empty or prewarming */
+	ASGTileBase* SpawnTileActor(AActor* inOwner, TSubclassOf<ASGTileBase> inTileClass, const FVector& inLocation);
 };
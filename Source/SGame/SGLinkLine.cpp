@@ -4,8 +4,20 @@
 #include "SGGameMode.h"
 #include "SGLinkLine.h"
 #include "SGEnemyTileBase.h"
+#include "SGMessageQueue.h"
 #include "Math/UnrealMathUtility.h"
 
+/** The link line sprites are drawn at 1.5 scale to fit the grid */
+static const float LinkLineScale = 1.5f;
+
+/** Instance layout of the grouped sprite mode, the tail and head come first, then one slot per pooled segment */
+static const int32 GroupedTailInstance = 0;
+static const int32 GroupedHeadInstance = 1;
+static const int32 GroupedFirstSlotInstance = 2;
+
+/** Each slot holds the body and the 45, 90 and 135 degree corners, the unused corners are scaled to zero */
+static const int32 GroupedSlotInstanceNum = 4;
+
 // Sets default values
 ASGLinkLine::ASGLinkLine()
 {
@@ -26,6 +38,7 @@ ASGLinkLine::ASGLinkLine()
 	TailSpriteRenderComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
 	LinkLineMode = ELinkLineMode::ELLM_Sprite;
+	LinkLineGroupedSpriteComponent = nullptr;
 }
 
 // Called when the game starts or when spawned
@@ -39,9 +52,6 @@ void ASGLinkLine::BeginPlay()
 		return;
 	}
 
-	// Build the link line message endpoint
-	MessageEndpoint = FMessageEndpoint::Builder("Gameplay_LinkLine");
-
 	// Find the grid actor in the world
 	ParentGrid = nullptr;
 	for (TActorIterator<ASGGrid> It(GetWorld()); It; ++It)
@@ -59,6 +69,33 @@ void ASGLinkLine::BeginPlay()
 	{
 		UE_LOG(LogSGame, Error, TEXT("There is no grid object in the level!"));
 	}
+	else if (LinkLineMode == ELinkLineMode::ELLM_Sprite)
+	{
+		// The longest link line links every tile, the segments after the tail and the corners are pooled
+		const int32 PoolSize = ParentGrid->GetGridWidth() * ParentGrid->GetGridHeight() - 2;
+		for (int32 i = LinkLineSpriteRendererArray.Num(); i < PoolSize; i++)
+		{
+			LinkLineSpriteRendererArray.Add(CreatePooledSprite(BodySprite));
+		}
+		for (int32 i = LinkLineCornerRendererArray.Num(); i < PoolSize; i++)
+		{
+			LinkLineCornerRendererArray.Add(CreatePooledSprite(nullptr));
+		}
+	}
+
+	if (LinkLineMode == ELinkLineMode::ELLM_GroupedSprite)
+	{
+		// All the quads are instances of one component, the head and tail components only hold the sprites
+		LinkLineGroupedSpriteComponent = NewObject<UPaperGroupedSpriteComponent>(this);
+		LinkLineGroupedSpriteComponent->Mobility = EComponentMobility::Movable;
+		LinkLineGroupedSpriteComponent->RegisterComponent();
+		LinkLineGroupedSpriteComponent->AttachToComponent(RootComponent, FAttachmentTransformRules::KeepRelativeTransform);
+		LinkLineGroupedSpriteComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		CreateGroupedSpriteInstances(ParentGrid != nullptr ? ParentGrid->GetGridWidth() * ParentGrid->GetGridHeight() - 2 : 0);
+
+		HeadSpriteRenderComponent->SetVisibility(false);
+		TailSpriteRenderComponent->SetVisibility(false);
+	}
 
 	if (LinkLineMode == ELinkLineMode::ELLM_Ribbon)
 	{
@@ -100,6 +137,9 @@ bool ASGLinkLine::UpdateLinkLineDisplay()
 	case ELinkLineMode::ELLM_Ribbon:
 		bIsStaticLine == true ? UpdateLinkLineRibbon(StaticLinePoints) : UpdateLinkLineRibbon(LinkLinePoints);
 		break;
+	case ELinkLineMode::ELLM_GroupedSprite:
+		bIsStaticLine == true ? UpdateLinkLineGroupedSprites(StaticLinePoints) : UpdateLinkLineGroupedSprites(LinkLinePoints);
+		break;
 	default:
 		UE_LOG(LogSGame, Warning, TEXT("Link line mode is invalid"));
 		return false;
@@ -110,23 +150,16 @@ bool ASGLinkLine::UpdateLinkLineDisplay()
 
 bool ASGLinkLine::UpdateLinkLineSprites(const TArray<int32>& LinePoints)
 {
-	// Clean the body sprites
-	for (int32 i = 0; i < LinkLineSpriteRendererArray.Num(); i++)
-	{
-		checkSlow(LinkLineSpriteRendererArray[i] != nullptr);
-		// Detach the component
-		LinkLineSpriteRendererArray[i]->DetachFromComponent(FDetachmentTransformRules::KeepRelativeTransform);
-		LinkLineSpriteRendererArray[i]->UnregisterComponent();
-	}
-	LinkLineSpriteRendererArray.Empty();
-
-	if (LinkLinePoints.Num() < 2)
+	if (LinePoints.Num() < 2)
 	{
 		// Only one point cannot become a link line
 
 		// Hide the head and tail component
 		HeadSpriteRenderComponent->SetVisibility(false);
 		TailSpriteRenderComponent->SetVisibility(false);
+		HideLinkLineSprites(0);
+		ShownLinePoints.Reset();
+		ShownSegmentAngles.Reset();
 
 		return true;
 	}
@@ -137,148 +170,258 @@ bool ASGLinkLine::UpdateLinkLineSprites(const TArray<int32>& LinePoints)
 		TailSpriteRenderComponent->SetVisibility(true);
 	}
 
-	// The link line should scale to 1.5 to fit the grid
-	RootComponent->SetWorldScale3D(FVector(1.5f, 1.5f, 1.5f));
+	// The sprites of the points shared with the shown line stay as they are
+	const int32 SharedPointNum = GetSharedPointNum(LinePoints);
 
-	// Iterate all points, and generate line between the two points
-	ELinkDirection LastDirection = ELinkDirection::ELD_Begin;
-	for (int32 i = 0; i < LinePoints.Num(); i++)
+	// Mark down the initial position, all the sprites are relative to it
+	const int32 InitialTileID = LinePoints[0];
+	if (SharedPointNum == 0)
 	{
-		// For the first point, we just mark down the initial position
-		FVector InitialTileCorrds;
-		if (i == 0)
-		{
-			InitialTileCorrds.X = LinePoints[0] % 6;
-			InitialTileCorrds.Y = LinePoints[0] / 6;
-
-			// Set the link line at the head position
-			FVector LinkLineWorldLocation = RootComponent->GetComponentLocation();
-			LinkLineWorldLocation.X = (InitialTileCorrds.X + 0.5f - 3) * 106.0f;
-			LinkLineWorldLocation.Z = (InitialTileCorrds.Y + 0.5f - 3) * 106.0f;
-			RootComponent->SetWorldLocation(LinkLineWorldLocation);
+		PlaceLinkLineRoot(LinePoints[0]);
+	}
 
-			// Continue from points 1
-			continue;
-		}
+	// The segments not in the new line are hidden, the pool keeps them
+	HideLinkLineSprites(LinePoints.Num());
+	ShownSegmentAngles.SetNum(LinePoints.Num());
 
+	// Iterate the changed points, and generate line between the point and the last point
+	for (int32 i = FMath::Max(SharedPointNum, 1); i < LinePoints.Num(); i++)
+	{
 		auto CurrentTileID = LinePoints[i];
 		auto LastTileID = LinePoints[i - 1];
-		FVector CurrentTileCoords, LastTileCorrds;
-		CurrentTileCoords.X = CurrentTileID % 6;
-		CurrentTileCoords.Y = CurrentTileID / 6;
-		LastTileCorrds.X = LastTileID % 6;
-		LastTileCorrds.Y = LastTileID / 6;
-
-		UPaperSpriteComponent* NewLineSegmentSprite = nullptr;
 
 		// Caculate the new line body sprite rotation angle
-		int32 NewSpriteAngle = 0;
-		if (CurrentTileCoords.X - LastTileCorrds.X == 1)
-		{
-			if (CurrentTileCoords.Y == LastTileCorrds.Y)
-			{
-				NewSpriteAngle = 0;
-			}
-			else if (CurrentTileCoords.Y - LastTileCorrds.Y == 1)
-			{
-				NewSpriteAngle = 45;
-			}
-			else if (CurrentTileCoords.Y - LastTileCorrds.Y == -1)
-			{
-				NewSpriteAngle = 315;
-			}
-		}
-		else if (CurrentTileCoords.X - LastTileCorrds.X == 0)
+		const int32 NewSpriteAngle = GetLineSegmentAngle(LastTileID, CurrentTileID);
+
+		// Set up the line corner
+		if (i >= 2)
 		{
-			if (CurrentTileCoords.Y - LastTileCorrds.Y == 1)
+			const int32 LastAngle = ShownSegmentAngles[i - 1];
+			UPaperSpriteComponent* LineCornerSprite = GetPooledSprite(LinkLineCornerRendererArray, i - 2, nullptr);
+
+			// Check if the two line in the same direction (positive or negative), if so no corner needed
+			if ((NewSpriteAngle + 360 - LastAngle) % 180 != 0)
 			{
-				NewSpriteAngle = 90;
+				if (SetupLineCorner(LineCornerSprite, NewSpriteAngle, LastAngle) == false)
+				{
+					UE_LOG(LogSGame, Warning, TEXT("Corner sprite setup failed."));
+					return false;
+				}
+
+				// Set to the last point location, we want the corner sort infront of lines to 
+				// make the intersection more beautiful
+				LineCornerSprite->SetRelativeLocation(GetLinkLinePointOffset(LastTileID, InitialTileID, 10));
+				LineCornerSprite->SetVisibility(true);
 			}
-			if (CurrentTileCoords.Y - LastTileCorrds.Y == -1)
+			else
 			{
-				NewSpriteAngle = 270;
+				LineCornerSprite->SetVisibility(false);
 			}
 		}
-		else if (CurrentTileCoords.X - LastTileCorrds.X == -1)
+
+		// Set up the line segment, the first segment is the tail
+		UPaperSpriteComponent* LineSegmentSprite = (i == 1) ? TailSpriteRenderComponent : GetPooledSprite(LinkLineSpriteRendererArray, i - 2, BodySprite);
+		SetupLineSegment(LineSegmentSprite, NewSpriteAngle);
+		LineSegmentSprite->SetVisibility(true);
+
+		// Set to the last point location
+		LineSegmentSprite->SetRelativeLocation(GetLinkLinePointOffset(LastTileID, InitialTileID, i == 1 ? -10 : 0));
+
+		// Mark down current angle
+		ShownSegmentAngles[i] = NewSpriteAngle;
+	}
+
+	// For the line head, it moves with the last point when appending or backtracking
+	const int32 HeadTileID = LinePoints.Last();
+	// We want the head sort infront of lines to 
+	// make the intersection more beautiful
+	HeadSpriteRenderComponent->SetRelativeLocation(GetLinkLinePointOffset(HeadTileID, InitialTileID, 10));
+
+	// Set the head rotation
+	HeadSpriteRenderComponent->SetRelativeRotation(FRotator(ShownSegmentAngles.Last(), 0, 0));
+
+	ShownLinePoints = LinePoints;
+	return true;
+}
+
+void ASGLinkLine::HideLinkLineSprites(int32 inSegmentIndex)
+{
+	// Only the shown segments can be visible
+	for (int32 i = FMath::Max(inSegmentIndex, 2); i < ShownLinePoints.Num(); i++)
+	{
+		LinkLineSpriteRendererArray[i - 2]->SetVisibility(false);
+		LinkLineCornerRendererArray[i - 2]->SetVisibility(false);
+	}
+}
+
+UPaperSpriteComponent* ASGLinkLine::CreatePooledSprite(UPaperSprite* inSprite)
+{
+	UPaperSpriteComponent* NewSprite = NewObject<UPaperSpriteComponent>(this);
+	NewSprite->Mobility = EComponentMobility::Movable;
+	NewSprite->SetSprite(inSprite);
+	NewSprite->SetVisibility(false);
+	NewSprite->RegisterComponent();
+	NewSprite->AttachToComponent(RootComponent, FAttachmentTransformRules::KeepRelativeTransform);
+	NewSprite->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	return NewSprite;
+}
+
+UPaperSpriteComponent* ASGLinkLine::GetPooledSprite(TArray<UPaperSpriteComponent*>& inOutPool, int32 inIndex, UPaperSprite* inSprite)
+{
+	while (inOutPool.Num() <= inIndex)
+	{
+		UE_LOG(LogSGame, Log, TEXT("Link line sprite pool grows to %d"), inOutPool.Num() + 1);
+		inOutPool.Add(CreatePooledSprite(inSprite));
+	}
+	return inOutPool[inIndex];
+}
+
+bool ASGLinkLine::UpdateLinkLineGroupedSprites(const TArray<int32>& LinePoints)
+{
+	checkSlow(LinkLineGroupedSpriteComponent != nullptr);
+
+	if (LinePoints.Num() < 2)
+	{
+		// Only one point cannot become a link line, hide the head and tail too
+		HideLinkLineGroupedSprites(0);
+		ShownLinePoints.Reset();
+		ShownSegmentAngles.Reset();
+
+		LinkLineGroupedSpriteComponent->MarkRenderStateDirty();
+		return true;
+	}
+
+	// The instances of the points shared with the shown line stay as they are
+	const int32 SharedPointNum = GetSharedPointNum(LinePoints);
+
+	// Mark down the initial position, all the instances are relative to it
+	const int32 InitialTileID = LinePoints[0];
+	if (SharedPointNum == 0)
+	{
+		PlaceLinkLineRoot(LinePoints[0]);
+	}
+
+	// The segments not in the new line are hidden, the slots keep them
+	HideLinkLineGroupedSprites(LinePoints.Num());
+	ShownSegmentAngles.SetNum(LinePoints.Num());
+
+	// Iterate the changed points, and move the instances between the point and the last point
+	for (int32 i = FMath::Max(SharedPointNum, 1); i < LinePoints.Num(); i++)
+	{
+		auto CurrentTileID = LinePoints[i];
+		auto LastTileID = LinePoints[i - 1];
+
+		const int32 NewSpriteAngle = GetLineSegmentAngle(LastTileID, CurrentTileID);
+		int32 SegmentInstance = GroupedTailInstance;
+
+		// Set up the line corner
+		if (i >= 2)
 		{
-			if (CurrentTileCoords.Y == LastTileCorrds.Y)
-			{
-				NewSpriteAngle = 180;
-			}
-			else if (CurrentTileCoords.Y - LastTileCorrds.Y == 1)
+			SegmentInstance = GetGroupedSegmentInstance(i);
+			for (int32 CornerInstance = SegmentInstance + 1; CornerInstance < SegmentInstance + GroupedSlotInstanceNum; CornerInstance++)
 			{
-				NewSpriteAngle = 135;
+				HideGroupedInstance(CornerInstance);
 			}
-			else if (CurrentTileCoords.Y - LastTileCorrds.Y == -1)
-			{
-				NewSpriteAngle = 225;
-			}
-		}
 
-		// Create line corners
-		if (i >= 2)
-		{
 			// Check if the two line in the same direction (positive or negative), if so no corner needed
-			if ((NewSpriteAngle + 360 - m_LastAngle) % 180 != 0)
+			const int32 LastAngle = ShownSegmentAngles[i - 1];
+			if ((NewSpriteAngle + 360 - LastAngle) % 180 != 0)
 			{
-				UPaperSpriteComponent* NewLineCornerSprite = nullptr;
-				NewLineCornerSprite = CreateLineCorner(NewSpriteAngle, m_LastAngle);
-				if (NewLineCornerSprite == nullptr)
+				bool bFlipped = false;
+				UPaperSprite* CornerSprite = GetLineCornerSprite(NewSpriteAngle, LastAngle, bFlipped);
+				if (CornerSprite == nullptr)
 				{
-					UE_LOG(LogSGame, Warning, TEXT("New corner sprite create failed."));
+					UE_LOG(LogSGame, Warning, TEXT("Corner sprite setup failed."));
 					return false;
 				}
 
-				// Set to the last point location
-				FVector CornerPosition;
-				CornerPosition.X = (LastTileCorrds.X - InitialTileCorrds.X) * 70;
-
 				// We want the corner sort infront of lines to 
 				// make the intersection more beautiful
-				CornerPosition.Y = 10;
-				CornerPosition.Z = (LastTileCorrds.Y - InitialTileCorrds.Y) * 70;
-				NewLineCornerSprite->SetRelativeLocation(CornerPosition);
+				const FVector CornerPosition = GetLinkLinePointOffset(LastTileID, InitialTileID, 10);
+				const int32 CornerInstance = SegmentInstance + ((CornerSprite == Corner_45_Sprite) ? 1 : (CornerSprite == Corner_90_Sprite) ? 2 : 3);
+				LinkLineGroupedSpriteComponent->UpdateInstanceTransform(CornerInstance, FTransform(FRotator(LastAngle, 0, 0), CornerPosition, FVector(1, 1, bFlipped == true ? -1 : 1)), false, false);
 			}
 		}
 
-		// For the line head
-		if (i == LinePoints.Num() - 1)
-		{
-			// Set to the current point location
-			FVector HeadPosition;
-			HeadPosition.X = (CurrentTileCoords.X - InitialTileCorrds.X) * 70;
-			// We want the head sort infront of lines to 
-			// make the intersection more beautiful
-			HeadPosition.Y = 10;
-			HeadPosition.Z = (CurrentTileCoords.Y - InitialTileCorrds.Y) * 70;
-			HeadSpriteRenderComponent->SetRelativeLocation(HeadPosition);
-
-			// Set the head rotation
-			HeadSpriteRenderComponent->SetRelativeRotation(FRotator(NewSpriteAngle, 0, 0));
-		}
-
-		// Create the line segment
-		NewLineSegmentSprite = CreateLineSegment(NewSpriteAngle, i == LinePoints.Num() - 1, i == 1);
-		if (NewLineSegmentSprite == NULL)
-		{
-			UE_LOG(LogSGame, Warning, TEXT("New sprite create failed."));
-			return false;
-		}
-
-		// Set to the last point location
-		FVector LineSegmentPosition;
-		LineSegmentPosition.X = (LastTileCorrds.X - InitialTileCorrds.X) * 70;
-		LineSegmentPosition.Y = i == 1 ? -10 : 0;
-		LineSegmentPosition.Z = (LastTileCorrds.Y - InitialTileCorrds.Y) * 70;
-		NewLineSegmentSprite->SetRelativeLocation(LineSegmentPosition);
+		// The segment body, the first segment is the tail. Cross lines are 1.414 long, the others a little bit longer than 1 to overlap
+		const FVector SegmentPosition = GetLinkLinePointOffset(LastTileID, InitialTileID, i == 1 ? -10 : 0);
+		const FVector SegmentScale((NewSpriteAngle % 90 != 0) ? 1.42f : 1.05f, 1, 1);
+		LinkLineGroupedSpriteComponent->UpdateInstanceTransform(SegmentInstance, FTransform(FRotator(NewSpriteAngle, 0, 0), SegmentPosition, SegmentScale), false, false);
 
 		// Mark down current angle
-		m_LastAngle = NewSpriteAngle;
+		ShownSegmentAngles[i] = NewSpriteAngle;
 	}
 
+	// For the line head, it moves with the last point when appending or backtracking
+	const int32 HeadTileID = LinePoints.Last();
+	const FVector HeadPosition = GetLinkLinePointOffset(HeadTileID, InitialTileID, 10);
+	LinkLineGroupedSpriteComponent->UpdateInstanceTransform(GroupedHeadInstance, FTransform(FRotator(ShownSegmentAngles.Last(), 0, 0), HeadPosition, HeadSpriteRenderComponent->RelativeScale3D), false, false);
+
+	// Send all the changed instances to the render thread at once
+	LinkLineGroupedSpriteComponent->UpdateBounds();
+	LinkLineGroupedSpriteComponent->MarkRenderStateDirty();
+
+	ShownLinePoints = LinePoints;
 	return true;
 }
 
+void ASGLinkLine::CreateGroupedSpriteInstances(int32 inSegmentSlotNum)
+{
+	checkSlow(LinkLineGroupedSpriteComponent != nullptr);
+
+	const FTransform HiddenTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+	if (LinkLineGroupedSpriteComponent->GetInstanceCount() == 0)
+	{
+		LinkLineGroupedSpriteComponent->AddInstance(HiddenTransform, TailSpriteRenderComponent->GetSprite());
+		LinkLineGroupedSpriteComponent->AddInstance(HiddenTransform, HeadSpriteRenderComponent->GetSprite());
+	}
+
+	while (LinkLineGroupedSpriteComponent->GetInstanceCount() < GroupedFirstSlotInstance + inSegmentSlotNum * GroupedSlotInstanceNum)
+	{
+		LinkLineGroupedSpriteComponent->AddInstance(HiddenTransform, BodySprite);
+		LinkLineGroupedSpriteComponent->AddInstance(HiddenTransform, Corner_45_Sprite);
+		LinkLineGroupedSpriteComponent->AddInstance(HiddenTransform, Corner_90_Sprite);
+		LinkLineGroupedSpriteComponent->AddInstance(HiddenTransform, Corner_135_Sprite);
+	}
+}
+
+int32 ASGLinkLine::GetGroupedSegmentInstance(int32 inSegmentIndex)
+{
+	checkSlow(inSegmentIndex >= 2);
+
+	const int32 SegmentInstance = GroupedFirstSlotInstance + (inSegmentIndex - 2) * GroupedSlotInstanceNum;
+	if (SegmentInstance >= LinkLineGroupedSpriteComponent->GetInstanceCount())
+	{
+		UE_LOG(LogSGame, Log, TEXT("Link line grouped sprite slots grow to %d"), inSegmentIndex - 1);
+		CreateGroupedSpriteInstances(inSegmentIndex - 1);
+	}
+	return SegmentInstance;
+}
+
+void ASGLinkLine::HideLinkLineGroupedSprites(int32 inSegmentIndex)
+{
+	if (inSegmentIndex <= 1)
+	{
+		HideGroupedInstance(GroupedTailInstance);
+		HideGroupedInstance(GroupedHeadInstance);
+	}
+
+	// Only the shown segments can be visible
+	for (int32 i = FMath::Max(inSegmentIndex, 2); i < ShownLinePoints.Num(); i++)
+	{
+		const int32 SegmentInstance = GroupedFirstSlotInstance + (i - 2) * GroupedSlotInstanceNum;
+		for (int32 InstanceIndex = SegmentInstance; InstanceIndex < SegmentInstance + GroupedSlotInstanceNum; InstanceIndex++)
+		{
+			HideGroupedInstance(InstanceIndex);
+		}
+	}
+}
+
+void ASGLinkLine::HideGroupedInstance(int32 inInstanceIndex)
+{
+	LinkLineGroupedSpriteComponent->UpdateInstanceTransform(inInstanceIndex, FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), false, false);
+}
+
 bool ASGLinkLine::UpdateLinkLineRibbon(const TArray<int32>& LinePoints)
 {
 	return true;
@@ -312,6 +455,14 @@ bool ASGLinkLine::GetReferencedContentObjects(TArray<UObject*>& Objects) const
 			Objects.Add(LinkLineSpriteRendererArray[i]->GetSprite());
 		}
 	}
+
+	for (int i = 0; i < LinkLineCornerRendererArray.Num(); i++)
+	{
+		if (LinkLineCornerRendererArray[i] != nullptr && LinkLineCornerRendererArray[i]->GetSprite() != nullptr)
+		{
+			Objects.Add(LinkLineCornerRendererArray[i]->GetSprite());
+		}
+	}
 	return true;
 }
 #endif
@@ -325,20 +476,9 @@ bool ASGLinkLine::ReplayLinkAnimation(TArray<ASGTileBase*>& CollectTiles)
 {
 	CachedCollectTiles = CollectTiles;
 
-	if (MessageEndpoint.IsValid() == true)
-	{
-		// Reset the tile link status
-		FMessage_Gameplay_TileLinkedStatusChange* LinkStatusChangeMessage = new FMessage_Gameplay_TileLinkedStatusChange{ 0 };
-		LinkStatusChangeMessage->TileID = -1;
-		LinkStatusChangeMessage->NewLinkStatus = false;
-		MessageEndpoint->Publish(LinkStatusChangeMessage, EMessageScope::Process);
-
-		// Reset the tile selectable status
-		FMessage_Gameplay_TileSelectableStatusChange* SelectableMessage = new FMessage_Gameplay_TileSelectableStatusChange{ 0 };
-		SelectableMessage->TileID = -1;
-		SelectableMessage->NewSelectableStatus = true;
-		MessageEndpoint->Publish(SelectableMessage, EMessageScope::Process);
-	}
+	// Reset the tile link and selectable status
+	checkSlow(ParentGrid);
+	ParentGrid->ResetTiles();
 
 	// Kick off the replay
 	BeginReplayLinkAnimation();
@@ -362,9 +502,7 @@ void ASGLinkLine::EndReplayLinkAnimation()
 	else
 	{
 		// We don't need to refill the grid, send tile finish moving message directly
-		checkSlow(MessageEndpoint.IsValid());
-		FMessage_Gameplay_AllTileFinishMove* Message = new FMessage_Gameplay_AllTileFinishMove();
-		MessageEndpoint->Publish(Message, EMessageScope::Process);
+		FSGMessageQueue::Get().Publish<FMessage_Gameplay_AllTileFinishMove>();
 	}
 	
 	// Reset the linkline after all
@@ -386,38 +524,29 @@ void ASGLinkLine::ReplaySingleLinkLineAniamtion(int32 ReplayLength)
 	}
 
 	// Construct the link line again
-	UpdateLinkLineSprites(ReplayingLinkLinePoints);
+	LinkLineMode == ELinkLineMode::ELLM_GroupedSprite ? UpdateLinkLineGroupedSprites(ReplayingLinkLinePoints) : UpdateLinkLineSprites(ReplayingLinkLinePoints);
 
 	checkSlow(ParentGrid);
-	if (this->MessageEndpoint.IsValid() == true)
+	if (ReplayLength == 1)
 	{
-		if (ReplayLength == 1)
-		{
-			// Send the selected message to the fake tail
-			FMessage_Gameplay_TileLinkedStatusChange* LinkStatusChangeMessage = new FMessage_Gameplay_TileLinkedStatusChange{ 0 };
-			const ASGTileBase* FakeSelectedTile = ParentGrid->GetTileFromGridAddress(LinkLinePoints[0]);
-			LinkStatusChangeMessage->TileID = FakeSelectedTile->GetTileID();
-			LinkStatusChangeMessage->NewLinkStatus = true;
-			MessageEndpoint->Publish(LinkStatusChangeMessage, EMessageScope::Process);
-
-			// If the tile is an enemy tile, then play hit animation
-			FMessage_Gameplay_EnemyGetHit* HitMessage = new FMessage_Gameplay_EnemyGetHit{ 0 };
-			HitMessage->TileID = FakeSelectedTile->GetTileID();
-			MessageEndpoint->Publish(HitMessage, EMessageScope::Process);
-		}
-
-		// Send the selected message to the fake head
-		FMessage_Gameplay_TileLinkedStatusChange* LinkStatusChangeMessage = new FMessage_Gameplay_TileLinkedStatusChange{ 0 };
-		const ASGTileBase* FakeSelectedTile = ParentGrid->GetTileFromGridAddress(LinkLinePoints[ReplayLength]);
-		LinkStatusChangeMessage->TileID = FakeSelectedTile->GetTileID();
-		LinkStatusChangeMessage->NewLinkStatus = true;
-		MessageEndpoint->Publish(LinkStatusChangeMessage, EMessageScope::Process);
+		// Show the fake tail as linked
+		const ASGTileBase* FakeSelectedTile = ParentGrid->GetTileFromGridAddress(LinkLinePoints[0]);
+		ParentGrid->SetTileLinkedStatus(LinkLinePoints[0], true);
 
 		// If the tile is an enemy tile, then play hit animation
-		FMessage_Gameplay_EnemyGetHit* HitMessage = new FMessage_Gameplay_EnemyGetHit{ 0 };
-		HitMessage->TileID = FakeSelectedTile->GetTileID();
-		MessageEndpoint->Publish(HitMessage, EMessageScope::Process);
+		FMessage_Gameplay_EnemyGetHit& HitMessage = FSGMessageQueue::Get().Publish<FMessage_Gameplay_EnemyGetHit>();
+		HitMessage = FMessage_Gameplay_EnemyGetHit{ 0 };
+		HitMessage.TileID = FakeSelectedTile->GetTileID();
 	}
+
+	// Show the fake head as linked
+	const ASGTileBase* FakeSelectedTile = ParentGrid->GetTileFromGridAddress(LinkLinePoints[ReplayLength]);
+	ParentGrid->SetTileLinkedStatus(LinkLinePoints[ReplayLength], true);
+
+	// If the tile is an enemy tile, then play hit animation
+	FMessage_Gameplay_EnemyGetHit& HitMessage = FSGMessageQueue::Get().Publish<FMessage_Gameplay_EnemyGetHit>();
+	HitMessage = FMessage_Gameplay_EnemyGetHit{ 0 };
+	HitMessage.TileID = FakeSelectedTile->GetTileID();
 }
 
 TArray<int32> ASGLinkLine::StraightenThePoints(TArray<int32> inPointsToStrighten)
@@ -452,106 +581,154 @@ TArray<int32> ASGLinkLine::StraightenThePoints(TArray<int32> inPointsToStrighten
 	return ResultPoints;
 }
 
-UPaperSpriteComponent* ASGLinkLine::CreateLineCorner(int inAngle, int inLastAngle)
+bool ASGLinkLine::SetupLineCorner(UPaperSpriteComponent* inCornerSprite, int inAngle, int inLastAngle)
 {
-	// Create the base sprite and initialize
-	UPaperSpriteComponent* NewSprite = nullptr;
-	NewSprite = NewObject<UPaperSpriteComponent>(this);
-	NewSprite->Mobility = EComponentMobility::Movable;
-	NewSprite->RegisterComponent();
-	NewSprite->AttachToComponent(RootComponent, FAttachmentTransformRules::KeepRelativeTransform);
-	NewSprite->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	checkSlow(inCornerSprite != nullptr);
 
-	// Rotate to the last angle
-	NewSprite->SetRelativeRotation(FRotator(inLastAngle, 0, 0));
-	
 	// Choose the sprite texture
-	int32 AngleDiff = (inAngle - inLastAngle + 360) % 360;
-	switch (AngleDiff)
+	bool bFlipped = false;
+	UPaperSprite* CornerSprite = GetLineCornerSprite(inAngle, inLastAngle, bFlipped);
+	if (CornerSprite == nullptr)
 	{
-	case 45:
-	{
-		NewSprite->SetRelativeScale3D(FVector(1, 1, -1));
-		NewSprite->SetSprite(Corner_135_Sprite);
-		break;
-	}
-	case 225:
-	{
-		NewSprite->SetSprite(Corner_45_Sprite);
-		break;
-	}
-	case 90:
-	{
-		NewSprite->SetRelativeScale3D(FVector(1, 1, -1));
-		NewSprite->SetSprite(Corner_90_Sprite);
-		break;
-	}
-	case 270:
-	{
-		NewSprite->SetSprite(Corner_90_Sprite);
-		break;
+		return false;
 	}
-	case 135:
+
+	// Rotate to the last angle, the pooled corner may be flipped by the last use
+	inCornerSprite->SetRelativeRotation(FRotator(inLastAngle, 0, 0));
+	inCornerSprite->SetRelativeScale3D(FVector(1, 1, bFlipped == true ? -1 : 1));
+	inCornerSprite->SetSprite(CornerSprite);
+
+	return true;
+}
+
+void ASGLinkLine::SetupLineSegment(UPaperSpriteComponent* inSegmentSprite, int inAngle)
+{
+	checkSlow(inSegmentSprite != nullptr);
+
+	if (inAngle % 90 != 0)
 	{
-		NewSprite->SetRelativeScale3D(FVector(1, 1, -1));
-		NewSprite->SetSprite(Corner_45_Sprite);
-		break;
+		// Set Scale to 1.414 if it is cross line
+		inSegmentSprite->SetRelativeScale3D(FVector(1.42f, 1, 1));
 	}
-	case 315:
+	else
 	{
-		NewSprite->SetSprite(Corner_135_Sprite);
-		break;
+		// Set Scale to a little bit longer than 1 to overlap
+		inSegmentSprite->SetRelativeScale3D(FVector(1.05f, 1, 1));
 	}
-	default:
+
+	// Set the rotation to the new angle
+	inSegmentSprite->SetRelativeRotation(FRotator(inAngle, 0, 0));
+}
+
+int32 ASGLinkLine::GetSharedPointNum(const TArray<int32>& LinePoints) const
+{
+	int32 SharedPointNum = 0;
+	while (SharedPointNum < LinePoints.Num() && SharedPointNum < ShownLinePoints.Num() && LinePoints[SharedPointNum] == ShownLinePoints[SharedPointNum])
 	{
-		UE_LOG(LogSGame, Warning, TEXT("Invalid angle, returning null sprite!"));
-		return nullptr;
-	}
+		SharedPointNum++;
 	}
+	return SharedPointNum;
+}
 
-	// Add to the body sprite array
-	LinkLineSpriteRendererArray.Add(NewSprite);
+void ASGLinkLine::PlaceLinkLineRoot(int32 inInitialTileID)
+{
+	checkSlow(ParentGrid != nullptr);
 
-	return NewSprite;
+	// The link line should scale to 1.5 to fit the grid
+	RootComponent->SetWorldScale3D(FVector(LinkLineScale, LinkLineScale, LinkLineScale));
+
+	// Set the link line at the head position, the line keeps its own depth
+	FVector LinkLineWorldLocation = ParentGrid->GetLocationFromGridAddress(inInitialTileID);
+	LinkLineWorldLocation.Y = RootComponent->GetComponentLocation().Y;
+	RootComponent->SetWorldLocation(LinkLineWorldLocation);
 }
 
-UPaperSpriteComponent* ASGLinkLine::CreateLineSegment(int inAngle, bool inIsHead, bool inIsTail)
+FVector ASGLinkLine::GetLinkLinePointOffset(int32 inTileID, int32 inInitialTileID, float inDepth) const
 {
-	UPaperSpriteComponent* NewSprite = NULL;
-	if (inIsTail == true)
-	{
-		NewSprite = TailSpriteRenderComponent;
-	}
-	else
-	{
-		NewSprite = NewObject<UPaperSpriteComponent>(this);
-		NewSprite->Mobility = EComponentMobility::Movable;
-		NewSprite->SetSprite(BodySprite);
-		NewSprite->RegisterComponent();
-		NewSprite->AttachToComponent(RootComponent, FAttachmentTransformRules::KeepRelativeTransform);
-		NewSprite->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	checkSlow(ParentGrid != nullptr);
 
-		// Add to the body sprite array
-		LinkLineSpriteRendererArray.Add(NewSprite);
-	}
+	// The sprites are under the scaled root
+	FVector PointOffset = (ParentGrid->GetGridCell(inTileID).LocalLocation - ParentGrid->GetGridCell(inInitialTileID).LocalLocation) / LinkLineScale;
+	PointOffset.Y = inDepth;
+	return PointOffset;
+}
 
-	checkSlow(NewSprite != nullptr);
+int32 ASGLinkLine::GetLineSegmentAngle(int32 inLastTileID, int32 inCurrentTileID) const
+{
+	checkSlow(ParentGrid != nullptr);
+	const FIntPoint& CurrentTileCoords = ParentGrid->GetGridCoords(inCurrentTileID);
+	const FIntPoint& LastTileCorrds = ParentGrid->GetGridCoords(inLastTileID);
 
-	if (inAngle % 90 != 0)
+	int32 NewSpriteAngle = 0;
+	if (CurrentTileCoords.X - LastTileCorrds.X == 1)
 	{
-		// Set Scale to 1.414 if it is cross line
-		NewSprite->SetRelativeScale3D(FVector(1.42f, 1, 1));
+		if (CurrentTileCoords.Y == LastTileCorrds.Y)
+		{
+			NewSpriteAngle = 0;
+		}
+		else if (CurrentTileCoords.Y - LastTileCorrds.Y == 1)
+		{
+			NewSpriteAngle = 45;
+		}
+		else if (CurrentTileCoords.Y - LastTileCorrds.Y == -1)
+		{
+			NewSpriteAngle = 315;
+		}
 	}
-	else
+	else if (CurrentTileCoords.X - LastTileCorrds.X == 0)
 	{
-		// Set Scale to a little bit longer than 1 to overlap
-		NewSprite->SetRelativeScale3D(FVector(1.05f, 1, 1));
+		if (CurrentTileCoords.Y - LastTileCorrds.Y == 1)
+		{
+			NewSpriteAngle = 90;
+		}
+		if (CurrentTileCoords.Y - LastTileCorrds.Y == -1)
+		{
+			NewSpriteAngle = 270;
+		}
 	}
+	else if (CurrentTileCoords.X - LastTileCorrds.X == -1)
+	{
+		if (CurrentTileCoords.Y == LastTileCorrds.Y)
+		{
+			NewSpriteAngle = 180;
+		}
+		else if (CurrentTileCoords.Y - LastTileCorrds.Y == 1)
+		{
+			NewSpriteAngle = 135;
+		}
+		else if (CurrentTileCoords.Y - LastTileCorrds.Y == -1)
+		{
+			NewSpriteAngle = 225;
+		}
+	}
+	return NewSpriteAngle;
+}
 
-	// Set the rotation to the new angle
-	NewSprite->SetRelativeRotation(FRotator(inAngle, 0, 0));
-
-	return NewSprite;
+UPaperSprite* ASGLinkLine::GetLineCornerSprite(int inAngle, int inLastAngle, bool& outFlipped) const
+{
+	outFlipped = false;
+	int32 AngleDiff = (inAngle - inLastAngle + 360) % 360;
+	switch (AngleDiff)
+	{
+	case 45:
+		outFlipped = true;
+		return Corner_135_Sprite;
+	case 225:
+		return Corner_45_Sprite;
+	case 90:
+		outFlipped = true;
+		return Corner_90_Sprite;
+	case 270:
+		return Corner_90_Sprite;
+	case 135:
+		outFlipped = true;
+		return Corner_45_Sprite;
+	case 315:
+		return Corner_135_Sprite;
+	default:
+		UE_LOG(LogSGame, Warning, TEXT("Invalid angle, cannot set up the corner sprite!"));
+		return nullptr;
+	}
 }
 
 void ASGLinkLine::ResetLinkState()
@@ -5,7 +5,7 @@
 #include "GameFramework/Actor.h"
 #include "PaperSprite.h"
 #include "PaperSpriteComponent.h"
-#include "MessageEndpoint.h"
+#include "PaperGroupedSpriteComponent.h"
 
 #include "SGameMessages.h"
 #include "SGTileBase.h"
@@ -29,6 +29,7 @@ enum class ELinkLineMode : uint8
 {
 	ELLM_Sprite,		// Use the 2D sprite linkline
 	ELLM_Ribbon,		// Use the ribbon linkline
+	ELLM_GroupedSprite,	// Use the 2D sprite linkline batched into one grouped sprite component, one draw call for the whole line
 };
 
 /** Linkline emitter contains a collision component to get tile overlap event */
@@ -181,13 +182,30 @@ protected:
 	UPROPERTY(Category = Sprite, EditAnywhere, BlueprintReadOnly, meta = (DisplayThumbnail = "true"))
 	UPaperSprite* BodySprite;
 
-	/** Body sprites for render the link line body lines and coners */
+	/** Pooled body sprites, the body of the line segment N (from point N-1 to point N) is entry N-2, the segment 1 is the tail */
 	UPROPERTY(Category = Sprite, VisibleAnywhere, BlueprintReadOnly)
 	TArray<UPaperSpriteComponent*> LinkLineSpriteRendererArray;
 
-	/** Update link line sprites using the line points */
+	/** Pooled corner sprites, the corner at point N-1 is entry N-2, hidden if the line goes straight */
+	UPROPERTY(Category = Sprite, VisibleAnywhere, BlueprintReadOnly)
+	TArray<UPaperSpriteComponent*> LinkLineCornerRendererArray;
+
+	/**
+	* Update link line sprites using the line points, only the sprites after the points shared with the
+	* shown line are touched, so appending or backtracking a tile costs the same for any line length
+	*/
 	bool UpdateLinkLineSprites(const TArray<int32>& LinePoints);
 
+	/** All the body, corner, head and tail quads of the grouped sprite mode */
+	UPROPERTY(Category = Sprite, VisibleAnywhere, BlueprintReadOnly)
+	UPaperGroupedSpriteComponent* LinkLineGroupedSpriteComponent;
+
+	/**
+	* Update the grouped sprite instances using the line points, the instances are never added or removed
+	* while linking, the changed ones get their transforms updated in place and the hidden ones are scaled to zero
+	*/
+	bool UpdateLinkLineGroupedSprites(const TArray<int32>& LinePoints);
+
 	// The ribbon ParticleSystem to display the linkline
 	UPROPERTY(Category = Ribbon, EditAnywhere, BlueprintReadOnly, meta = (DisplayThumbnail = "true"))
 	UParticleSystem* LinkLineRibbonPS;
@@ -212,14 +230,55 @@ private:
 	UPROPERTY(Category = Sprite, VisibleAnywhere, BlueprintReadOnly, meta = (ExposeFunctionCategories = "Sprite,Rendering,Physics,Components|Sprite", AllowPrivateAccess = "true"))
 	UPaperSpriteComponent* TailSpriteRenderComponent;
 
-	UPaperSpriteComponent* CreateLineCorner(int inAngle, int inLastAngle);
-	UPaperSpriteComponent* CreateLineSegment(int inAngle, bool inIsHead, bool inIsTail);
+	/** Create a hidden sprite component for the pool */
+	UPaperSpriteComponent* CreatePooledSprite(UPaperSprite* inSprite);
+
+	/** Get the pool entry, the pool grows if the line is longer than the board was */
+	UPaperSpriteComponent* GetPooledSprite(TArray<UPaperSpriteComponent*>& inOutPool, int32 inIndex, UPaperSprite* inSprite);
+
+	/** Hide the pooled sprites of the segments from the segment index on */
+	void HideLinkLineSprites(int32 inSegmentIndex);
+
+	bool SetupLineCorner(UPaperSpriteComponent* inCornerSprite, int inAngle, int inLastAngle);
+	void SetupLineSegment(UPaperSpriteComponent* inSegmentSprite, int inAngle);
+
+	/** How many points from the start the line shares with the shown line */
+	int32 GetSharedPointNum(const TArray<int32>& LinePoints) const;
+
+	/** Scale and move the link line to the first point, all the sprites are relative to it */
+	void PlaceLinkLineRoot(int32 inInitialTileID);
+
+	/** The sprite location of the tile relative to the first point of the line, at the depth */
+	FVector GetLinkLinePointOffset(int32 inTileID, int32 inInitialTileID, float inDepth) const;
+
+	/** The rotation angle of the segment between the two neighbor tiles */
+	int32 GetLineSegmentAngle(int32 inLastTileID, int32 inCurrentTileID) const;
+
+	/**
+	* The corner sprite between the two segments
+	*
+	* @param outFlipped		whether the sprite should be flipped on Z
+	* @return nullptr if the angles cannot make a corner
+	*/
+	UPaperSprite* GetLineCornerSprite(int inAngle, int inLastAngle, bool& outFlipped) const;
+
+	/** Add the hidden instances of the grouped sprite mode, one slot per pooled segment */
+	void CreateGroupedSpriteInstances(int32 inSegmentSlotNum);
+
+	/** Get the first instance of the segment slot, the slots grow if the line is longer than the board was */
+	int32 GetGroupedSegmentInstance(int32 inSegmentIndex);
+
+	/** Hide the grouped instances of the segments from the segment index on */
+	void HideLinkLineGroupedSprites(int32 inSegmentIndex);
+
+	/** Scale the grouped instance to zero, it is kept for the next use */
+	void HideGroupedInstance(int32 inInstanceIndex);
 
-	int								m_CurrentSpriteNum;
-	int								m_LastAngle;
+	/** The points the sprites show now */
+	TArray<int32>					ShownLinePoints;
 
-	// Holds the messaging endpoint.
-	TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> MessageEndpoint;
+	/** The angle of each shown line segment, indexed by the end point */
+	TArray<int32>					ShownSegmentAngles;
 
 	// Hold the reference to its parent grid
 	ASGGrid* ParentGrid;
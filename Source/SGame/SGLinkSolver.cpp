@@ -0,0 +1,338 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGame.h"
+#include "SGLinkSolver.h"
+
+/** How many nodes are visited between two clock reads */
+static const int32 SolverClockInterval = 256;
+
+FSGLinkSolver::FSGLinkSolver()
+	: Simulation(nullptr)
+	, TakeDamageMask(0)
+	, CauseDamageMask(0)
+	, CancelFlag(nullptr)
+	, DeadlineSeconds(0)
+	, VisitedNodeNum(0)
+	, PrunedNodeNum(0)
+	, bBudgetExceeded(false)
+{
+	FMemory::Memzero(TileResources);
+	FMemory::Memzero(TileLifeArmor);
+}
+
+bool FSGLinkSolver::Solve(const FSGBoardSimulation& inSimulation, const FSGLinkSolverSettings& inSettings)
+{
+	BeginSearch(inSimulation, inSettings);
+
+	// Every tile can start a link line
+	FSGBoardMask StartMask = inSimulation.GetBoardModel().GetLinkableMask(-1);
+	StartAddresses.SetNum(1);
+	while (StartMask != 0 && bBudgetExceeded == false)
+	{
+		StartAddresses[0] = FSGBoardModel::PopLowestAddress(StartMask);
+		SearchPrefix(StartAddresses);
+	}
+
+	Simulation = nullptr;
+	return bBudgetExceeded == false;
+}
+
+void FSGLinkSolver::BeginSearch(const FSGBoardSimulation& inSimulation, const FSGLinkSolverSettings& inSettings)
+{
+	Simulation = &inSimulation;
+	Settings = inSettings;
+	Settings.TopK = FMath::Max(Settings.TopK, 1);
+
+	ResetRankings();
+	VisitedNodeNum = 0;
+	PrunedNodeNum = 0;
+	bBudgetExceeded = false;
+	DeadlineSeconds = FPlatformTime::Seconds() + Settings.TimeBudgetSeconds;
+
+	// Resolve the tile rules once, the search only reads the masks and the per address values
+	TakeDamageMask = 0;
+	CauseDamageMask = 0;
+	FSGBoardMask ScanMask = inSimulation.GetBoardModel().GetLinkableMask(-1);
+	while (ScanMask != 0)
+	{
+		const int32 GridAddress = FSGBoardModel::PopLowestAddress(ScanMask);
+		const FSGTileArchetype& Archetype = inSimulation.GetTileArchetype(GridAddress);
+		if (Archetype.Abilities.bCanTakeDamage == true && Archetype.Abilities.bEnemyTile == true)
+		{
+			TakeDamageMask |= FSGBoardModel::AddressToMask(GridAddress);
+		}
+		if (Archetype.Abilities.bCanCauseDamage == true && Archetype.Abilities.bEnemyTile == false)
+		{
+			CauseDamageMask |= FSGBoardModel::AddressToMask(GridAddress);
+		}
+
+		float Resources = 0;
+		for (const FTileResourceUnit& Resource : Archetype.TileResourceArray)
+		{
+			Resources += Resource.ResourceAmount;
+		}
+		TileResources[GridAddress] = Resources;
+
+		const FTileLifeArmorInfo& LifeArmorInfo = inSimulation.GetTile(GridAddress).LifeArmorInfo;
+		TileLifeArmor[GridAddress] = FMath::Max(LifeArmorInfo.CurrentLife, 0.0f) + FMath::Max(LifeArmorInfo.CurrentArmor, 0.0f);
+	}
+}
+
+void FSGLinkSolver::SearchPrefix(const TArray<int32>& inPrefixAddresses)
+{
+	checkSlow(Simulation != nullptr && inPrefixAddresses.Num() > 0 && &inPrefixAddresses != &PathAddresses);
+
+	// Rebuild the path state of the prefix
+	FPathState State;
+	PathAddresses.Reset();
+	PathDamageInfos.Reset();
+	EnemyUndoStack.Reset();
+	for (int32 GridAddress : inPrefixAddresses)
+	{
+		ExtendPath(GridAddress, State);
+	}
+
+	Search(State);
+}
+
+void FSGLinkSolver::ResetRankings()
+{
+	BestByDamage.Reset();
+	BestByResources.Reset();
+}
+
+void FSGLinkSolver::MergeRankings(const TArray<FSGLinkSolution>& inBestByDamage, const TArray<FSGLinkSolution>& inBestByResources)
+{
+	for (const FSGLinkSolution& Solution : inBestByDamage)
+	{
+		OfferSolution(BestByDamage, true, Solution.LinkAddresses, Solution.LinkMask, Solution.DamageDealt, Solution.Resources, Solution.KilledNum);
+	}
+	for (const FSGLinkSolution& Solution : inBestByResources)
+	{
+		OfferSolution(BestByResources, false, Solution.LinkAddresses, Solution.LinkMask, Solution.DamageDealt, Solution.Resources, Solution.KilledNum);
+	}
+}
+
+void FSGLinkSolver::Search(const FPathState& inState)
+{
+	VisitedNodeNum++;
+	if (CheckBudget() == true)
+	{
+		return;
+	}
+
+	if (PathAddresses.Num() >= Settings.MinLinkLength && (Settings.RequiredMask == 0 || (inState.VisitedMask & Settings.RequiredMask) != 0))
+	{
+		const float Resources = inState.CollectedResources + inState.KilledResources;
+		if (inState.DamageDealt > 0)
+		{
+			OfferSolution(BestByDamage, true, PathAddresses, inState.VisitedMask, inState.DamageDealt, Resources, inState.KilledNum);
+		}
+		OfferSolution(BestByResources, false, PathAddresses, inState.VisitedMask, inState.DamageDealt, Resources, inState.KilledNum);
+	}
+
+	if (CanPrune(inState) == true)
+	{
+		PrunedNodeNum++;
+		return;
+	}
+
+	FSGBoardMask NextMask = Simulation->GetBoardModel().GetLinkableMask(PathAddresses.Last()) & ~inState.VisitedMask;
+	while (NextMask != 0 && bBudgetExceeded == false)
+	{
+		const int32 NextAddress = FSGBoardModel::PopLowestAddress(NextMask);
+		const int32 DamageInfoNum = PathDamageInfos.Num();
+		const int32 EnemyUndoNum = EnemyUndoStack.Num();
+
+		FPathState NextState = inState;
+		ExtendPath(NextAddress, NextState);
+		Search(NextState);
+		RetractPath(DamageInfoNum, EnemyUndoNum);
+	}
+}
+
+void FSGLinkSolver::ExtendPath(int32 inGridAddress, FPathState& inOutState)
+{
+	const FSGBoardMask Bit = FSGBoardModel::AddressToMask(inGridAddress);
+	inOutState.VisitedMask |= Bit;
+	PathAddresses.Add(inGridAddress);
+
+	// Same damage rule as the link evaluation, every linked enemy takes all the damage infos of the path in order
+	if ((TakeDamageMask & Bit) != 0)
+	{
+		inOutState.EnemyMask |= Bit;
+		EnemyLifeArmor[inGridAddress] = Simulation->GetTile(inGridAddress).LifeArmorInfo;
+		for (int32 i = 0; i < PathDamageInfos.Num() && (inOutState.KilledMask & Bit) == 0; i++)
+		{
+			DamageEnemy(inGridAddress, PathDamageInfos[i], inOutState);
+		}
+	}
+	else
+	{
+		inOutState.CollectedResources += TileResources[inGridAddress];
+	}
+
+	if ((CauseDamageMask & Bit) != 0)
+	{
+		const FTileDamageInfo& DamageInfo = Simulation->GetTileArchetype(inGridAddress).CauseDamageInfo;
+		PathDamageInfos.Add(DamageInfo);
+
+		FSGBoardMask LivingMask = inOutState.EnemyMask & ~inOutState.KilledMask;
+		while (LivingMask != 0)
+		{
+			FEnemyUndo Undo;
+			Undo.GridAddress = FSGBoardModel::PopLowestAddress(LivingMask);
+			Undo.LifeArmorInfo = EnemyLifeArmor[Undo.GridAddress];
+			EnemyUndoStack.Add(Undo);
+
+			DamageEnemy(Undo.GridAddress, DamageInfo, inOutState);
+		}
+	}
+}
+
+void FSGLinkSolver::RetractPath(int32 inDamageInfoNum, int32 inEnemyUndoNum)
+{
+	while (EnemyUndoStack.Num() > inEnemyUndoNum)
+	{
+		const FEnemyUndo Undo = EnemyUndoStack.Pop(false);
+		EnemyLifeArmor[Undo.GridAddress] = Undo.LifeArmorInfo;
+	}
+	PathDamageInfos.SetNum(inDamageInfoNum, false);
+	PathAddresses.Pop(false);
+}
+
+void FSGLinkSolver::DamageEnemy(int32 inEnemyAddress, const FTileDamageInfo& inDamageInfo, FPathState& inOutState)
+{
+	FTileLifeArmorInfo& LifeArmorInfo = EnemyLifeArmor[inEnemyAddress];
+	const float LifeArmorBefore = FMath::Max(LifeArmorInfo.CurrentLife, 0.0f) + FMath::Max(LifeArmorInfo.CurrentArmor, 0.0f);
+	const bool bKilled = FSGBoardSimulation::TakeTileDamage(inDamageInfo, LifeArmorInfo);
+	inOutState.DamageDealt += LifeArmorBefore - FMath::Max(LifeArmorInfo.CurrentLife, 0.0f) - FMath::Max(LifeArmorInfo.CurrentArmor, 0.0f);
+
+	if (bKilled == true)
+	{
+		inOutState.KilledMask |= FSGBoardModel::AddressToMask(inEnemyAddress);
+		inOutState.KilledResources += TileResources[inEnemyAddress];
+		inOutState.KilledNum++;
+	}
+}
+
+bool FSGLinkSolver::CanPrune(const FPathState& inState) const
+{
+	// A path which has not linked a required tile yet and cannot reach one is never offered
+	if (Settings.RequiredMask != 0 && (inState.VisitedMask & Settings.RequiredMask) == 0 && (GetReachMask(inState.VisitedMask) & Settings.RequiredMask) == 0)
+	{
+		return true;
+	}
+
+	const FSGBoardMask ReachMask = GetReachMask(inState.VisitedMask);
+
+	// At best every reachable tile is collected, and every linked enemy loses all its life and armor
+	float ResourcesBound = inState.CollectedResources;
+	float DamageBound = 0;
+	FSGBoardMask BoundMask = ReachMask | inState.EnemyMask;
+	while (BoundMask != 0)
+	{
+		const int32 GridAddress = FSGBoardModel::PopLowestAddress(BoundMask);
+		ResourcesBound += FMath::Max(TileResources[GridAddress], 0.0f);
+		if ((TakeDamageMask & FSGBoardModel::AddressToMask(GridAddress)) != 0)
+		{
+			DamageBound += TileLifeArmor[GridAddress];
+		}
+	}
+
+	// Each ranking is checked on its own, by the same order the solutions are offered in. A path dealing no damage never
+	// enters the damage ranking, so a branch without a reachable enemy is left to the resources ranking
+	const bool bDamageDone = DamageBound <= 0
+		|| (BestByDamage.Num() >= Settings.TopK && IsBetterSolution(true, DamageBound, ResourcesBound, BestByDamage.Last()) == false);
+	const bool bResourcesDone = BestByResources.Num() >= Settings.TopK && IsBetterSolution(false, DamageBound, ResourcesBound, BestByResources.Last()) == false;
+	return bDamageDone == true && bResourcesDone == true;
+}
+
+FSGBoardMask FSGLinkSolver::GetReachMask(FSGBoardMask inVisitedMask) const
+{
+	const FSGBoardModel& BoardModel = Simulation->GetBoardModel();
+	FSGBoardMask ReachMask = 0;
+	FSGBoardMask FrontierMask = FSGBoardModel::AddressToMask(PathAddresses.Last());
+	while (FrontierMask != 0)
+	{
+		const FSGBoardMask NewMask = BoardModel.GetLinkableMask(FSGBoardModel::PopLowestAddress(FrontierMask)) & ~inVisitedMask & ~ReachMask;
+		ReachMask |= NewMask;
+		FrontierMask |= NewMask;
+	}
+	return ReachMask;
+}
+
+void FSGLinkSolver::OfferSolution(TArray<FSGLinkSolution>& inOutRanking, bool bByDamage, const TArray<int32>& inLinkAddresses, FSGBoardMask inLinkMask, float inDamageDealt, float inResources, int32 inKilledNum)
+{
+	auto IsBetter = [bByDamage, inDamageDealt, inResources](const FSGLinkSolution& Solution)
+	{
+		return IsBetterSolution(bByDamage, inDamageDealt, inResources, Solution);
+	};
+
+	if (inOutRanking.Num() >= Settings.TopK && IsBetter(inOutRanking.Last()) == false)
+	{
+		return;
+	}
+
+	// The same tiles linked in another order, keep only the better one
+	for (int32 i = 0; i < inOutRanking.Num(); i++)
+	{
+		if (inOutRanking[i].LinkMask == inLinkMask)
+		{
+			if (IsBetter(inOutRanking[i]) == false)
+			{
+				return;
+			}
+			inOutRanking.RemoveAt(i, 1, false);
+			break;
+		}
+	}
+
+	int32 InsertIndex = 0;
+	while (InsertIndex < inOutRanking.Num() && IsBetter(inOutRanking[InsertIndex]) == false)
+	{
+		InsertIndex++;
+	}
+
+	inOutRanking.InsertDefaulted(InsertIndex);
+	FSGLinkSolution& Solution = inOutRanking[InsertIndex];
+	Solution.LinkAddresses = inLinkAddresses;
+	Solution.LinkMask = inLinkMask;
+	Solution.DamageDealt = inDamageDealt;
+	Solution.Resources = inResources;
+	Solution.KilledNum = inKilledNum;
+
+	if (inOutRanking.Num() > Settings.TopK)
+	{
+		inOutRanking.Pop(false);
+	}
+}
+
+bool FSGLinkSolver::IsBetterSolution(bool bByDamage, float inDamageDealt, float inResources, const FSGLinkSolution& inSolution)
+{
+	// Rank by the key, then by the other value
+	const float Key = bByDamage ? inDamageDealt : inResources;
+	const float SolutionKey = bByDamage ? inSolution.DamageDealt : inSolution.Resources;
+	if (Key != SolutionKey)
+	{
+		return Key > SolutionKey;
+	}
+	return (bByDamage ? inResources : inDamageDealt) > (bByDamage ? inSolution.Resources : inSolution.DamageDealt);
+}
+
+bool FSGLinkSolver::CheckBudget()
+{
+	if (Settings.MaxNodeNum > 0 && VisitedNodeNum >= Settings.MaxNodeNum)
+	{
+		bBudgetExceeded = true;
+	}
+	else if (CancelFlag != nullptr && *CancelFlag == true)
+	{
+		bBudgetExceeded = true;
+	}
+	else if ((VisitedNodeNum % SolverClockInterval) == 0 && FPlatformTime::Seconds() >= DeadlineSeconds)
+	{
+		bBudgetExceeded = true;
+	}
+	return bBudgetExceeded;
+}
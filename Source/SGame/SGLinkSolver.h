@@ -0,0 +1,201 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SGame.h"
+#include "SGBoardSimulation.h"
+
+/** One legal link line found by the solver */
+struct FSGLinkSolution
+{
+	/** The link line grid addresses, in the link order */
+	TArray<int32> LinkAddresses;
+
+	/** The linked tiles */
+	FSGBoardMask LinkMask;
+
+	/** Life and armor taken from the linked enemy tiles */
+	float DamageDealt;
+
+	/** Resources of the collected tiles, including the killed enemy tiles */
+	float Resources;
+
+	/** How many linked enemy tiles are killed */
+	int32 KilledNum;
+};
+
+/** Limits of one solve */
+struct FSGLinkSolverSettings
+{
+	/** Shorter paths are not legal links */
+	int32 MinLinkLength;
+
+	/** How many solutions to keep in each ranking */
+	int32 TopK;
+
+	/** The search stops after this time, the best solutions found so far are kept */
+	double TimeBudgetSeconds;
+
+	/** The search stops after visiting this many paths, 0 means no limit */
+	int32 MaxNodeNum;
+
+	/** Only the paths linking at least one of these tiles are searched, 0 means every path */
+	FSGBoardMask RequiredMask;
+
+	FSGLinkSolverSettings()
+		: MinLinkLength(3)
+		, TopK(3)
+		, TimeBudgetSeconds(0.002)
+		, MaxNodeNum(0)
+		, RequiredMask(0)
+	{
+	}
+};
+
+/**
+ * Enumerates the legal link paths on the board, and keeps the top K paths by damage dealt and by resources collected.
+ * The paths are searched depth first over the 8 neighbor link graph with a bitboard visited set, the damage and
+ * resources follow the same rules as FSGBoardSimulation::EvaluateLink. A branch is pruned when the tiles it can
+ * still reach cannot beat the K-th solution of both rankings.
+ */
+class SGAME_API FSGLinkSolver
+{
+public:
+	FSGLinkSolver();
+
+	/**
+	* Search the board
+	*
+	* @return true if every path is searched, false if the time or node budget ran out
+	*/
+	bool Solve(const FSGBoardSimulation& inSimulation, const FSGLinkSolverSettings& inSettings);
+
+	/** Prepare a search on the board, the rankings are cleared. The board should not change until the search ends */
+	void BeginSearch(const FSGBoardSimulation& inSimulation, const FSGLinkSolverSettings& inSettings);
+
+	/**
+	* Search every path starting with the prefix, the rankings keep the results of the previous searches
+	*
+	* @param inPrefixAddresses a legal link path to start with
+	*/
+	void SearchPrefix(const TArray<int32>& inPrefixAddresses);
+
+	/** Clear the rankings, the prepared board is kept */
+	void ResetRankings();
+
+	/** Put the solutions into the rankings in order, a solution only replaces a strictly worse one */
+	void MergeRankings(const TArray<FSGLinkSolution>& inBestByDamage, const TArray<FSGLinkSolution>& inBestByResources);
+
+	/** The search stops as soon as the flag is set, it can be set from any thread */
+	void SetCancelFlag(const FThreadSafeBool* inCancelFlag) { CancelFlag = inCancelFlag; }
+
+	/** Best paths by damage dealt, only the paths dealing damage, the best first */
+	const TArray<FSGLinkSolution>& GetBestByDamage() const { return BestByDamage; }
+
+	/** Best paths by resources collected, the best first */
+	const TArray<FSGLinkSolution>& GetBestByResources() const { return BestByResources; }
+
+	/** How many paths are visited by the last solve */
+	int32 GetVisitedNodeNum() const { return VisitedNodeNum; }
+
+	/** How many branches are pruned by the last solve */
+	int32 GetPrunedNodeNum() const { return PrunedNodeNum; }
+
+	/** Whether the last solve stopped by the budget */
+	bool IsBudgetExceeded() const { return bBudgetExceeded; }
+
+	/** Whether a solution with the values ranks before the solution, by the key of the ranking and then by the other value */
+	static bool IsBetterSolution(bool bByDamage, float inDamageDealt, float inResources, const FSGLinkSolution& inSolution);
+
+private:
+	/** The totals of the current path, copied down the search so a backtrack restores them */
+	struct FPathState
+	{
+		FPathState()
+			: VisitedMask(0)
+			, EnemyMask(0)
+			, KilledMask(0)
+			, CollectedResources(0)
+			, DamageDealt(0)
+			, KilledResources(0)
+			, KilledNum(0)
+		{}
+
+		FSGBoardMask VisitedMask;
+
+		/** The linked enemies, and the ones killed by the damage infos of the path so far */
+		FSGBoardMask EnemyMask;
+		FSGBoardMask KilledMask;
+
+		/** Resources of the linked tiles which are not enemies */
+		float CollectedResources;
+
+		/** Damage dealt to the linked enemies, and the resources of the killed ones */
+		float DamageDealt;
+		float KilledResources;
+		int32 KilledNum;
+	};
+
+	/** The life and armor of an enemy before a damage info of the path is applied to it */
+	struct FEnemyUndo
+	{
+		int32 GridAddress;
+		FTileLifeArmorInfo LifeArmorInfo;
+	};
+
+	/** Visit the current path and extend it from its last address */
+	void Search(const FPathState& inState);
+
+	/** Link the address to the path, a new enemy takes the damage infos of the path, a new damage info goes to the living linked enemies */
+	void ExtendPath(int32 inGridAddress, FPathState& inOutState);
+
+	/** Unlink the last address, the damage infos and the enemy states are restored to the saved sizes */
+	void RetractPath(int32 inDamageInfoNum, int32 inEnemyUndoNum);
+
+	/** Apply the damage info to the linked enemy and update the totals */
+	void DamageEnemy(int32 inEnemyAddress, const FTileDamageInfo& inDamageInfo, FPathState& inOutState);
+
+	/** Whether the tiles still reachable from the path cannot improve any ranking, or miss the required tiles */
+	bool CanPrune(const FPathState& inState) const;
+
+	/** Every tile the path may still reach, ignoring that the path cannot cross itself, so it is an upper bound */
+	FSGBoardMask GetReachMask(FSGBoardMask inVisitedMask) const;
+
+	/** Try to put the path into the ranking */
+	void OfferSolution(TArray<FSGLinkSolution>& inOutRanking, bool bByDamage, const TArray<int32>& inLinkAddresses, FSGBoardMask inLinkMask, float inDamageDealt, float inResources, int32 inKilledNum);
+
+	/** Whether the time or node budget ran out, the clock is only read every few nodes */
+	bool CheckBudget();
+
+	/** The board of the current solve */
+	const FSGBoardSimulation* Simulation;
+	FSGLinkSolverSettings Settings;
+
+	/** Precomputed per address tile rules of the current board */
+	FSGBoardMask TakeDamageMask;
+	FSGBoardMask CauseDamageMask;
+	float TileResources[FSGBoardModel::MaxGridCells];
+	float TileLifeArmor[FSGBoardModel::MaxGridCells];
+
+	/** The current path and the damage infos of its damage causing tiles */
+	TArray<int32> PathAddresses;
+	TArray<FTileDamageInfo> PathDamageInfos;
+
+	/** The life and armor of the linked enemies after the damage infos of the current path */
+	FTileLifeArmorInfo EnemyLifeArmor[FSGBoardModel::MaxGridCells];
+	TArray<FEnemyUndo> EnemyUndoStack;
+
+	/** The one address prefix of each start in a solve */
+	TArray<int32> StartAddresses;
+
+	TArray<FSGLinkSolution> BestByDamage;
+	TArray<FSGLinkSolution> BestByResources;
+
+	/** Optional cancel flag owned by the caller */
+	const FThreadSafeBool* CancelFlag;
+
+	double DeadlineSeconds;
+	int32 VisitedNodeNum;
+	int32 PrunedNodeNum;
+	bool bBudgetExceeded;
+};
@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGame.h"
+#include "SGMessageQueue.h"
+
+DEFINE_STAT(STAT_SGMessageAllocations);
+DEFINE_STAT(STAT_SGMessageDeliveries);
+
+FSGMessageQueue::FSGMessageQueue()
+	: AllocationNum(0)
+	, FrameNumber(0)
+	, FrameAllocationNum(0)
+{
+}
+
+FSGMessageQueue& FSGMessageQueue::Get()
+{
+	static FSGMessageQueue MessageQueue;
+	return MessageQueue;
+}
+
+void FSGMessageQueue::ProcessMessages()
+{
+	checkSlow(IsInGameThread());
+
+	// The handlers may publish new messages, keep delivering until the queue is empty
+	while (PendingMessages.Num() > 0)
+	{
+		Exchange(PendingMessages, DeliveringMessages);
+		for (const FQueuedMessage& QueuedMessage : DeliveringMessages)
+		{
+			INC_DWORD_STAT(STAT_SGMessageDeliveries);
+			QueuedMessage.Deliver(QueuedMessage.Message);
+			QueuedMessage.Recycle(QueuedMessage.Message);
+		}
+		DeliveringMessages.Reset();
+	}
+}
+
+void FSGMessageQueue::DiscardMessages()
+{
+	for (const FQueuedMessage& QueuedMessage : PendingMessages)
+	{
+		QueuedMessage.Recycle(QueuedMessage.Message);
+	}
+	PendingMessages.Reset();
+}
+
+void FSGMessageQueue::CountAllocation()
+{
+	INC_DWORD_STAT(STAT_SGMessageAllocations);
+	AllocationNum++;
+
+	if (FrameNumber != GFrameCounter)
+	{
+		// New frame, restart the counter
+		FrameNumber = GFrameCounter;
+		FrameAllocationNum = 0;
+	}
+	FrameAllocationNum++;
+}
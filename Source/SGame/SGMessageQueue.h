@@ -0,0 +1,145 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SGame.h"
+#include "SGameMessages.h"
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Message Allocations"), STAT_SGMessageAllocations, STATGROUP_SGame, SGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Message Deliveries"), STAT_SGMessageDeliveries, STATGROUP_SGame, SGAME_API);
+
+/**
+ * Handlers and recycled messages of one message type
+ */
+template<typename MessageType>
+struct TSGMessageChannel
+{
+	typedef TMulticastDelegate<void, const MessageType&> FHandlers;
+
+	/** Subscribed handlers */
+	FHandlers Handlers;
+
+	/** Delivered messages waiting for reuse */
+	TArray<MessageType*> FreeMessages;
+
+	~TSGMessageChannel()
+	{
+		for (MessageType* Message : FreeMessages)
+		{
+			delete Message;
+		}
+	}
+
+	/** The single channel of the message type */
+	static TSGMessageChannel& Get()
+	{
+		static TSGMessageChannel Channel;
+		return Channel;
+	}
+
+	/** Broadcast the message to the handlers */
+	static void Deliver(void* inMessage)
+	{
+		Get().Handlers.Broadcast(*static_cast<const MessageType*>(inMessage));
+	}
+
+	/** Put the message back to the free list */
+	static void Recycle(void* inMessage)
+	{
+		Get().FreeMessages.Push(static_cast<MessageType*>(inMessage));
+	}
+};
+
+/**
+ * Gameplay message queue of the game thread.
+ * The messages are taken from a free list per message type, and recycled after they are delivered,
+ * so the steady state publishing does not allocate. The UE message bus takes the ownership of the
+ * published message and frees it, that's why the gameplay messages don't go through the bus.
+ */
+class SGAME_API FSGMessageQueue
+{
+public:
+	FSGMessageQueue();
+
+	/** The gameplay message queue */
+	static FSGMessageQueue& Get();
+
+	/**
+	* Take a message from the pool and queue it, the message is delivered when the queue is processed.
+	* A recycled message keeps its old content (and the array capacity), the publisher should set every member
+	*
+	* @return the message to fill
+	*/
+	template<typename MessageType>
+	MessageType& Publish()
+	{
+		checkSlow(IsInGameThread());
+
+		TSGMessageChannel<MessageType>& Channel = TSGMessageChannel<MessageType>::Get();
+		MessageType* Message = nullptr;
+		if (Channel.FreeMessages.Num() > 0)
+		{
+			Message = Channel.FreeMessages.Pop(false);
+		}
+		else
+		{
+			Message = new MessageType();
+			CountAllocation();
+		}
+
+		FQueuedMessage& QueuedMessage = PendingMessages[PendingMessages.AddUninitialized()];
+		QueuedMessage.Message = Message;
+		QueuedMessage.Deliver = &TSGMessageChannel<MessageType>::Deliver;
+		QueuedMessage.Recycle = &TSGMessageChannel<MessageType>::Recycle;
+		return *Message;
+	}
+
+	/** Subscribe the message, the handler is bound weakly, a destroyed object will not receive the message */
+	template<typename MessageType, typename UserClass>
+	FDelegateHandle Subscribe(UserClass* inObject, void (UserClass::*inHandler)(const MessageType&))
+	{
+		return TSGMessageChannel<MessageType>::Get().Handlers.AddUObject(inObject, inHandler);
+	}
+
+	/** Unsubscribe all the handlers of the object on the message */
+	template<typename MessageType>
+	void Unsubscribe(const void* inObject)
+	{
+		TSGMessageChannel<MessageType>::Get().Handlers.RemoveAll(inObject);
+	}
+
+	/** Deliver all the queued messages, include the messages published by the handlers */
+	void ProcessMessages();
+
+	/** Recycle all the queued messages without delivering, e.g. the level ends */
+	void DiscardMessages();
+
+	/** How many messages are allocated since the start */
+	int32 GetAllocationNum() const { return AllocationNum; }
+
+	/** How many messages are allocated in this frame */
+	int32 GetFrameAllocationNum() const { return (FrameNumber == GFrameCounter) ? FrameAllocationNum : 0; }
+
+private:
+	/** Count one message allocation */
+	void CountAllocation();
+
+	/** Queued message with the type erased functions */
+	struct FQueuedMessage
+	{
+		void* Message;
+		void (*Deliver)(void*);
+		void (*Recycle)(void*);
+	};
+
+	/** Messages waiting for delivery, in the publish order */
+	TArray<FQueuedMessage> PendingMessages;
+
+	/** Messages being delivered, swapped with the pending messages to keep the capacity */
+	TArray<FQueuedMessage> DeliveringMessages;
+
+	/** Allocation counters */
+	int32 AllocationNum;
+	uint64 FrameNumber;
+	int32 FrameAllocationNum;
+};
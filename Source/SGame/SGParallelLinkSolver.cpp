@@ -0,0 +1,136 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGame.h"
+#include "SGParallelLinkSolver.h"
+
+FSGParallelLinkSolver::FSGParallelLinkSolver()
+	: FrontierDepth(2)
+	, bCancelled(false)
+	, CancelFlag(&bCancelled)
+	, VisitedNodeNum(0)
+{
+}
+
+bool FSGParallelLinkSolver::Solve(const FSGBoardSimulation& inSimulation, const FSGLinkSolverSettings& inSettings, int32 inWorkerNum)
+{
+	MergeSolver.BeginSearch(inSimulation, inSettings);
+	VisitedNodeNum = 0;
+
+	// Shorter paths are never scored, so cutting above the min link length loses nothing
+	BuildFrontier(inSimulation, FMath::Clamp(FrontierDepth, 1, FMath::Max(inSettings.MinLinkLength, 1)));
+
+	FrontierResults.Reset();
+	FrontierResults.SetNum(FrontierPrefixes.Num());
+	for (FFrontierResult& Result : FrontierResults)
+	{
+		Result.VisitedNodeNum = 0;
+		Result.bFinished = false;
+	}
+	NextFrontierIndex.Reset();
+
+	const double DeadlineSeconds = FPlatformTime::Seconds() + inSettings.TimeBudgetSeconds;
+	const int32 WorkerNum = FMath::Min((inWorkerNum > 0) ? inWorkerNum : FTaskGraphInterface::Get().GetNumWorkerThreads() + 1, FMath::Max(FrontierPrefixes.Num(), 1));
+
+	// The calling thread is one of the workers
+	FGraphEventArray WorkerTasks;
+	for (int32 i = 1; i < WorkerNum; i++)
+	{
+		WorkerTasks.Add(FFunctionGraphTask::CreateAndDispatchWhenReady([this, &inSimulation, &inSettings, DeadlineSeconds]()
+		{
+			RunWorker(inSimulation, inSettings, DeadlineSeconds);
+		}, TStatId(), nullptr, ENamedThreads::AnyThread));
+	}
+	RunWorker(inSimulation, inSettings, DeadlineSeconds);
+	FTaskGraphInterface::Get().WaitUntilTasksComplete(WorkerTasks);
+
+	// Merge in the item order, the rankings only change for a strictly better solution so the earlier item wins a tie
+	bool bAllFinished = true;
+	for (const FFrontierResult& Result : FrontierResults)
+	{
+		MergeSolver.MergeRankings(Result.BestByDamage, Result.BestByResources);
+		VisitedNodeNum += Result.VisitedNodeNum;
+		bAllFinished &= Result.bFinished;
+	}
+	return bAllFinished;
+}
+
+void FSGParallelLinkSolver::BuildFrontier(const FSGBoardSimulation& inSimulation, int32 inDepth)
+{
+	FrontierPrefixes.Reset();
+
+	const FSGBoardModel& BoardModel = inSimulation.GetBoardModel();
+	TArray<int32> PathAddresses;
+	TArray<FSGBoardMask> NextMasks;
+
+	FSGBoardMask StartMask = BoardModel.GetLinkableMask(-1);
+	while (StartMask != 0)
+	{
+		const int32 StartAddress = FSGBoardModel::PopLowestAddress(StartMask);
+		PathAddresses.Reset();
+		NextMasks.Reset();
+		PathAddresses.Add(StartAddress);
+		NextMasks.Add(BoardModel.GetLinkableMask(StartAddress) & ~FSGBoardModel::AddressToMask(StartAddress));
+
+		// Iterative depth first walk, the next masks stack holds the untried neighbors of each path tile
+		while (PathAddresses.Num() > 0)
+		{
+			if (PathAddresses.Num() == inDepth)
+			{
+				FrontierPrefixes.Add(PathAddresses);
+				PathAddresses.Pop(false);
+				NextMasks.Pop(false);
+				continue;
+			}
+
+			FSGBoardMask& NextMask = NextMasks.Last();
+			if (NextMask == 0)
+			{
+				PathAddresses.Pop(false);
+				NextMasks.Pop(false);
+				continue;
+			}
+
+			const int32 NextAddress = FSGBoardModel::PopLowestAddress(NextMask);
+			FSGBoardMask VisitedMask = 0;
+			for (int32 GridAddress : PathAddresses)
+			{
+				VisitedMask |= FSGBoardModel::AddressToMask(GridAddress);
+			}
+			PathAddresses.Add(NextAddress);
+			NextMasks.Add(BoardModel.GetLinkableMask(NextAddress) & ~VisitedMask & ~FSGBoardModel::AddressToMask(NextAddress));
+		}
+	}
+}
+
+void FSGParallelLinkSolver::RunWorker(const FSGBoardSimulation& inSimulation, const FSGLinkSolverSettings& inSettings, double inDeadlineSeconds)
+{
+	// Thread local solver, nothing is shared with the other workers but the item counter
+	FSGLinkSolver Solver;
+	Solver.SetCancelFlag(CancelFlag);
+
+	FSGLinkSolverSettings ItemSettings = inSettings;
+	for (;;)
+	{
+		const int32 FrontierIndex = NextFrontierIndex.Increment() - 1;
+		if (FrontierIndex >= FrontierPrefixes.Num() || IsCancelled() == true)
+		{
+			break;
+		}
+
+		// The time budget is shared by all the items
+		ItemSettings.TimeBudgetSeconds = inDeadlineSeconds - FPlatformTime::Seconds();
+		if (ItemSettings.TimeBudgetSeconds <= 0)
+		{
+			break;
+		}
+
+		Solver.BeginSearch(inSimulation, ItemSettings);
+		Solver.SearchPrefix(FrontierPrefixes[FrontierIndex]);
+
+		FFrontierResult& Result = FrontierResults[FrontierIndex];
+		Result.BestByDamage = Solver.GetBestByDamage();
+		Result.BestByResources = Solver.GetBestByResources();
+		Result.VisitedNodeNum = Solver.GetVisitedNodeNum();
+		Result.bFinished = (Solver.IsBudgetExceeded() == false);
+	}
+}
@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SGame.h"
+#include "SGLinkSolver.h"
+
+/**
+ * The link solver split over the task graph workers.
+ * The paths are cut at the frontier depth, every frontier prefix is one work item. The workers take
+ * the next item from a shared counter, so a worker with cheap items takes more of them, and search
+ * the item with their own solver, visited masks and bounds. The results of each item are merged in
+ * the item order on the calling thread, so the rankings never depend on the thread num or scheduling.
+ * The bitboard holds at most 64 cells, so boards up to 8x8 can be solved.
+ */
+class SGAME_API FSGParallelLinkSolver
+{
+public:
+	FSGParallelLinkSolver();
+
+	/**
+	* Search the board on the workers, the calling thread works too and returns when all the items are done
+	*
+	* @param inSimulation	the board, should not change until the solve returns
+	* @param inSettings		the solve settings, the node budget applies to each frontier item
+	* @param inWorkerNum	how many threads search, including the calling thread. 0 means every task graph worker
+	*
+	* @return true if every path is searched, false if cancelled or out of budget
+	*/
+	bool Solve(const FSGBoardSimulation& inSimulation, const FSGLinkSolverSettings& inSettings, int32 inWorkerNum = 0);
+
+	/**
+	* Stop the running solve as soon as possible, can be called from any thread. The rankings keep the finished items.
+	* The flag stays set until ResetCancel, so a cancel coming before the solve starts is not lost
+	*/
+	void Cancel() { bCancelled = true; }
+
+	/** Clear the cancel, by the owner before it starts the next solve */
+	void ResetCancel() { bCancelled = false; }
+
+	/** Read the caller's cancel flag instead of the own one, it can be set from any thread. nullptr goes back to the own flag */
+	void SetCancelFlag(const FThreadSafeBool* inCancelFlag) { CancelFlag = (inCancelFlag != nullptr) ? inCancelFlag : &bCancelled; }
+
+	bool IsCancelled() const { return *CancelFlag == true; }
+
+	/** Best paths by damage dealt, the best first */
+	const TArray<FSGLinkSolution>& GetBestByDamage() const { return MergeSolver.GetBestByDamage(); }
+
+	/** Best paths by resources collected, the best first */
+	const TArray<FSGLinkSolution>& GetBestByResources() const { return MergeSolver.GetBestByResources(); }
+
+	/** How many paths are visited by the last solve, over all the workers */
+	int32 GetVisitedNodeNum() const { return VisitedNodeNum; }
+
+	/** How many work items the last solve had */
+	int32 GetFrontierNum() const { return FrontierPrefixes.Num(); }
+
+	/** The path length where the search is cut into work items, capped by the min link length */
+	int32 FrontierDepth;
+
+private:
+	/** Result of one work item */
+	struct FFrontierResult
+	{
+		TArray<FSGLinkSolution> BestByDamage;
+		TArray<FSGLinkSolution> BestByResources;
+		int32 VisitedNodeNum;
+		bool bFinished;
+	};
+
+	/** Collect every legal path of the depth as a work item, in the address order */
+	void BuildFrontier(const FSGBoardSimulation& inSimulation, int32 inDepth);
+
+	/** Take and search the work items until none is left */
+	void RunWorker(const FSGBoardSimulation& inSimulation, const FSGLinkSolverSettings& inSettings, double inDeadlineSeconds);
+
+	TArray<TArray<int32>> FrontierPrefixes;
+	TArray<FFrontierResult> FrontierResults;
+
+	/** Index of the next work item to take */
+	FThreadSafeCounter NextFrontierIndex;
+
+	FThreadSafeBool bCancelled;
+
+	/** The flag the workers stop by, the own flag unless the caller set one */
+	const FThreadSafeBool* CancelFlag;
+
+	/** Holds the merged rankings */
+	FSGLinkSolver MergeSolver;
+
+	int32 VisitedNodeNum;
+};
@@ -4,15 +4,21 @@
 #include "SGPlayerController.h"
 #include "SGGameMode.h"
 #include "SGCheatManager.h"
+#include "SGMessageQueue.h"
 
 ASGPlayerController::ASGPlayerController(const FObjectInitializer& ObjectInitializer)
 {
 	// We want the mouse cursor to show immediately on startup, without having to click in the window.
 	bShowMouseCursor = true;
 
-	// We need click/touch events to interact with our tiles.
-	bEnableTouchEvents = bEnableClickEvents = true;
-	bEnableTouchOverEvents = bEnableMouseOverEvents = true;
+	// The tiles are hit tested on the grid plane, no click/touch event or cursor trace is needed
+	bEnableTouchEvents = bEnableClickEvents = false;
+	bEnableTouchOverEvents = bEnableMouseOverEvents = false;
+
+	InputGrid = nullptr;
+	bPointerPressed = false;
+	LastPointerCoords = FIntPoint::NoneValue;
+	LastDragTile = nullptr;
 
 	// Cheat manager allow us to do some fast debugging
 	CheatClass = USGCheatManager::StaticClass();
@@ -20,13 +26,25 @@ ASGPlayerController::ASGPlayerController(const FObjectInitializer& ObjectInitial
 
 void ASGPlayerController::BeginPlay()
 {
-	MessageEndpoint = FMessageEndpoint::Builder("Gameplay_PC")
-		.Handling<FMessage_Gameplay_PlayerBeginInput>(this, &ASGPlayerController::HandlePlayerBeginInput);
-	
-	if (MessageEndpoint.IsValid() == true)
+	// Subscribe the begin input event to allow the player input
+	FSGMessageQueue::Get().Subscribe(this, &ASGPlayerController::HandlePlayerBeginInput);
+
+	// Find the grid actor in the world
+	InputGrid = nullptr;
+	for (TActorIterator<ASGGrid> It(GetWorld()); It; ++It)
+	{
+		if (InputGrid == nullptr)
+		{
+			InputGrid = *It;
+		}
+		else
+		{
+			UE_LOG(LogSGame, Warning, TEXT("There is more than more grid object in the level!"));
+		}
+	}
+	if (InputGrid == nullptr)
 	{
-		// Subscribe the begin input event to allow the player input
-		MessageEndpoint->Subscribe<FMessage_Gameplay_PlayerBeginInput>();
+		UE_LOG(LogSGame, Warning, TEXT("There is no grid object in the level!"));
 	}
 
 	for (FString SkillName : SkillNamesArray)
@@ -45,7 +63,98 @@ void ASGPlayerController::BeginPlay()
 	}
 }
 
-void ASGPlayerController::HandlePlayerBeginInput(const FMessage_Gameplay_PlayerBeginInput& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGPlayerController::HandlePlayerBeginInput(const FMessage_Gameplay_PlayerBeginInput& Message)
 {
 	UE_LOG(LogSGame, Log, TEXT("Player begin input"));
 }
+
+void ASGPlayerController::PlayerTick(float DeltaTime)
+{
+	Super::PlayerTick(DeltaTime);
+
+	if (InputGrid == nullptr)
+	{
+		return;
+	}
+
+	FVector2D ScreenPosition;
+	if (GetPressedPointerPosition(ScreenPosition) == false)
+	{
+		// The drag ends, release on the last tile it went over
+		if (bPointerPressed == true && LastDragTile != nullptr)
+		{
+			LastDragTile->TileRelease(ETouchIndex::Touch1, LastDragTile);
+		}
+		bPointerPressed = false;
+		LastDragTile = nullptr;
+		return;
+	}
+
+	FVector RayOrigin, RayDirection;
+	FIntPoint PointerCoords;
+	if (DeprojectScreenPositionToWorld(ScreenPosition.X, ScreenPosition.Y, RayOrigin, RayDirection) == false ||
+		InputGrid->GetGridCoordsFromRay(RayOrigin, RayDirection, PointerCoords) == false)
+	{
+		return;
+	}
+
+	if (bPointerPressed == false)
+	{
+		// New press, only the cell under the pointer is picked
+		bPointerPressed = true;
+		LastPointerCoords = PointerCoords;
+
+		const int32 GridAddress = InputGrid->GridCoordsToGridAddress(PointerCoords);
+		ASGTileBase* PressedTile = (GridAddress != -1) ? InputGrid->GetTileFromGridAddress(GridAddress) : nullptr;
+		if (PressedTile != nullptr)
+		{
+			PressedTile->TilePress(ETouchIndex::Touch1, PressedTile);
+			LastDragTile = PressedTile;
+		}
+		return;
+	}
+
+	if (PointerCoords == LastPointerCoords)
+	{
+		return;
+	}
+
+	// The pointer may cross several cells between two samples, enter every one of them in order
+	CrossedGridAddresses.Reset();
+	InputGrid->RasterizeGridSegment(LastPointerCoords, PointerCoords, CrossedGridAddresses);
+	LastPointerCoords = PointerCoords;
+	for (int32 GridAddress : CrossedGridAddresses)
+	{
+		EnterGridAddress(GridAddress);
+	}
+}
+
+bool ASGPlayerController::GetPressedPointerPosition(FVector2D& outScreenPosition) const
+{
+	bool bTouchPressed = false;
+	GetInputTouchState(ETouchIndex::Touch1, outScreenPosition.X, outScreenPosition.Y, bTouchPressed);
+	if (bTouchPressed == true)
+	{
+		return true;
+	}
+
+	// The mouse with the left button down simulates the finger swiping
+	if (IsInputKeyDown(EKeys::LeftMouseButton) == true)
+	{
+		return GetMousePosition(outScreenPosition.X, outScreenPosition.Y);
+	}
+	return false;
+}
+
+void ASGPlayerController::EnterGridAddress(int32 inGridAddress)
+{
+	checkSlow(InputGrid != nullptr);
+
+	// The tile can be missing while the grid refills
+	ASGTileBase* EnteredTile = InputGrid->GetTileFromGridAddress(inGridAddress);
+	if (EnteredTile != nullptr)
+	{
+		EnteredTile->TileEnter(ETouchIndex::Touch1, EnteredTile);
+		LastDragTile = EnteredTile;
+	}
+}
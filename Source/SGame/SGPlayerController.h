@@ -3,11 +3,10 @@
 #pragma once
 
 #include "GameFramework/PlayerController.h"
-#include "MessageEndpoint.h"
-#include "MessageEndpointBuilder.h"
 #include "SGameMessages.h"
 #include "SGSkillBase.h"
 #include "SGPlayerSkillManager.h"
+#include "SGGrid.h"
 
 #include "SGPlayerController.generated.h"
 
@@ -24,6 +23,9 @@ public:
 	/** Event when play begins for this actor. */
 	virtual void BeginPlay() override;
 
+	/** Sample the pointer and feed the cells it crossed to the link path */
+	virtual void PlayerTick(float DeltaTime) override;
+
 	/** Player's current skill instance*/
 	UPROPERTY(BlueprintReadOnly, Category = "Skill")
 	TArray<ASGSkillBase*> SkillsArray;
@@ -36,8 +38,30 @@ protected:
 
 private:
 	/** Player can input now*/
-	void HandlePlayerBeginInput(const FMessage_Gameplay_PlayerBeginInput& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandlePlayerBeginInput(const FMessage_Gameplay_PlayerBeginInput& Message);
+
+	/**
+	* Get the pointer screen position, the first touch or the mouse with the left button down
+	*
+	* @return false if the pointer is not pressed
+	*/
+	bool GetPressedPointerPosition(FVector2D& outScreenPosition) const;
+
+	/** Tell the tile on the grid address it is entered by the drag */
+	void EnterGridAddress(int32 inGridAddress);
+
+	/** The grid hit tested by the pointer */
+	ASGGrid* InputGrid;
+
+	/** The pointer was pressed on the last sample */
+	bool bPointerPressed;
+
+	/** The grid coordinates of the last sample, can be out of the grid */
+	FIntPoint LastPointerCoords;
+
+	/** The last tile the drag went over, it receives the release */
+	ASGTileBase* LastDragTile;
 
-	// Holds the messaging endpoint.
-	TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> MessageEndpoint;
+	/** The cells crossed since the last sample */
+	TArray<int32> CrossedGridAddresses;
 };
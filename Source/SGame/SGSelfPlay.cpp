@@ -0,0 +1,214 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGame.h"
+#include "SGSelfPlay.h"
+#include "SGBotPolicy.h"
+#include "Async/ParallelFor.h"
+
+void FSGSelfPlayStats::AddRound(const FSGSelfPlayRound& inRound)
+{
+	ConfigIndex.Add(inRound.ConfigIndex);
+	GameIndex.Add(inRound.GameIndex);
+	RoundIndex.Add(inRound.RoundIndex);
+	LinkLength.Add(inRound.LinkLength);
+	DamagedNum.Add(inRound.DamagedNum);
+	KilledNum.Add(inRound.KilledNum);
+	CollectedNum.Add(inRound.CollectedNum);
+	EnemyNum.Add(inRound.EnemyNum);
+	for (int32 i = 0; i < SGResourceTypeNum; i++)
+	{
+		Resources[i].Add(inRound.Resources[i]);
+	}
+	EnemyShieldDamage.Add(inRound.EnemyShieldDamage);
+	EnemyDirectDamage.Add(inRound.EnemyDirectDamage);
+	PlayerHP.Add(inRound.PlayerHP);
+	PlayerArmor.Add(inRound.PlayerArmor);
+	for (int32 i = 0; i < FSGBoardModel::MaxTileTypes; i++)
+	{
+		TypeMasks[i].Add(inRound.TypeMasks[i]);
+	}
+	EnemyMask.Add(inRound.EnemyMask);
+}
+
+void FSGSelfPlayStats::Append(const FSGSelfPlayStats& inOther)
+{
+	ConfigIndex.Append(inOther.ConfigIndex);
+	GameIndex.Append(inOther.GameIndex);
+	RoundIndex.Append(inOther.RoundIndex);
+	LinkLength.Append(inOther.LinkLength);
+	DamagedNum.Append(inOther.DamagedNum);
+	KilledNum.Append(inOther.KilledNum);
+	CollectedNum.Append(inOther.CollectedNum);
+	EnemyNum.Append(inOther.EnemyNum);
+	for (int32 i = 0; i < SGResourceTypeNum; i++)
+	{
+		Resources[i].Append(inOther.Resources[i]);
+	}
+	EnemyShieldDamage.Append(inOther.EnemyShieldDamage);
+	EnemyDirectDamage.Append(inOther.EnemyDirectDamage);
+	PlayerHP.Append(inOther.PlayerHP);
+	PlayerArmor.Append(inOther.PlayerArmor);
+	for (int32 i = 0; i < FSGBoardModel::MaxTileTypes; i++)
+	{
+		TypeMasks[i].Append(inOther.TypeMasks[i]);
+	}
+	EnemyMask.Append(inOther.EnemyMask);
+}
+
+/** Write one column: the name, the element type and the values */
+template<typename ElementType>
+static void WriteStatsColumn(FArchive& Ar, const FString& inName, uint8 inElementType, const TArray<ElementType>& inColumn)
+{
+	FString Name = inName;
+	Ar << Name;
+	Ar << inElementType;
+	Ar.Serialize(const_cast<ElementType*>(inColumn.GetData()), inColumn.Num() * sizeof(ElementType));
+}
+
+bool FSGSelfPlayStats::SaveToFile(const FString& inFileName) const
+{
+	FBufferArchive Ar;
+
+	uint32 Magic = 0x4C4F4353;
+	int32 RowNum = Num();
+	int32 ColumnNum = 12 + SGResourceTypeNum + FSGBoardModel::MaxTileTypes + 1;
+	Ar << Magic;
+	Ar << RowNum;
+	Ar << ColumnNum;
+
+	WriteStatsColumn(Ar, TEXT("ConfigIndex"), 0, ConfigIndex);
+	WriteStatsColumn(Ar, TEXT("GameIndex"), 0, GameIndex);
+	WriteStatsColumn(Ar, TEXT("RoundIndex"), 0, RoundIndex);
+	WriteStatsColumn(Ar, TEXT("LinkLength"), 0, LinkLength);
+	WriteStatsColumn(Ar, TEXT("DamagedNum"), 0, DamagedNum);
+	WriteStatsColumn(Ar, TEXT("KilledNum"), 0, KilledNum);
+	WriteStatsColumn(Ar, TEXT("CollectedNum"), 0, CollectedNum);
+	WriteStatsColumn(Ar, TEXT("EnemyNum"), 0, EnemyNum);
+
+	const UEnum* ResourceEnum = FindObject<UEnum>(ANY_PACKAGE, TEXT("ESGResourceType"), true);
+	for (int32 i = 0; i < SGResourceTypeNum; i++)
+	{
+		const FString ResourceName = (ResourceEnum != nullptr) ? ResourceEnum->GetNameStringByIndex(i) : FString::Printf(TEXT("Resource%d"), i);
+		WriteStatsColumn(Ar, ResourceName, 1, Resources[i]);
+	}
+	WriteStatsColumn(Ar, TEXT("EnemyShieldDamage"), 1, EnemyShieldDamage);
+	WriteStatsColumn(Ar, TEXT("EnemyDirectDamage"), 1, EnemyDirectDamage);
+	WriteStatsColumn(Ar, TEXT("PlayerHP"), 1, PlayerHP);
+	WriteStatsColumn(Ar, TEXT("PlayerArmor"), 1, PlayerArmor);
+
+	for (int32 i = 0; i < FSGBoardModel::MaxTileTypes; i++)
+	{
+		WriteStatsColumn(Ar, FString::Printf(TEXT("TypeMask%d"), i), 2, TypeMasks[i]);
+	}
+	WriteStatsColumn(Ar, TEXT("EnemyMask"), 2, EnemyMask);
+
+	return FFileHelper::SaveArrayToFile(Ar, *inFileName);
+}
+
+int32 FSGSelfPlay::PlayGame(const FSGSelfPlayConfig& inConfig, int32 inGameIndex, FSGBotPolicy& inBot, FSGSelfPlayStats& outStats)
+{
+	FSGBoardSimulation Simulation;
+	if (Simulation.Initialize(inConfig.GridWidth, inConfig.GridHeight, inConfig.Seed + inGameIndex) == false)
+	{
+		return 0;
+	}
+	Simulation.SetArchetypes(inConfig.Archetypes);
+
+	// The bot has its own stream, derived from the game seed
+	FRandomStream BotRandomStream(Simulation.GetRandomStream().GetUnsignedInt());
+
+	TArray<FSGCellMove> CellMoves;
+	TArray<int32> LinkAddresses;
+	FSGLinkResult LinkResult;
+	FSGEnemyAttackResult AttackResult;
+
+	// Fill the empty board
+	Simulation.Refill(CellMoves);
+
+	float PlayerHP = inConfig.PlayerHPMax;
+	float PlayerArmor = inConfig.PlayerArmorMax;
+	const FSGBoardModel& BoardModel = Simulation.GetBoardModel();
+
+	int32 RoundIndex = 0;
+	for (; RoundIndex < inConfig.MaxRounds; RoundIndex++)
+	{
+		// Same spawn ramp as the game mode rounds
+		Simulation.SetSpawnRound(RoundIndex + 1);
+
+		// A dead board is shuffled like the grid does, the game ends if no layout can link
+		if (Simulation.GetBoardModel().HasLegalLink(inConfig.MinLinkLength) == false && Simulation.Shuffle(inConfig.MinLinkLength, CellMoves) == false)
+		{
+			break;
+		}
+
+		// Player input, the bot may still fail to find a link
+		if (inBot.ChooseLink(Simulation, inConfig.MinLinkLength, BotRandomStream, LinkAddresses) == false ||
+			Simulation.IsLinkValid(LinkAddresses, inConfig.MinLinkLength) == false)
+		{
+			break;
+		}
+
+		// Link, collect and refill
+		Simulation.EvaluateLink(LinkAddresses, LinkResult);
+		Simulation.ApplyLink(LinkResult);
+		Simulation.Refill(CellMoves);
+
+		PlayerHP = FMath::Clamp(PlayerHP + LinkResult.SumupResources[static_cast<int32>(ESGResourceType::ETR_HP)], 0.0f, inConfig.PlayerHPMax);
+		PlayerArmor = FMath::Clamp(PlayerArmor + LinkResult.SumupResources[static_cast<int32>(ESGResourceType::ETT_Armor)], 0.0f, inConfig.PlayerArmorMax);
+
+		// Enemy attack, same as the player pawn only the direct damage goes to the hp for now
+		Simulation.ResolveEnemies(AttackResult);
+		PlayerHP -= AttackResult.DamageDirectToHP;
+
+		FSGSelfPlayRound Round;
+		Round.ConfigIndex = inConfig.ConfigIndex;
+		Round.GameIndex = inGameIndex;
+		Round.RoundIndex = RoundIndex;
+		Round.LinkLength = LinkAddresses.Num();
+		Round.DamagedNum = LinkResult.DamagedAddresses.Num();
+		Round.KilledNum = LinkResult.CollectedAddresses.Num() + LinkResult.DamagedAddresses.Num() - LinkAddresses.Num();
+		Round.CollectedNum = LinkResult.CollectedAddresses.Num();
+		Round.EnemyNum = AttackResult.EnemyNum;
+		FMemory::Memcpy(Round.Resources, LinkResult.SumupResources, sizeof(Round.Resources));
+		Round.EnemyShieldDamage = AttackResult.DamageCanBeShield;
+		Round.EnemyDirectDamage = AttackResult.DamageDirectToHP;
+		Round.PlayerHP = PlayerHP;
+		Round.PlayerArmor = PlayerArmor;
+		FMemory::Memcpy(Round.TypeMasks, BoardModel.TypeMasks, sizeof(Round.TypeMasks));
+		Round.EnemyMask = BoardModel.EnemyMask;
+		outStats.AddRound(Round);
+
+		if (PlayerHP <= 0)
+		{
+			RoundIndex++;
+			break;
+		}
+	}
+
+	return RoundIndex;
+}
+
+bool FSGSelfPlay::PlayGames(const FSGSelfPlayConfig& inConfig, FSGSelfPlayStats& outStats)
+{
+	if (FSGBotPolicy::Create(inConfig.BotName).IsValid() == false)
+	{
+		UE_LOG(LogSGame, Error, TEXT("Unknown bot policy %s"), *inConfig.BotName);
+		return false;
+	}
+
+	// Every game has its own stats, so the threads never share anything
+	TArray<FSGSelfPlayStats> GameStats;
+	GameStats.SetNum(inConfig.GameNum);
+	ParallelFor(inConfig.GameNum, [&inConfig, &GameStats](int32 GameIndex)
+	{
+		TUniquePtr<FSGBotPolicy> Bot = FSGBotPolicy::Create(inConfig.BotName);
+		PlayGame(inConfig, GameIndex, *Bot, GameStats[GameIndex]);
+	});
+
+	// Merge in the game order, the output does not depend on the scheduling
+	for (const FSGSelfPlayStats& Stats : GameStats)
+	{
+		outStats.Append(Stats);
+	}
+	return true;
+}
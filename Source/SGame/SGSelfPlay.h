@@ -0,0 +1,136 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SGame.h"
+#include "SGBoardSimulation.h"
+
+class FSGBotPolicy;
+
+/** One headless self play setup, all the games of the setup share it */
+struct FSGSelfPlayConfig
+{
+	/** Index of the config in a sweep, written to every round */
+	int32 ConfigIndex;
+
+	int32 GridWidth;
+	int32 GridHeight;
+
+	/** Same as ASGGameMode::MinimunLengthLinkLineRequired */
+	int32 MinLinkLength;
+
+	/** The game stops after this many rounds */
+	int32 MaxRounds;
+
+	/** How many games to play */
+	int32 GameNum;
+
+	/** Base seed, game N uses the seed plus N */
+	int32 Seed;
+
+	/** The player pawn hp max and armor max */
+	float PlayerHPMax;
+	float PlayerArmorMax;
+
+	/** The bot policy name, see FSGBotPolicy::Create */
+	FString BotName;
+
+	/** The tile archetypes, the tile library of the level */
+	TArray<FSGTileArchetype> Archetypes;
+
+	FSGSelfPlayConfig()
+		: ConfigIndex(0)
+		, GridWidth(6)
+		, GridHeight(6)
+		, MinLinkLength(3)
+		, MaxRounds(200)
+		, GameNum(100)
+		, Seed(1)
+		, PlayerHPMax(100)
+		, PlayerArmorMax(0)
+		, BotName(TEXT("greedy"))
+	{
+	}
+};
+
+/** Statistics of one played round */
+struct FSGSelfPlayRound
+{
+	int32 ConfigIndex;
+	int32 GameIndex;
+	int32 RoundIndex;
+	int32 LinkLength;
+	int32 DamagedNum;
+	int32 KilledNum;
+	int32 CollectedNum;
+	int32 EnemyNum;
+	float Resources[SGResourceTypeNum];
+	float EnemyShieldDamage;
+	float EnemyDirectDamage;
+	float PlayerHP;
+	float PlayerArmor;
+
+	/** Board state after the refill */
+	FSGBoardMask TypeMasks[FSGBoardModel::MaxTileTypes];
+	FSGBoardMask EnemyMask;
+};
+
+/**
+ * Per round statistics stored by column, one array per statistic.
+ * Saved as a columnar file: the magic, the row num and the column num, then every column
+ * with its name, its element type (0 int32, 1 float, 2 uint64) and all of its values.
+ */
+struct SGAME_API FSGSelfPlayStats
+{
+	TArray<int32> ConfigIndex;
+	TArray<int32> GameIndex;
+	TArray<int32> RoundIndex;
+	TArray<int32> LinkLength;
+	TArray<int32> DamagedNum;
+	TArray<int32> KilledNum;
+	TArray<int32> CollectedNum;
+	TArray<int32> EnemyNum;
+	TArray<float> Resources[SGResourceTypeNum];
+	TArray<float> EnemyShieldDamage;
+	TArray<float> EnemyDirectDamage;
+	TArray<float> PlayerHP;
+	TArray<float> PlayerArmor;
+	TArray<uint64> TypeMasks[FSGBoardModel::MaxTileTypes];
+	TArray<uint64> EnemyMask;
+
+	/** How many rounds are stored */
+	int32 Num() const { return RoundIndex.Num(); }
+
+	/** Add one round as a row */
+	void AddRound(const FSGSelfPlayRound& inRound);
+
+	/** Append all the rows of the other stats */
+	void Append(const FSGSelfPlayStats& inOther);
+
+	/** Save the columnar file */
+	bool SaveToFile(const FString& inFileName) const;
+};
+
+/** Plays the games of a config on the board simulation, without any world */
+class SGAME_API FSGSelfPlay
+{
+public:
+	/**
+	* Play one game until the player dies, the bot cannot link or the round limit
+	*
+	* @param inConfig		the game setup
+	* @param inGameIndex	the game index, decides the seed
+	* @param inBot			the player policy
+	* @param outStats		the round rows are added to it
+	*
+	* @return how many rounds are played
+	*/
+	static int32 PlayGame(const FSGSelfPlayConfig& inConfig, int32 inGameIndex, FSGBotPolicy& inBot, FSGSelfPlayStats& outStats);
+
+	/**
+	* Play all the games of the config on all the cores, the rows are in the game order whatever the thread num
+	*
+	* @return false if the bot name is unknown
+	*/
+	static bool PlayGames(const FSGSelfPlayConfig& inConfig, FSGSelfPlayStats& outStats);
+};
@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGame.h"
+#include "SGSelfPlayCommandlet.h"
+#include "SGSelfPlay.h"
+#include "SGLevelTileManager.h"
+
+USGSelfPlayCommandlet::USGSelfPlayCommandlet()
+{
+	// Only the board simulation runs, no world is needed
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 USGSelfPlayCommandlet::Main(const FString& Params)
+{
+	FSGSelfPlayConfig BaseConfig;
+	FString TileManagerPath = TEXT("/Game/Blueprints/LevelTileManager_1_1.LevelTileManager_1_1_C");
+	FString OutputFileName = FPaths::ProjectSavedDir() / TEXT("SelfPlay/SelfPlay.sgcol");
+	int32 ConfigNum = 1;
+	float Jitter = 0.2f;
+
+	FParse::Value(*Params, TEXT("TileManager="), TileManagerPath);
+	FParse::Value(*Params, TEXT("Bot="), BaseConfig.BotName);
+	FParse::Value(*Params, TEXT("Games="), BaseConfig.GameNum);
+	FParse::Value(*Params, TEXT("Rounds="), BaseConfig.MaxRounds);
+	FParse::Value(*Params, TEXT("Seed="), BaseConfig.Seed);
+	FParse::Value(*Params, TEXT("Width="), BaseConfig.GridWidth);
+	FParse::Value(*Params, TEXT("Height="), BaseConfig.GridHeight);
+	FParse::Value(*Params, TEXT("MinLink="), BaseConfig.MinLinkLength);
+	FParse::Value(*Params, TEXT("HP="), BaseConfig.PlayerHPMax);
+	FParse::Value(*Params, TEXT("Armor="), BaseConfig.PlayerArmorMax);
+	FParse::Value(*Params, TEXT("Configs="), ConfigNum);
+	FParse::Value(*Params, TEXT("Jitter="), Jitter);
+	FParse::Value(*Params, TEXT("Output="), OutputFileName);
+
+	// The tile library is the default of the level tile manager blueprint
+	UClass* TileManagerClass = LoadObject<UClass>(nullptr, *TileManagerPath);
+	if (TileManagerClass == nullptr || TileManagerClass->IsChildOf(ASGLevelTileManager::StaticClass()) == false)
+	{
+		UE_LOG(LogSGame, Error, TEXT("Cannot load the level tile manager class %s"), *TileManagerPath);
+		return 1;
+	}
+	TileManagerClass->GetDefaultObject<ASGLevelTileManager>()->BuildTileArchetypes(BaseConfig.Archetypes);
+	if (BaseConfig.Archetypes.Num() == 0)
+	{
+		UE_LOG(LogSGame, Error, TEXT("The tile library of %s is empty"), *TileManagerPath);
+		return 1;
+	}
+
+	FRandomStream ConfigRandomStream(BaseConfig.Seed);
+	FString ConfigTable = TEXT("ConfigIndex,ArchetypeID,Probability,InitialDamage\n");
+	FSGSelfPlayStats Stats;
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	for (int32 ConfigIndex = 0; ConfigIndex < ConfigNum; ConfigIndex++)
+	{
+		FSGSelfPlayConfig Config = BaseConfig;
+		Config.ConfigIndex = ConfigIndex;
+
+		// The first config is always the tile library itself
+		for (int32 ArchetypeID = 0; ArchetypeID < Config.Archetypes.Num(); ArchetypeID++)
+		{
+			FSGTileArchetype& Archetype = Config.Archetypes[ArchetypeID];
+			if (ConfigIndex > 0)
+			{
+				Archetype.Probability *= 1.0f + ConfigRandomStream.FRandRange(-Jitter, Jitter);
+				Archetype.CauseDamageInfo.InitialDamage *= 1.0f + ConfigRandomStream.FRandRange(-Jitter, Jitter);
+			}
+			ConfigTable += FString::Printf(TEXT("%d,%d,%f,%f\n"), ConfigIndex, ArchetypeID, Archetype.Probability, Archetype.CauseDamageInfo.InitialDamage);
+		}
+
+		if (FSGSelfPlay::PlayGames(Config, Stats) == false)
+		{
+			return 1;
+		}
+	}
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+	UE_LOG(LogSGame, Display, TEXT("Self play %d configs x %d games with %s bot: %d rounds in %.2f s, %.0f rounds per second"),
+		ConfigNum, BaseConfig.GameNum, *BaseConfig.BotName, Stats.Num(), ElapsedSeconds, Stats.Num() / FMath::Max(ElapsedSeconds, 0.000001));
+
+	if (Stats.SaveToFile(OutputFileName) == false)
+	{
+		UE_LOG(LogSGame, Error, TEXT("Cannot write the self play stats to %s"), *OutputFileName);
+		return 1;
+	}
+	UE_LOG(LogSGame, Display, TEXT("Self play stats are written to %s"), *OutputFileName);
+
+	if (ConfigNum > 1)
+	{
+		FFileHelper::SaveStringToFile(ConfigTable, *(OutputFileName + TEXT(".configs.csv")));
+	}
+	return 0;
+}
@@ -0,0 +1,27 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "SGSelfPlayCommandlet.generated.h"
+
+/**
+ * Plays the game headless with a bot policy, and writes the per round statistics to a columnar file.
+ *
+ * UE4Editor-Cmd SGame.uproject -run=SGSelfPlay [-TileManager=<class path>] [-Bot=random|greedy|search]
+ *     [-Games=100] [-Rounds=200] [-Seed=1] [-Width=6] [-Height=6] [-MinLink=3] [-HP=100] [-Armor=0]
+ *     [-Configs=1] [-Jitter=0.2] [-Output=<file>]
+ *
+ * With more than one config, each config scales the tile probability and damage of the tile
+ * library randomly within the jitter, the scaled values are written to <file>.configs.csv
+ */
+UCLASS()
+class SGAME_API USGSelfPlayCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USGSelfPlayCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
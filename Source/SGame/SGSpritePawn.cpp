@@ -3,6 +3,7 @@
 #include "SGame.h"
 #include "SGSpritePawn.h"
 #include "PaperSprite.h"
+#include "SGMessageQueue.h"
 
 // Sets default values
 ASGSpritePawn::ASGSpritePawn()
@@ -26,15 +27,9 @@ void ASGSpritePawn::BeginPlay()
 	CurrentHP = HPMax;
 	CurrentArmor = ArmorMax;
 	
-	MessageEndpoint = FMessageEndpoint::Builder("Gameplay_PlayerPawn")
-		.Handling<FMessage_Gameplay_PlayerTakeDamage>(this, &ASGSpritePawn::HandlePlayerTakeDamage)
-		.Handling<FMessage_Gameplay_ResourceCollect>(this, &ASGSpritePawn::HandleCollectResouce);
-	if (MessageEndpoint.IsValid() == true)
-	{
-		// Subscribe the grid needed messages
-		MessageEndpoint->Subscribe<FMessage_Gameplay_PlayerTakeDamage>();
-		MessageEndpoint->Subscribe<FMessage_Gameplay_ResourceCollect>();
-	}
+	// Subscribe the pawn needed messages
+	FSGMessageQueue::Get().Subscribe(this, &ASGSpritePawn::HandlePlayerTakeDamage);
+	FSGMessageQueue::Get().Subscribe(this, &ASGSpritePawn::HandleCollectResouce);
 }
 
 // Called every frame
@@ -43,7 +38,7 @@ void ASGSpritePawn::Tick( float DeltaTime )
 	Super::Tick( DeltaTime );
 }
 
-void ASGSpritePawn::HandlePlayerTakeDamage(const FMessage_Gameplay_PlayerTakeDamage& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGSpritePawn::HandlePlayerTakeDamage(const FMessage_Gameplay_PlayerTakeDamage& Message)
 {
 	// todo: Add armor damage calculation
 	CurrentHP = CurrentHP - Message.DirectDamage;
@@ -52,7 +47,7 @@ void ASGSpritePawn::HandlePlayerTakeDamage(const FMessage_Gameplay_PlayerTakeDam
 	OnPlayHitAniamtion();
 }
 
-void ASGSpritePawn::HandleCollectResouce(const FMessage_Gameplay_ResourceCollect& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGSpritePawn::HandleCollectResouce(const FMessage_Gameplay_ResourceCollect& Message)
 {
 	CurrentHP += Message.SummupResouces[static_cast<int32>(ESGResourceType::ETR_HP)];
 	FMath::Clamp(CurrentHP, 0, HPMax);
@@ -4,8 +4,6 @@
 
 #include "PaperSpriteComponent.h"
 #include "GameFramework/Pawn.h"
-#include "MessageEndpoint.h"
-#include "MessageEndpointBuilder.h"
 #include "SGameMessages.h"
 
 #include "SGSpritePawn.generated.h"
@@ -53,15 +51,12 @@ protected:
 	void OnPlayHitAniamtion();
 
 	/** Handles the player picked new tile*/
-	void HandlePlayerTakeDamage(const FMessage_Gameplay_PlayerTakeDamage& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandlePlayerTakeDamage(const FMessage_Gameplay_PlayerTakeDamage& Message);
 
 	/** Handles collect resouce*/
-	void HandleCollectResouce(const FMessage_Gameplay_ResourceCollect& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandleCollectResouce(const FMessage_Gameplay_ResourceCollect& Message);
 
 private:
 	UPROPERTY(Category = Sprite, VisibleAnywhere, BlueprintReadOnly, meta = (ExposeFunctionCategories = "Sprite,Rendering,Physics,Components|Sprite", AllowPrivateAccess = "true"))
 	class UPaperSpriteComponent* RenderComponent;
-
-	// Holds the messaging endpoint.
-	TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> MessageEndpoint;
 };
@@ -4,6 +4,7 @@
 #include "SGTileBase.h"
 #include "SGGrid.h"
 #include "SGGameMode.h"
+#include "SGMessageQueue.h"
 
 // Sets default values
 ASGTileBase::ASGTileBase()
@@ -13,6 +14,10 @@ ASGTileBase::ASGTileBase()
 
 	// We want the tile can be moved (falling), so we need a root component
 	SetRootComponent(GetRenderComponent());
+
+	bInPool = false;
+	bSelectable = true;
+	bLinked = false;
 }
 
 // Called when the game starts or when spawned
@@ -20,33 +25,6 @@ void ASGTileBase::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Set our class up to handle clicks and touches.
-	OnClicked.AddUniqueDynamic(this, &ASGTileBase::TilePress_Mouse);
-	OnBeginCursorOver.AddUniqueDynamic(this, &ASGTileBase::TileEnter_Mouse);
-	OnReleased.AddUniqueDynamic(this, &ASGTileBase::TileRelease_Mouse);
-
-	OnInputTouchBegin.AddUniqueDynamic(this, &ASGTileBase::TilePress);
-	OnInputTouchEnter.AddUniqueDynamic(this, &ASGTileBase::TileEnter);
-	OnInputTouchEnd.AddUniqueDynamic(this, &ASGTileBase::TileRelease);
-
-	FString EndPointName = FString::Printf(TEXT("Gameplay_Tile_%d"), GridAddress);
-	MessageEndpoint = FMessageEndpoint::Builder(*EndPointName)
-		.Handling<FMessage_Gameplay_TileSelectableStatusChange>(this, &ASGTileBase::HandleSelectableStatusChange)
-		.Handling<FMessage_Gameplay_TileLinkedStatusChange>(this, &ASGTileBase::HandleLinkStatusChange)
-		.Handling<FMessage_Gameplay_TileBeginMove>(this, &ASGTileBase::HandleTileMove)
-		.Handling<FMessage_Gameplay_TileCollect>(this, &ASGTileBase::HandleTileCollected)
-		.Handling<FMessage_Gameplay_DamageToTile>(this, &ASGTileBase::HandleTakeDamage);
-
-	if (MessageEndpoint.IsValid() == true)
-	{
-		// Subscribe the tile need events
-		MessageEndpoint->Subscribe<FMessage_Gameplay_TileSelectableStatusChange>();
-		MessageEndpoint->Subscribe<FMessage_Gameplay_TileLinkedStatusChange>();
-		MessageEndpoint->Subscribe<FMessage_Gameplay_TileBeginMove>();
-		MessageEndpoint->Subscribe<FMessage_Gameplay_TileCollect>();
-		MessageEndpoint->Subscribe<FMessage_Gameplay_DamageToTile>();
-	}
-
 	Grid = Cast<ASGGrid>(GetOwner());
 }
 
@@ -60,67 +38,42 @@ void ASGTileBase::Tick( float DeltaTime )
 
 void ASGTileBase::TilePress(ETouchIndex::Type FingerIndex, AActor* TouchedActor)
 {
-	UE_LOG(LogSGameTile, Log, TEXT("Tile %s was pressed, address (%d,%d)"), *GetName(), GridAddress % 6, GridAddress / 6);
+	checkSlow(Grid != nullptr);
+	UE_LOG(LogSGameTile, Log, TEXT("Tile %s was pressed, address (%d,%d)"), *GetName(), Grid->GetGridCoords(GridAddress).X, Grid->GetGridCoords(GridAddress).Y);
 
 	// Tell the game logic, the new tile is picked
-	FMessage_Gameplay_NewTilePicked* TilePickedMessage = new FMessage_Gameplay_NewTilePicked();
-	TilePickedMessage->TileID = TileID;
-	if (MessageEndpoint.IsValid() == true)
-	{
-		MessageEndpoint->Publish(TilePickedMessage, EMessageScope::Process);
-	}
+	FMessage_Gameplay_NewTilePicked& TilePickedMessage = FSGMessageQueue::Get().Publish<FMessage_Gameplay_NewTilePicked>();
+	TilePickedMessage.TileID = TileID;
 }
 
 void ASGTileBase::TileEnter(ETouchIndex::Type FingerIndex, AActor* TouchedActor)
 {
-	UE_LOG(LogSGameTile, Log, TEXT("Tile %s was entered, address (%d,%d)"), *GetName(), GridAddress % 6, GridAddress / 6);
-	FMessage_Gameplay_NewTilePicked* TilePickedMessage = new FMessage_Gameplay_NewTilePicked();
-	TilePickedMessage->TileID = TileID;
-	if (MessageEndpoint.IsValid() == true)
-	{
-		MessageEndpoint->Publish(TilePickedMessage, EMessageScope::Process);
-	}
+	checkSlow(Grid != nullptr);
+	UE_LOG(LogSGameTile, Log, TEXT("Tile %s was entered, address (%d,%d)"), *GetName(), Grid->GetGridCoords(GridAddress).X, Grid->GetGridCoords(GridAddress).Y);
+	FMessage_Gameplay_NewTilePicked& TilePickedMessage = FSGMessageQueue::Get().Publish<FMessage_Gameplay_NewTilePicked>();
+	TilePickedMessage.TileID = TileID;
 }
 
 void ASGTileBase::TileRelease(ETouchIndex::Type FingerIndex, AActor* TouchedActor)
 {
-	FMessage_Gameplay_GameStatusUpdate* GameStatusUpdateMessage = new FMessage_Gameplay_GameStatusUpdate();
-	GameStatusUpdateMessage->NewGameStatus = ESGGameStatus::EGS_PlayerEndBuildPath;
-
-	if (MessageEndpoint.IsValid() == true)
-	{
-		MessageEndpoint->Publish(GameStatusUpdateMessage, EMessageScope::Process);
-	}
-}
-
-void ASGTileBase::TilePress_Mouse(AActor* TouchedActor, FKey ButtonPressed)
-{
-	TilePress(ETouchIndex::Touch1, TouchedActor);
+	FMessage_Gameplay_GameStatusUpdate& GameStatusUpdateMessage = FSGMessageQueue::Get().Publish<FMessage_Gameplay_GameStatusUpdate>();
+	GameStatusUpdateMessage.NewGameStatus = ESGGameStatus::EGS_PlayerEndBuildPath;
 }
 
-void ASGTileBase::TileEnter_Mouse(AActor* TouchedActor)
+bool ASGTileBase::IsSelectable() const
 {
-	// This is meant to simulate finger-swiping, so ignore if the mouse isn't clicked.
-	if (APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0))
-	{
-		if (PC->IsInputKeyDown(EKeys::LeftMouseButton))
-		{
-			TileEnter(ETouchIndex::Touch1, TouchedActor);
-		}
-	}
+	return bSelectable == true;
 }
 
-void ASGTileBase::TileRelease_Mouse(AActor* TouchedActor, FKey ButtonPressed)
+const FSGTileArchetype& ASGTileBase::GetArchetype() const
 {
-	if (APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0))
-	{
-		TileRelease(ETouchIndex::Touch1, TouchedActor);
-	}
+	checkSlow(Grid != nullptr);
+	return Grid->GetSimulation().GetArchetype(TileTypeID);
 }
 
-bool ASGTileBase::IsSelectable() const
+int32 ASGTileBase::GetTileCausedDamage() const
 {
-	return Data.TileStatusArray.Contains(ESGTileStatusFlag::ESF_SELECTABLE);
+	return GetArchetype().CauseDamageInfo.InitialDamage;
 }
 
 void ASGTileBase::SetGridAddress(int32 NewLocation)
@@ -143,15 +96,49 @@ void ASGTileBase::OnTileTakeDamage()
 
 }
 
-TArray<FTileResourceUnit> ASGTileBase::GetTileResource() const
+void ASGTileBase::OnTileAcquired()
+{
+	bInPool = false;
+
+	// Forget the damage cached by the last owner of this actor
+	CachedDamageMessage.TileID = -1;
+	CachedDamageMessage.DamageInfos.Reset();
+
+	// A new tile starts with the full life and armor of its type
+	CurrentLifeArmorInfo = GetArchetype().LifeArmorInfo;
+
+	// Back to the normal display, a new tile is selectable and not linked
+	bSelectable = true;
+	bLinked = false;
+	checkSlow(GetRenderComponent());
+	if (Sprite_Normal != nullptr)
+	{
+		GetRenderComponent()->SetSprite(Sprite_Normal);
+	}
+	GetRenderComponent()->SetSpriteColor(FLinearColor::White);
+
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(true);
+}
+
+void ASGTileBase::OnTileReleased()
 {
-	return Data.TileResourceArray;
+	bInPool = true;
+
+	// The pooled tiles do nothing, keep them out of the tick too
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
 }
 
-void ASGTileBase::HandleTileCollected(const FMessage_Gameplay_TileCollect& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+const TArray<FTileResourceUnit>& ASGTileBase::GetTileResource() const
 {
-	FILTER_MESSAGE;
+	return GetArchetype().TileResourceArray;
+}
 
+void ASGTileBase::HandleTileCollected(const FMessage_Gameplay_TileCollect& Message)
+{
 	// Do some collect animation
 
 	// After all, tell the game mode to remove it
@@ -164,49 +151,13 @@ void ASGTileBase::HandleTileCollected(const FMessage_Gameplay_TileCollect& Messa
 
 bool ASGTileBase::OnTakeTileDamage(const TArray<FTileDamageInfo>& DamageInfos, FTileLifeArmorInfo& LifeArmorInfo) const
 {
-	for (int i = 0; i < DamageInfos.Num(); i++)
-	{
-		// Calculate the piercing damage first
-		LifeArmorInfo.CurrentLife -= DamageInfos[i].InitialDamage * DamageInfos[i].PiercingArmorRatio;
-		if (LifeArmorInfo.CurrentLife < 0)
-		{
-			return true;
-		}
-
-		// Reduce the tile armor value
-		float ResultDamage = DamageInfos[i].InitialDamage * (1 - DamageInfos[i].PiercingArmorRatio);
-
-		// Currently the tile armor duracity is fix to 1 (1 armor absorb = 1 damage)
-		if (LifeArmorInfo.CurrentArmor > 0)
-		{
-			float ArmorBefore = LifeArmorInfo.CurrentArmor;
-			float ArmorAfter = ArmorBefore - ResultDamage;
-			LifeArmorInfo.CurrentArmor = FMath::Clamp(ArmorAfter, 0.0f, LifeArmorInfo.ArmorMax);
-			
-			ResultDamage -= ArmorBefore;
-			if (ResultDamage < 0)
-			{
-				ResultDamage = 0;
-			}
-		}
-
-		// The damage don't absorb completely 
-		if (ResultDamage > 0)
-		{
-			LifeArmorInfo.CurrentLife -= ResultDamage;
-			if (LifeArmorInfo.CurrentLife < 0)
-			{
-				return true;
-			}
-		}
-	}
-
-	return false;
+	// Same damage rule as the board simulation
+	return FSGBoardSimulation::TakeTileDamage(DamageInfos, LifeArmorInfo);
 }
 
 bool ASGTileBase::EvaluateDamageToTile(const TArray<FTileDamageInfo>& DamageInfos) const
 {
-	FTileLifeArmorInfo FakeInfo = Data.LifeArmorInfo;
+	FTileLifeArmorInfo FakeInfo = CurrentLifeArmorInfo;
 	return OnTakeTileDamage(DamageInfos, FakeInfo);
 }
 
@@ -219,11 +170,9 @@ void ASGTileBase::OnTweenCompleteNative(AiTweenEvent* eventOperator, AActor* act
 	}
 }
 
-void ASGTileBase::HandleTakeDamage(const FMessage_Gameplay_DamageToTile& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGTileBase::HandleTakeDamage(const FMessage_Gameplay_DamageToTile& Message)
 {
-	FILTER_MESSAGE;
-
-	if (Abilities.bCanTakeDamage == false)
+	if (GetArchetype().Abilities.bCanTakeDamage == false)
 	{
 		UE_LOG(LogSGameTile, Log, TEXT("Tile cannnot take damage"));
 		return;
@@ -240,62 +189,72 @@ void ASGTileBase::HandleTakeDamage(const FMessage_Gameplay_DamageToTile& Message
 	else
 	{
 		// Take damage first
-		bool TileDead = OnTakeTileDamage(Message.DamageInfos, Data.LifeArmorInfo);
+		bool TileDead = OnTakeTileDamage(Message.DamageInfos, CurrentLifeArmorInfo);
 	}
 }
 
-void ASGTileBase::HandleSelectableStatusChange(const FMessage_Gameplay_TileSelectableStatusChange& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGTileBase::HandleBoardSelectableStatusChange(const FMessage_Gameplay_BoardSelectableStatusChange& Message, int32 inGridAddress)
+{
+	SetSelectableStatus((Message.SelectableMask & FSGBoardModel::AddressToMask(inGridAddress)) != 0);
+}
+
+void ASGTileBase::HandleBoardLinkedStatusChange(const FMessage_Gameplay_BoardLinkedStatusChange& Message, int32 inGridAddress)
+{
+	SetLinkedStatus((Message.LinkedMask & FSGBoardModel::AddressToMask(inGridAddress)) != 0);
+}
+
+void ASGTileBase::SetSelectableStatus(bool bNewSelectable)
 {
-	FILTER_MESSAGE;
+	if (IsSelectable() == bNewSelectable)
+	{
+		return;
+	}
 
-	UE_LOG(LogSGameTile, Log, TEXT("Tile %d selectable flag changed to %d"), GridAddress, Message.NewSelectableStatus);
+	UE_LOG(LogSGameTile, Log, TEXT("Tile %d selectable flag changed to %d"), GridAddress, bNewSelectable);
 
-	if (Message.NewSelectableStatus == true)
+	if (bNewSelectable == true)
 	{
-		// Add the selectable flag to the status array
-		Data.TileStatusArray.AddUnique(ESGTileStatusFlag::ESF_SELECTABLE);
+		bSelectable = true;
 
 		// Set the white color 
 		GetRenderComponent()->SetSpriteColor(FLinearColor::White);
 	}
 	else
 	{
-		// Remove the selectable flag
-		Data.TileStatusArray.Remove(ESGTileStatusFlag::ESF_SELECTABLE);
+		bSelectable = false;
 
 		// Dim the sprite
 		GetRenderComponent()->SetSpriteColor(FLinearColor(0.2f, 0.2f, 0.2f));
 	}
 }
 
-void ASGTileBase::HandleLinkStatusChange(const FMessage_Gameplay_TileLinkedStatusChange& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGTileBase::SetLinkedStatus(bool bNewLinked)
 {
-	FILTER_MESSAGE;
+	if (bLinked == bNewLinked)
+	{
+		return;
+	}
 
-	UE_LOG(LogSGameTile, Log, TEXT("Tile %d link status changed to %d"), GridAddress, Message.NewLinkStatus);
+	UE_LOG(LogSGameTile, Log, TEXT("Tile %d link status changed to %d"), GridAddress, bNewLinked);
 
-	if (Message.NewLinkStatus == true)
+	if (bNewLinked == true)
 	{
-		// Add the selectable flag to the status array
-		Data.TileStatusArray.AddUnique(ESGTileStatusFlag::ESF_LINKED);
+		bLinked = true;
 
 		// Set the linked sprite
 		GetRenderComponent()->SetSprite(Sprite_Selected);
 	}
 	else
 	{
-		// Remove the selectable flag
-		Data.TileStatusArray.Remove(ESGTileStatusFlag::ESF_LINKED);
+		bLinked = false;
 
 		// Set the normal sprite
 		GetRenderComponent()->SetSprite(Sprite_Normal);
 	}
 }
 
-void ASGTileBase::HandleTileMove(const FMessage_Gameplay_TileBeginMove& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context)
+void ASGTileBase::HandleTileMove(const FMessage_Gameplay_TileBeginMove& Message)
 {
-	FILTER_MESSAGE;
-
 	UE_LOG(LogSGameTile, Log, TEXT("Tile ID: %d, at old address: %d will move to the new address %d"), Message.TileID, Message.OldTileAddress, Message.NewTileAddress);
 
 	if (Grid == nullptr)
@@ -316,12 +275,9 @@ void ASGTileBase::HandleTileMove(const FMessage_Gameplay_TileBeginMove& Message,
 void ASGTileBase::FinishFalling()
 {
 	SetActorLocation(FallingEndLocation);
-	if (MessageEndpoint.IsValid() == true)
-	{
-		// Send the finish move message to other module
-		FMessage_Gameplay_TileEndMove* Message = new FMessage_Gameplay_TileEndMove();
-		Message->TileID = TileID;
-		MessageEndpoint->Publish(Message, EMessageScope::Process);
-	}
+
+	// Send the finish move message to other module
+	FMessage_Gameplay_TileEndMove& Message = FSGMessageQueue::Get().Publish<FMessage_Gameplay_TileEndMove>();
+	Message.TileID = TileID;
 }
 
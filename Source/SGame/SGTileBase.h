@@ -5,13 +5,13 @@
 #include "PaperSprite.h"
 #include "PaperSpriteActor.h"
 #include "GameFramework/Actor.h"
-#include "MessageEndpoint.h"
 #include "SGameMessages.h"
 #include "iTween/iTInterface.h"
 
 #include "SGTileBase.generated.h"
 
 class ASGGrid;
+struct FSGTileArchetype;
 
 #define  FILTER_MESSAGE \
 	if (FilterMessage(Message.TileID) == false) \
@@ -52,6 +52,10 @@ struct FSGTileType
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float Probability;
 
+	/** The probability change per round, e.g. positive on the enemy tiles to ramp up the enemy density */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float ProbabilityGrowthPerRound;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	TSubclassOf<class ASGTileBase> TileClass;
 
@@ -70,6 +74,7 @@ struct FSGTileType
 	FSGTileType()
 	{
 		Probability = 1;
+		ProbabilityGrowthPerRound = 0;
 		TileClass = nullptr;
 	}
 };
@@ -78,6 +83,8 @@ UCLASS()
 class SGAME_API ASGTileBase : public APaperSpriteActor, public IiTInterface
 {
 	GENERATED_BODY()
+
+	friend class FSGTileEventRouter;
 	
 public:	
 	// Sets default values for this actor's properties
@@ -89,7 +96,7 @@ public:
 	// Called every frame
 	virtual void Tick( float DeltaSeconds ) override;
 
-	/** When a tile is touched. */
+	/** When a tile is touched. The player controller hit tests the grid and calls it, for the mouse too */
 	UFUNCTION()
 	void TilePress(ETouchIndex::Type FingerIndex, AActor* TouchedActor);
 
@@ -101,18 +108,6 @@ public:
 	UFUNCTION()
 	void TileRelease(ETouchIndex::Type FingerIndex, AActor* TouchedActor);
 
-	/** Mouse surrogate for TilePress. */
-	UFUNCTION()
-	void TilePress_Mouse(AActor* TouchedActor, FKey ButtonPressed);
-
-	/** Mouse surrogate for TileEnter. */
-	UFUNCTION()
-	void TileEnter_Mouse(AActor* TouchedActor);
-
-	/** Mouse surrogate for TileRelease*/
-	UFUNCTION()
-	void TileRelease_Mouse(AActor* TouchedActor, FKey ButtonPressed);
-
 	/** Is current tile selecatable*/
 	UFUNCTION()
 	bool IsSelectable() const;
@@ -123,7 +118,7 @@ public:
 	int32 GetTileID() const { return TileID; }
 	void SetTileID(int32 val) { TileID = val; }
 
-	virtual int32 GetTileCausedDamage() const { return Data.CauseDamageInfo.InitialDamage; }
+	virtual int32 GetTileCausedDamage() const;
 
 	int32 GetSpawnedRound() const { return SpawnedRound; }
 	void SetSpawnedRound(int32 val) { SpawnedRound = val; }
@@ -131,12 +126,21 @@ public:
 	UPROPERTY(BlueprintReadOnly)
 	int32 TileTypeID;
 
+	/** The shared immutable record of the tile type, built once from the tile library */
+	const FSGTileArchetype& GetArchetype() const;
+
+	/** Class default abilities, only read from the class default object to build the archetypes */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	FSGTileAbilities Abilities;
 
+	/** Class default data, only read from the class default object to build the archetypes */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	FSGTileData Data;
 
+	/** The life and armor of this tile, reset from the archetype when the tile is acquired */
+	UPROPERTY(BlueprintReadOnly)
+	FTileLifeArmorInfo CurrentLifeArmorInfo;
+
 	// Falling functions
 	UFUNCTION(BlueprintImplementableEvent)
 	void StartFalling();
@@ -149,8 +153,17 @@ public:
 	// Currenttly only the enemy tile can take damage
 	virtual void OnTileTakeDamage();
 
-	/** Return the tile resource that can be collect */
-	virtual TArray<FTileResourceUnit> GetTileResource() const;
+	/** Called when the tile is taken from the tile manager, after its data is set, reset the tile state and display */
+	virtual void OnTileAcquired();
+
+	/** Called when the tile is released to the tile manager pool, hide it, stop its tick and stop handling messages */
+	virtual void OnTileReleased();
+
+	/** Whether the tile is waiting in the tile manager pool */
+	bool IsInPool() const { return bInPool; }
+
+	/** Return the tile resource that can be collect, shared by all the tiles of the type */
+	const TArray<FTileResourceUnit>& GetTileResource() const;
 
 	/**
 	* Evaluate the if the tile survive after this damage
@@ -198,6 +211,13 @@ protected:
 	/** Keep a weak reference to the owner*/
 	ASGGrid* Grid;
 
+	/** Whether the tile is released to the pool */
+	bool bInPool;
+
+	/** Status bits, mirrored from the board masks */
+	uint8 bSelectable : 1;
+	uint8 bLinked : 1;
+
 	/**
 	* Called when the tile take damage
 	*
@@ -211,6 +231,12 @@ protected:
 	/** If the Message send to me */
 	bool FilterMessage(int32 inTileID)
 	{
+		if (bInPool == true)
+		{
+			// Pooled tile is not on the grid
+			return false;
+		}
+
 		if (inTileID == -1)
 		{
 			// It send to all tiles
@@ -223,27 +249,27 @@ protected:
 	FMessage_Gameplay_DamageToTile CachedDamageMessage;
 
 private:
+	// The tile messages below are delivered directly by the grid's tile event router,
+	// only to the target tile, so the handlers don't need to filter the message
 
-	// Holds the messaging endpoint.
-	// Note that we don't want the sub class inherited this member,
-	// because every message handler should explicitly handled by itself class
-	TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> MessageEndpoint;
+	/** Handles the board selectable status change, the tile on inGridAddress is in the changed mask */
+	void HandleBoardSelectableStatusChange(const FMessage_Gameplay_BoardSelectableStatusChange& Message, int32 inGridAddress);
 
-	/** Handles tile become selectalbe */
-	void HandleSelectableStatusChange(const FMessage_Gameplay_TileSelectableStatusChange& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	/** Handles the board linked status change, the tile on inGridAddress is in the changed mask */
+	void HandleBoardLinkedStatusChange(const FMessage_Gameplay_BoardLinkedStatusChange& Message, int32 inGridAddress);
 
-	/** Handles tile become selectalbe */
-	void HandleLinkStatusChange(const FMessage_Gameplay_TileLinkedStatusChange& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	/** Update the selectable flag and the sprite color, nothing happens if the status is not changed */
+	void SetSelectableStatus(bool bNewSelectable);
+
+	/** Update the linked flag and the sprite, nothing happens if the status is not changed */
+	void SetLinkedStatus(bool bNewLinked);
 
 	/** Handles tile become selectalbe */
-	void HandleTileMove(const FMessage_Gameplay_TileBeginMove& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandleTileMove(const FMessage_Gameplay_TileBeginMove& Message);
 
 	/** Handle tile collected */
-	void HandleTileCollected(const FMessage_Gameplay_TileCollect& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
-
-	/** Handle tile linked */
-	void HandleTileLinked(const FMessage_Gameplay_TileCollect& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandleTileCollected(const FMessage_Gameplay_TileCollect& Message);
 
 	/** Handle take damage message */
-	void HandleTakeDamage(const FMessage_Gameplay_DamageToTile& Message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Context);
+	void HandleTakeDamage(const FMessage_Gameplay_DamageToTile& Message);
 };
@@ -0,0 +1,131 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGame.h"
+#include "SGTileEventRouter.h"
+#include "SGTileBase.h"
+#include "SGBoardModel.h"
+
+DEFINE_STAT(STAT_SGTileEventDeliveries);
+
+FSGTileEventRouter::FSGTileEventRouter()
+	: FrameNumber(0)
+	, FrameDeliveryNum(0)
+{
+}
+
+void FSGTileEventRouter::Initialize(int32 inGridCellNum)
+{
+	TileIDToTile.Empty();
+	AddressToTile.Empty(inGridCellNum);
+	AddressToTile.AddZeroed(inGridCellNum);
+}
+
+void FSGTileEventRouter::BindTile(ASGTileBase* inTile, int32 inGridAddress)
+{
+	checkSlow(inTile);
+	checkSlow(AddressToTile.IsValidIndex(inGridAddress));
+
+	const int32 TileID = inTile->GetTileID();
+	checkSlow(TileID >= 0);
+	if (TileIDToTile.Num() <= TileID)
+	{
+		TileIDToTile.AddZeroed(TileID + 1 - TileIDToTile.Num());
+	}
+	TileIDToTile[TileID] = inTile;
+	AddressToTile[inGridAddress] = inTile;
+}
+
+void FSGTileEventRouter::UnbindTile(ASGTileBase* inTile, int32 inGridAddress)
+{
+	checkSlow(inTile);
+
+	// The id may already be given to a new tile on the grid
+	const int32 TileID = inTile->GetTileID();
+	if (TileIDToTile.IsValidIndex(TileID) && TileIDToTile[TileID] == inTile)
+	{
+		TileIDToTile[TileID] = nullptr;
+
+		// Drop the unbound tail, the index does not keep the ids of the tiles gone
+		int32 TileIDNum = TileIDToTile.Num();
+		while (TileIDNum > 0 && TileIDToTile[TileIDNum - 1] == nullptr)
+		{
+			TileIDNum--;
+		}
+		TileIDToTile.SetNum(TileIDNum, false);
+	}
+
+	if (AddressToTile.IsValidIndex(inGridAddress) && AddressToTile[inGridAddress] == inTile)
+	{
+		AddressToTile[inGridAddress] = nullptr;
+	}
+}
+
+void FSGTileEventRouter::MoveTile(ASGTileBase* inTile, int32 inFromAddress, int32 inToAddress)
+{
+	checkSlow(AddressToTile.IsValidIndex(inFromAddress) && AddressToTile.IsValidIndex(inToAddress));
+	checkSlow(AddressToTile[inFromAddress] == inTile);
+
+	AddressToTile[inFromAddress] = nullptr;
+	AddressToTile[inToAddress] = inTile;
+}
+
+void FSGTileEventRouter::Send(const FMessage_Gameplay_BoardSelectableStatusChange& Message)
+{
+	FSGBoardMask ChangedMask = Message.ChangedMask;
+	while (ChangedMask != 0)
+	{
+		const int32 GridAddress = FSGBoardModel::PopLowestAddress(ChangedMask);
+		ASGTileBase* Tile = FindTileAtAddress(GridAddress);
+		if (Tile != nullptr)
+		{
+			CountDelivery();
+			Tile->HandleBoardSelectableStatusChange(Message, GridAddress);
+		}
+	}
+}
+
+void FSGTileEventRouter::Send(const FMessage_Gameplay_BoardLinkedStatusChange& Message)
+{
+	FSGBoardMask ChangedMask = Message.ChangedMask;
+	while (ChangedMask != 0)
+	{
+		const int32 GridAddress = FSGBoardModel::PopLowestAddress(ChangedMask);
+		ASGTileBase* Tile = FindTileAtAddress(GridAddress);
+		if (Tile != nullptr)
+		{
+			CountDelivery();
+			Tile->HandleBoardLinkedStatusChange(Message, GridAddress);
+		}
+	}
+}
+
+void FSGTileEventRouter::Deliver(ASGTileBase& Tile, const FMessage_Gameplay_TileBeginMove& Message)
+{
+	CountDelivery();
+	Tile.HandleTileMove(Message);
+}
+
+void FSGTileEventRouter::Deliver(ASGTileBase& Tile, const FMessage_Gameplay_TileCollect& Message)
+{
+	CountDelivery();
+	Tile.HandleTileCollected(Message);
+}
+
+void FSGTileEventRouter::Deliver(ASGTileBase& Tile, const FMessage_Gameplay_DamageToTile& Message)
+{
+	CountDelivery();
+	Tile.HandleTakeDamage(Message);
+}
+
+void FSGTileEventRouter::CountDelivery()
+{
+	INC_DWORD_STAT(STAT_SGTileEventDeliveries);
+
+	if (FrameNumber != GFrameCounter)
+	{
+		// New frame, restart the counter
+		FrameNumber = GFrameCounter;
+		FrameDeliveryNum = 0;
+	}
+	FrameDeliveryNum++;
+}
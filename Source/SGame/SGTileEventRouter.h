@@ -0,0 +1,94 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SGame.h"
+#include "SGameMessages.h"
+
+class ASGTileBase;
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Tile Event Deliveries"), STAT_SGTileEventDeliveries, STATGROUP_SGame, SGAME_API);
+
+/**
+ * Delivers the tile messages directly to the tiles on the grid.
+ * The handlers are indexed by the tile id and the grid address, so a message to one tile
+ * is one call, only the message with TileID -1 is broadcast to all the tiles on the grid.
+ */
+class SGAME_API FSGTileEventRouter
+{
+public:
+	FSGTileEventRouter();
+
+	/** Initialize the grid address index */
+	void Initialize(int32 inGridCellNum);
+
+	/** The tile is put on the grid address, it begins to receive the tile messages */
+	void BindTile(ASGTileBase* inTile, int32 inGridAddress);
+
+	/** The tile leaves the grid address, it will not receive any tile message */
+	void UnbindTile(ASGTileBase* inTile, int32 inGridAddress);
+
+	/** The tile moves to a new grid address */
+	void MoveTile(ASGTileBase* inTile, int32 inFromAddress, int32 inToAddress);
+
+	/** Get the tile on the grid with the tile id, null if the tile is not on the grid */
+	ASGTileBase* FindTile(int32 inTileID) const
+	{
+		return TileIDToTile.IsValidIndex(inTileID) ? TileIDToTile[inTileID] : nullptr;
+	}
+
+	/** Get the tile on the grid address */
+	ASGTileBase* FindTileAtAddress(int32 inGridAddress) const
+	{
+		return AddressToTile.IsValidIndex(inGridAddress) ? AddressToTile[inGridAddress] : nullptr;
+	}
+
+	/** Send the board status to the tiles whose bit is in Message.ChangedMask */
+	void Send(const FMessage_Gameplay_BoardSelectableStatusChange& Message);
+	void Send(const FMessage_Gameplay_BoardLinkedStatusChange& Message);
+
+	/** Send the message to the tile with Message.TileID, or broadcast to all the tiles on the grid if the id is -1 */
+	template<typename MessageType>
+	void Send(const MessageType& Message)
+	{
+		if (Message.TileID == -1)
+		{
+			for (int32 i = 0; i < AddressToTile.Num(); i++)
+			{
+				if (AddressToTile[i] != nullptr)
+				{
+					Deliver(*AddressToTile[i], Message);
+				}
+			}
+			return;
+		}
+
+		ASGTileBase* Tile = FindTile(Message.TileID);
+		if (Tile != nullptr)
+		{
+			Deliver(*Tile, Message);
+		}
+	}
+
+	/** How many messages are delivered in this frame */
+	int32 GetFrameDeliveryNum() const { return (FrameNumber == GFrameCounter) ? FrameDeliveryNum : 0; }
+
+private:
+	/** Deliver the message to the tile handler */
+	void Deliver(ASGTileBase& Tile, const FMessage_Gameplay_TileBeginMove& Message);
+	void Deliver(ASGTileBase& Tile, const FMessage_Gameplay_TileCollect& Message);
+	void Deliver(ASGTileBase& Tile, const FMessage_Gameplay_DamageToTile& Message);
+
+	/** Count one delivery for this frame */
+	void CountDelivery();
+
+	/** Tiles on the grid indexed by the tile id, the tile manager reuses the ids so the index stays as large as the most tiles alive at once */
+	TArray<ASGTileBase*> TileIDToTile;
+
+	/** Tiles on the grid indexed by the grid address */
+	TArray<ASGTileBase*> AddressToTile;
+
+	/** Delivery counter of the current frame */
+	uint64 FrameNumber;
+	int32 FrameDeliveryNum;
+};
@@ -161,37 +161,50 @@ struct FMessage_Gameplay_AllTileFinishMove
 };
 
 /**
-* The tile selected status change event
+* The best link line on the settled board, found in the background while the tiles fall
 */
 USTRUCT()
-struct FMessage_Gameplay_TileSelectableStatusChange
+struct FMessage_Gameplay_LinkHint
 {
 	GENERATED_USTRUCT_BODY()
 
-	/** The picked tile address, if the address is -1, then all apply to all tiles*/
+	/** The hint link line grid addresses, in the link order, empty if the board has no legal link */
 	UPROPERTY()
-	int32 TileID;
+	TArray<int32> HintAddresses;
+};
 
-	/** The new selectable status, it can be override by the tile logic itself*/
+/**
+* The board selectable status change event, one bit per grid address
+*/
+USTRUCT()
+struct FMessage_Gameplay_BoardSelectableStatusChange
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** The selectable status of the whole board */
+	UPROPERTY()
+	uint64 SelectableMask;
+
+	/** The grid addresses whose selectable status flipped, only these tiles receive the message */
 	UPROPERTY()
-	bool NewSelectableStatus;
+	uint64 ChangedMask;
 };
 
 /**
-* The tile linked status change event
+* The board linked status change event, one bit per grid address
 */
 USTRUCT()
-struct FMessage_Gameplay_TileLinkedStatusChange
+struct FMessage_Gameplay_BoardLinkedStatusChange
 {
 	GENERATED_USTRUCT_BODY()
 
-	/** The picked tile address, if the address is -1, then all apply to all tiles*/
+	/** The linked status of the whole board */
 	UPROPERTY()
-	int32 TileID;
+	uint64 LinkedMask;
 
-	/** The new selectable status, it can be override by the tile logic itself*/
+	/** The grid addresses whose linked status flipped, only these tiles receive the message */
 	UPROPERTY()
-	bool NewLinkStatus;
+	uint64 ChangedMask;
 };
 
 /**
@@ -3,3 +3,816 @@
 #include "SGame.h"
 #include "iTweenPCH.h"
 #include "iTAux.h"
+#include "iTEasing.h"
+#include "iTInterface.h"
+#include "iTween.h"
+#include "iTweenEvent.h"
+
+AiTAux::AiTAux()
+{
+	PrimaryActorTick.bCanEverTick = true;
+}
+
+void AiTAux::BeginPlay()
+{
+	AActor::BeginPlay();
+
+	if (bakeEasingTables)
+	{
+		BakeEasingTables();
+	}
+}
+
+void AiTAux::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	//The tables are shared by every world, they stay baked while another aux uses them
+	if (retainsEasingTables)
+	{
+		retainsEasingTables = false;
+		FiTweenEasing::ReleaseTables();
+	}
+
+	AActor::EndPlay(EndPlayReason);
+}
+
+void AiTAux::BakeEasingTables()
+{
+	const double startSeconds = FPlatformTime::Seconds();
+	FiTweenEasing::BakeTables(easingTableResolution, easingTableResolutions);
+	const double bakeSeconds = FPlatformTime::Seconds() - startSeconds;
+
+	if (!retainsEasingTables)
+	{
+		retainsEasingTables = true;
+		FiTweenEasing::RetainTables();
+	}
+
+	if (reportEasingTableErrors)
+	{
+		TArray<FiTweenEasingTableError> errors;
+		FiTweenEasing::GetTableErrors(errors);
+		UE_LOG(LogSGame, Log, TEXT("Baked %d easing tables in %.3f ms"), errors.Num(), bakeSeconds * 1000.0);
+		for (const FiTweenEasingTableError& error : errors)
+		{
+			UE_LOG(LogSGame, Log, TEXT("Easing table %s: %d samples, max error %g at %.4f, mean error %g"), *error.name, error.resolution, error.maxError, error.maxErrorAlpha, error.meanError);
+		}
+	}
+}
+
+void AiTAux::Tick(float DeltaSeconds)
+{
+	AActor::Tick(DeltaSeconds);
+
+	//Pooled tweens never tick when paused or ignore time dilation, those get an event actor
+	tweenPool.Tick(DeltaSeconds);
+}
+
+static bool IsActorTween(uint8 eventType)
+{
+	return eventType == EEventType::EventType::actorMoveFromTo || eventType == EEventType::EventType::actorRotateFromTo || eventType == EEventType::EventType::actorScaleFromTo;
+}
+
+static bool IsRotateTween(uint8 eventType)
+{
+	return eventType == EEventType::EventType::actorRotateFromTo || eventType == EEventType::EventType::compRotateFromTo;
+}
+
+int32 FiTweenPool::Add(const FiTweenPoolDesc& desc, float worldToMeters)
+{
+	USceneComponent* target = desc.componentTweening;
+	if (IsActorTween(desc.eventType))
+	{
+		target = desc.actorTweening ? desc.actorTweening->GetRootComponent() : nullptr;
+	}
+	if (!target)
+	{
+		return INDEX_NONE;
+	}
+
+	const bool isRotate = IsRotateTween(desc.eventType);
+
+	//Convert speed to time like AiTweenEvent::SetTickTypeValue, once for all the loop sections
+	float duration = desc.tickTypeValue;
+	if (desc.tickType != ETickType::TickType::seconds)
+	{
+		if (isRotate)
+		{
+			duration = ((UiTween::GetDistanceBetweenTwoVectors(desc.rotatorFrom.Vector(), desc.rotatorTo.Vector()) / desc.tickTypeValue) / worldToMeters);
+		}
+		else
+		{
+			duration = ((UiTween::GetDistanceBetweenTwoVectors(desc.vectorFrom, desc.vectorTo) / desc.tickTypeValue) / worldToMeters);
+		}
+	}
+
+	targets.Add(target);
+	eventTypes.Add(desc.eventType);
+	fromValues.Add(isRotate ? FVector(desc.rotatorFrom.Pitch, desc.rotatorFrom.Yaw, desc.rotatorFrom.Roll) : desc.vectorFrom);
+	toValues.Add(isRotate ? FVector(desc.rotatorTo.Pitch, desc.rotatorTo.Yaw, desc.rotatorTo.Roll) : desc.vectorTo);
+	alphas.Add(0.f);
+	durations.Add(duration);
+	easeTypes.Add(desc.easeType);
+
+	//Check if delay is needed, like AiTweenEvent::CheckIfFirstDelay
+	uint8 hotFlags = desc.shortestPath ? shortestPath : 0;
+	if (desc.delayType == EDelayType::DelayType::first || desc.delayType == EDelayType::DelayType::firstLoop || desc.delayType == EDelayType::DelayType::firstLoopFull)
+	{
+		hotFlags |= delaying;
+	}
+	flags.Add(hotFlags);
+
+	coldData.AddDefaulted();
+	FColdData& cold = coldData.Last();
+	cold.id = nextId++;
+	indicesById.Add(cold.id, coldData.Num() - 1);
+	cold.tweenName = desc.tweenName;
+	cold.actorTweening = desc.actorTweening;
+	cold.customEaseTypeCurve = desc.customEaseTypeCurve;
+	cold.punchAmplitude = desc.punchAmplitude;
+	cold.enforceValueTo = desc.enforceValueTo;
+	cold.sweep = desc.sweep;
+	cold.tieToObjectValidity = desc.tieToObjectValidity;
+	cold.firstSet = false;
+	cold.playingBackward = false;
+	cold.successfulTransform = true;
+	cold.vectorConstraints = desc.vectorConstraints;
+	cold.rotatorConstraints = desc.rotatorConstraints;
+	cold.delay = desc.delay;
+	cold.delayCount = 0.f;
+	cold.delayType = desc.delayType;
+	cold.loopType = desc.loopType;
+	cold.maximumLoopSections = FMath::Abs(desc.maximumLoopSections);
+	cold.numberOfLoopSections = 0;
+
+	UObject* const interfaceTargets[] = { desc.onTweenStartTarget, desc.onTweenUpdateTarget, desc.onTweenLoopTarget, desc.onTweenCompleteTarget };
+	const FString* const functionNames[] = { &desc.OnTweenStartFunctionName, &desc.OnTweenUpdateFunctionName, &desc.OnTweenLoopFunctionName, &desc.OnTweenCompleteFunctionName };
+	for (int32 type = 0; type < 4; type++)
+	{
+		cold.interfaceTargets[type] = interfaceTargets[type];
+		if (interfaceTargets[type] && *functionNames[type] != "")
+		{
+			cold.delegates[type].BindUFunction(interfaceTargets[type], **functionNames[type]);
+		}
+	}
+
+	if (!desc.customEaseTypeCurve && desc.easeType == EEaseType::EaseType::customCurve)
+	{
+		UiTween::Print("No Curve defined! You must specify a CurveFloat object that begins and a time of 0 and ends at a time of 1. Defaulting to Linear (No Easing).", "error");
+	}
+
+	return cold.id;
+}
+
+void FiTweenPool::Tick(float deltaSeconds)
+{
+	Compact();
+
+	//Start the tweens and count down the delays, and gather the tweens moving on this tick.
+	//The callbacks may add or stop tweens, the added ones start on the next tick and nothing is held across a callback
+	const int32 tweenCount = flags.Num();
+	movingIndices.Reset();
+	for (int32 i = 0; i < tweenCount; i++)
+	{
+		if ((flags[i] & (paused | finished)) != 0)
+		{
+			continue;
+		}
+
+		if ((flags[i] & tweening) != 0)
+		{
+			movingIndices.Add(i);
+			continue;
+		}
+
+		if ((flags[i] & delaying) == 0)
+		{
+			//Start without delay, the tween moves on the next tick like AiTweenEvent::ExecuteTween
+			RunInterface(i, ETweenInterfaceType::TweenInterfaceType::start);
+			if ((flags[i] & finished) == 0)
+			{
+				FirstSet(i, targets[i].Get());
+				flags[i] |= tweening;
+			}
+			continue;
+		}
+
+		FColdData& cold = coldData[i];
+		if (cold.delayCount < cold.delay)
+		{
+			cold.delayCount += deltaSeconds;
+			continue;
+		}
+
+		//Delay is over, the tween moves on this tick like AiTweenEvent::DelayTween
+		FirstSet(i, targets[i].Get());
+		if ((flags[i] & finished) != 0)
+		{
+			continue;
+		}
+		RunInterface(i, ETweenInterfaceType::TweenInterfaceType::start);
+		if ((flags[i] & finished) != 0)
+		{
+			continue;
+		}
+		flags[i] |= tweening;
+		movingIndices.Add(i);
+	}
+
+	//Advance and ease the moving tweens all at once, the alphas are only stored when the tween is still moving below
+	const int32 movingCount = movingIndices.Num();
+	movingEaseTypes.SetNumUninitialized(movingCount, false);
+	nextAlphas.SetNumUninitialized(movingCount, false);
+	easedAlphas.SetNumUninitialized(movingCount, false);
+	interpValues.SetNumUninitialized(movingCount, false);
+	for (int32 k = 0; k < movingCount; k++)
+	{
+		const int32 i = movingIndices[k];
+		movingEaseTypes[k] = easeTypes[i];
+		nextAlphas[k] = FMath::Clamp<float>((alphas[i] + (deltaSeconds / durations[i])), 0.f, 1.f);
+	}
+	FiTweenEasing::EvaluateGrouped(movingEaseTypes.GetData(), nextAlphas.GetData(), easedAlphas.GetData(), movingCount, easingIndices, easingValues);
+
+	//Interpolate the values in bulk, the curves and the punch amplitudes are per tween
+	for (int32 k = 0; k < movingCount; k++)
+	{
+		const int32 i = movingIndices[k];
+		if (movingEaseTypes[k] == EEaseType::EaseType::customCurve)
+		{
+			easedAlphas[k] = FiTweenEasing::Evaluate(EEaseType::EaseType::customCurve, nextAlphas[k], coldData[i].customEaseTypeCurve.Get());
+		}
+		else if (movingEaseTypes[k] == EEaseType::EaseType::punch)
+		{
+			easedAlphas[k] *= coldData[i].punchAmplitude;
+		}
+
+		const FVector& from = fromValues[i];
+		const FVector& to = toValues[i];
+		const float easedAlpha = easedAlphas[k];
+		if (!IsRotateTween(eventTypes[i]))
+		{
+			interpValues[k] = FMath::Lerp<FVector>(from, to, easedAlpha);
+		}
+		else if ((flags[i] & shortestPath) == 0)
+		{
+			//FMath::LerpStable of the rotators
+			interpValues[k] = (from * (1.0f - easedAlpha)) + (to * easedAlpha);
+		}
+		else
+		{
+			FQuat rot = FQuat::Slerp(FRotator(from.X, from.Y, from.Z).Quaternion(), FRotator(to.X, to.Y, to.Z).Quaternion(), easedAlpha);
+			rot.Normalize();
+			const FRotator rotator = rot.Rotator();
+			interpValues[k] = FVector(rotator.Pitch, rotator.Yaw, rotator.Roll);
+		}
+	}
+
+	//Set the values and send the messages, a message may stop or pause any tween
+	for (int32 k = 0; k < movingCount; k++)
+	{
+		const int32 i = movingIndices[k];
+		if ((flags[i] & (paused | finished)) != 0)
+		{
+			continue;
+		}
+		alphas[i] = nextAlphas[k];
+
+		USceneComponent* target = targets[i].Get();
+		if (target)
+		{
+			InterpTween(i, target, interpValues[k]);
+		}
+		else if (coldData[i].tieToObjectValidity)
+		{
+			EndPhase(i);
+		}
+		if ((flags[i] & finished) != 0)
+		{
+			continue;
+		}
+
+		RunInterface(i, ETweenInterfaceType::TweenInterfaceType::update);
+		if ((flags[i] & finished) != 0)
+		{
+			continue;
+		}
+
+		if (alphas[i] >= 1.0f)
+		{
+			if (easeTypes[i] != EEaseType::EaseType::punch)
+			{
+				LastSet(i, targets[i].Get());
+			}
+
+			CheckLoopType(i);
+		}
+	}
+}
+
+void FiTweenPool::Stop(EiTweenPoolMatch::Type match, FName name, UObject* object)
+{
+	const int32 tweenCount = flags.Num();
+	for (int32 i = 0; i < tweenCount; i++)
+	{
+		if ((flags[i] & finished) == 0 && IsMatch(i, match, name, object))
+		{
+			EndPhase(i);
+		}
+	}
+}
+
+void FiTweenPool::SetPaused(bool pause, EiTweenPoolMatch::Type match, FName name, UObject* object)
+{
+	for (int32 i = 0; i < flags.Num(); i++)
+	{
+		if ((flags[i] & finished) == 0 && IsMatch(i, match, name, object))
+		{
+			flags[i] = pause ? (uint8)(flags[i] | paused) : (uint8)(flags[i] & ~paused);
+		}
+	}
+}
+
+bool FiTweenPool::StopById(int32 id)
+{
+	const int32* index = indicesById.Find(id);
+	if (!index || (flags[*index] & finished) != 0)
+	{
+		return false;
+	}
+
+	EndPhase(*index);
+	return true;
+}
+
+bool FiTweenPool::SetPausedById(bool pause, int32 id)
+{
+	const int32* index = indicesById.Find(id);
+	if (!index || (flags[*index] & finished) != 0)
+	{
+		return false;
+	}
+
+	flags[*index] = pause ? (uint8)(flags[*index] | paused) : (uint8)(flags[*index] & ~paused);
+	return true;
+}
+
+bool FiTweenPool::IsActiveById(int32 id) const
+{
+	const int32* index = indicesById.Find(id);
+	return index && (flags[*index] & finished) == 0;
+}
+
+int32 FiTweenPool::Num() const
+{
+	int32 tweenCount = 0;
+	for (uint8 hotFlags : flags)
+	{
+		if ((hotFlags & finished) == 0)
+		{
+			tweenCount++;
+		}
+	}
+	return tweenCount;
+}
+
+void FiTweenPool::FirstSet(int32 index, USceneComponent* target)
+{
+	FColdData& cold = coldData[index];
+	if (cold.firstSet)
+	{
+		return;
+	}
+	cold.firstSet = true;
+
+	if (!target)
+	{
+		if (cold.tieToObjectValidity)
+		{
+			EndPhase(index);
+		}
+		return;
+	}
+
+	const FVector& from = fromValues[index];
+	switch (eventTypes[index])
+	{
+	case EEventType::EventType::actorMoveFromTo:
+	case EEventType::EventType::compMoveFromTo:
+		target->SetWorldLocation(UiTween::ConstrainVector(from, target->GetComponentLocation(), cold.vectorConstraints));
+		break;
+	case EEventType::EventType::actorRotateFromTo:
+	case EEventType::EventType::compRotateFromTo:
+		target->SetWorldRotation(UiTween::ConstrainRotator(FRotator(from.X, from.Y, from.Z), target->GetComponentRotation(), cold.rotatorConstraints));
+		break;
+	default:
+		target->SetWorldScale3D(UiTween::ConstrainVector(from, target->GetComponentScale(), cold.vectorConstraints));
+		break;
+	}
+}
+
+void FiTweenPool::InterpTween(int32 index, USceneComponent* target, const FVector& value)
+{
+	FColdData& cold = coldData[index];
+
+	switch (eventTypes[index])
+	{
+	case EEventType::EventType::actorMoveFromTo:
+	case EEventType::EventType::compMoveFromTo:
+		target->SetWorldLocation(UiTween::ConstrainVector(value, target->GetComponentLocation(), cold.vectorConstraints), cold.sweep, &cold.sweepResult);
+		if (cold.sweep && cold.sweepResult.bBlockingHit)
+		{
+			cold.successfulTransform = false;
+			EndPhase(index);
+		}
+		break;
+	case EEventType::EventType::actorRotateFromTo:
+	case EEventType::EventType::compRotateFromTo:
+		target->SetWorldRotation(UiTween::ConstrainRotator(FRotator(value.X, value.Y, value.Z), target->GetComponentRotation(), cold.rotatorConstraints));
+		break;
+	default:
+		target->SetWorldScale3D(UiTween::ConstrainVector(value, target->GetComponentScale(), cold.vectorConstraints));
+		break;
+	}
+}
+
+void FiTweenPool::LastSet(int32 index, USceneComponent* target)
+{
+	FColdData& cold = coldData[index];
+	if (!cold.enforceValueTo)
+	{
+		return;
+	}
+
+	if (!target)
+	{
+		if (cold.tieToObjectValidity)
+		{
+			EndPhase(index);
+		}
+		return;
+	}
+
+	const FVector& to = toValues[index];
+	switch (eventTypes[index])
+	{
+	case EEventType::EventType::actorMoveFromTo:
+		//Only the actor move sweeps to the end, like AiTweenEvent::LastSet
+		target->SetWorldLocation(UiTween::ConstrainVector(to, target->GetComponentLocation(), cold.vectorConstraints), cold.sweep);
+		break;
+	case EEventType::EventType::compMoveFromTo:
+		target->SetWorldLocation(UiTween::ConstrainVector(to, target->GetComponentLocation(), cold.vectorConstraints));
+		break;
+	case EEventType::EventType::actorRotateFromTo:
+	case EEventType::EventType::compRotateFromTo:
+		target->SetWorldRotation(UiTween::ConstrainRotator(FRotator(to.X, to.Y, to.Z), target->GetComponentRotation(), cold.rotatorConstraints));
+		break;
+	default:
+		target->SetWorldScale3D(UiTween::ConstrainVector(to, target->GetComponentScale(), cold.vectorConstraints));
+		break;
+	}
+}
+
+void FiTweenPool::CheckLoopType(int32 index)
+{
+	const ELoopType::LoopType loopType = coldData[index].loopType;
+	if (loopType != ELoopType::LoopType::rewind && loopType != ELoopType::LoopType::pingPong)
+	{
+		EndPhase(index);
+		return;
+	}
+
+	if (loopType == ELoopType::LoopType::pingPong)
+	{
+		coldData[index].playingBackward = !coldData[index].playingBackward;
+	}
+
+	//Loop section stuff, the loop message is only sent with a maximum
+	FColdData& cold = coldData[index];
+	cold.numberOfLoopSections++;
+	if (cold.maximumLoopSections != 0)
+	{
+		if (cold.numberOfLoopSections >= cold.maximumLoopSections)
+		{
+			EndPhase(index);
+			return;
+		}
+
+		RunInterface(index, ETweenInterfaceType::TweenInterfaceType::loop);
+		if ((flags[index] & finished) != 0)
+		{
+			return;
+		}
+	}
+
+	if (loopType == ELoopType::LoopType::pingPong)
+	{
+		Swap(fromValues[index], toValues[index]);
+	}
+
+	//The first delay type never delays a loop, the full ones only delay the forward sections
+	const FColdData& loopCold = coldData[index];
+	bool loopWithDelay = true;
+	if (loopCold.delayType == EDelayType::DelayType::first)
+	{
+		loopWithDelay = false;
+	}
+	else if (loopType == ELoopType::LoopType::pingPong && loopCold.delayType != EDelayType::DelayType::firstLoop && loopCold.delayType != EDelayType::DelayType::loop)
+	{
+		loopWithDelay = !loopCold.playingBackward;
+	}
+
+	alphas[index] = 0.f;
+	if (loopWithDelay)
+	{
+		coldData[index].delayCount = 0.f;
+		flags[index] = (uint8)((flags[index] & ~tweening) | delaying);
+	}
+	else
+	{
+		flags[index] |= tweening;
+	}
+}
+
+void FiTweenPool::EndPhase(int32 index)
+{
+	if ((flags[index] & finished) != 0)
+	{
+		return;
+	}
+
+	flags[index] = (uint8)((flags[index] & ~tweening) | finished);
+	hasFinished = true;
+
+	//OnTweenComplete Interface Message
+	RunInterface(index, ETweenInterfaceType::TweenInterfaceType::complete);
+}
+
+void FiTweenPool::RunInterface(int32 index, ETweenInterfaceType::TweenInterfaceType type)
+{
+	//Copy what the messages need, a callback may add tweens and move the arrays
+	const FColdData& cold = coldData[index];
+	FTimerDynamicDelegate delegate = cold.delegates[type];
+	UObject* target = cold.interfaceTargets[type].Get();
+	AActor* actorTweening = cold.actorTweening.Get();
+	USceneComponent* componentTweening = IsActorTween(eventTypes[index]) ? nullptr : targets[index].Get();
+	const FName tweenName = cold.tweenName;
+	const float alpha = alphas[index];
+	const int32 numberOfLoopSections = cold.numberOfLoopSections;
+	const ELoopType::LoopType loopType = cold.loopType;
+	const bool playingBackward = cold.playingBackward;
+	const bool successfulTransform = cold.successfulTransform;
+	const FHitResult sweepResult = (type == ETweenInterfaceType::TweenInterfaceType::complete) ? cold.sweepResult : FHitResult();
+
+	if (delegate.IsBound())
+	{
+		delegate.Execute();
+	}
+
+	//Pooled tweens have no event operator and no data type values
+	IiTInterface* interf = Cast<IiTInterface>(target);
+	if (interf)
+	{
+		if (type == ETweenInterfaceType::TweenInterfaceType::start)
+		{
+			interf->OnTweenStartNative(nullptr, actorTweening, componentTweening, nullptr, tweenName);
+		}
+		else if (type == ETweenInterfaceType::TweenInterfaceType::update)
+		{
+			interf->OnTweenUpdateNative(nullptr, actorTweening, componentTweening, nullptr, tweenName, FDataTypeValues(), alpha);
+		}
+		else if (type == ETweenInterfaceType::TweenInterfaceType::loop)
+		{
+			interf->OnTweenLoopNative(nullptr, actorTweening, componentTweening, nullptr, tweenName, numberOfLoopSections, loopType, playingBackward);
+		}
+		else
+		{
+			interf->OnTweenCompleteNative(nullptr, actorTweening, componentTweening, nullptr, tweenName, sweepResult, successfulTransform);
+		}
+	}
+	else if (target && target->GetClass()->ImplementsInterface(UiTInterface::StaticClass()))
+	{
+		if (type == ETweenInterfaceType::TweenInterfaceType::start)
+		{
+			IiTInterface::Execute_OnTweenStart(target, nullptr, actorTweening, componentTweening, nullptr, tweenName);
+		}
+		else if (type == ETweenInterfaceType::TweenInterfaceType::update)
+		{
+			IiTInterface::Execute_OnTweenUpdate(target, nullptr, actorTweening, componentTweening, nullptr, tweenName, FDataTypeValues(), alpha);
+			IiTInterface::Execute_OnTweenTick(target, nullptr, actorTweening, componentTweening, nullptr, tweenName, alpha);
+		}
+		else if (type == ETweenInterfaceType::TweenInterfaceType::loop)
+		{
+			IiTInterface::Execute_OnTweenLoop(target, nullptr, actorTweening, componentTweening, nullptr, tweenName, numberOfLoopSections, loopType, playingBackward);
+		}
+		else
+		{
+			IiTInterface::Execute_OnTweenComplete(target, nullptr, actorTweening, componentTweening, nullptr, tweenName, sweepResult, successfulTransform);
+		}
+	}
+}
+
+bool FiTweenPool::IsMatch(int32 index, EiTweenPoolMatch::Type match, FName name, UObject* object) const
+{
+	if (match == EiTweenPoolMatch::all)
+	{
+		return true;
+	}
+	if (match == EiTweenPoolMatch::tweenName)
+	{
+		return coldData[index].tweenName == name;
+	}
+
+	UObject* tweening = nullptr;
+	if (IsActorTween(eventTypes[index]))
+	{
+		tweening = coldData[index].actorTweening.Get();
+	}
+	else
+	{
+		tweening = targets[index].Get();
+	}
+
+	if (match == EiTweenPoolMatch::objectName)
+	{
+		return tweening && tweening->GetFName() == name;
+	}
+	return tweening && tweening == object;
+}
+
+void FiTweenPool::Compact()
+{
+	if (!hasFinished)
+	{
+		return;
+	}
+	hasFinished = false;
+
+	for (int32 i = flags.Num() - 1; i >= 0; i--)
+	{
+		if ((flags[i] & finished) != 0)
+		{
+			indicesById.Remove(coldData[i].id);
+			targets.RemoveAtSwap(i, 1, false);
+			eventTypes.RemoveAtSwap(i, 1, false);
+			fromValues.RemoveAtSwap(i, 1, false);
+			toValues.RemoveAtSwap(i, 1, false);
+			alphas.RemoveAtSwap(i, 1, false);
+			durations.RemoveAtSwap(i, 1, false);
+			easeTypes.RemoveAtSwap(i, 1, false);
+			flags.RemoveAtSwap(i, 1, false);
+			coldData.RemoveAtSwap(i, 1, false);
+
+			//The last tween took the slot
+			if (i < coldData.Num())
+			{
+				indicesById.Add(coldData[i].id, i);
+			}
+		}
+	}
+}
+
+//The object the event tweens, in the order the Stop, Pause and Resume functions always checked them
+static UObject* GetTweeningObject(const AiTweenEvent* e)
+{
+	if (e->actorTweening != nullptr)
+	{
+		return e->actorTweening;
+	}
+	else if (e->componentTweening != nullptr)
+	{
+		return e->componentTweening;
+	}
+	return e->widgetTweening;
+}
+
+int32 FiTweenRegistry::Add(AiTweenEvent* e, TArray<AiTweenEvent*>& events)
+{
+	FEntry& entry = entries.Add(e);
+	entry.index = nextIndex++;
+	entry.eventSlot = events.Add(e);
+	entry.tweenName = NAME_None;
+	entry.tweenNameSlot = INDEX_NONE;
+	entry.object = nullptr;
+	entry.objectSlot = INDEX_NONE;
+	entry.objectName = NAME_None;
+	entry.objectNameSlot = INDEX_NONE;
+	eventsByIndex.Add(entry.index, e);
+
+	UpdateKeys(e);
+	return entry.index;
+}
+
+void FiTweenRegistry::UpdateKeys(AiTweenEvent* e)
+{
+	FEntry* entry = entries.Find(e);
+	if (!entry)
+	{
+		return;
+	}
+
+	const UObject* object = GetTweeningObject(e);
+	const FName objectName = object ? object->GetFName() : NAME_None;
+	if (entry->tweenNameSlot != INDEX_NONE && entry->tweenName == e->tweenName && entry->object == object && entry->objectName == objectName)
+	{
+		return;
+	}
+
+	RemoveKeys(*entry);
+
+	//Adding to a group never moves another event, the entry pointer stays valid
+	entry->tweenName = e->tweenName;
+	entry->tweenNameSlot = AddToGroup(eventsByTweenName, entry->tweenName, e);
+	entry->object = object;
+	entry->objectName = objectName;
+	if (object)
+	{
+		entry->objectSlot = AddToGroup(eventsByObject, entry->object, e);
+		entry->objectNameSlot = AddToGroup(eventsByObjectName, entry->objectName, e);
+	}
+}
+
+void FiTweenRegistry::Remove(AiTweenEvent* e, TArray<AiTweenEvent*>& events)
+{
+	FEntry* entry = entries.Find(e);
+	if (!entry)
+	{
+		return;
+	}
+
+	RemoveKeys(*entry);
+	eventsByIndex.Remove(entry->index);
+
+	//Swap the last event into the slot
+	const int32 slot = entry->eventSlot;
+	events.RemoveAtSwap(slot, 1, false);
+	if (slot < events.Num())
+	{
+		entries.FindChecked(events[slot]).eventSlot = slot;
+	}
+
+	entries.Remove(e);
+}
+
+AiTweenEvent* FiTweenRegistry::FindByIndex(int32 index) const
+{
+	AiTweenEvent* const* e = eventsByIndex.Find(index);
+	return e ? *e : nullptr;
+}
+
+static const TArray<AiTweenEvent*> noEvents;
+
+const TArray<AiTweenEvent*>& FiTweenRegistry::FindByTweenName(FName tweenName) const
+{
+	const TArray<AiTweenEvent*>* group = eventsByTweenName.Find(tweenName);
+	return group ? *group : noEvents;
+}
+
+const TArray<AiTweenEvent*>& FiTweenRegistry::FindByObject(const UObject* object) const
+{
+	const TArray<AiTweenEvent*>* group = eventsByObject.Find(object);
+	return group ? *group : noEvents;
+}
+
+const TArray<AiTweenEvent*>& FiTweenRegistry::FindByObjectName(FName objectName) const
+{
+	const TArray<AiTweenEvent*>* group = eventsByObjectName.Find(objectName);
+	return group ? *group : noEvents;
+}
+
+template<typename KeyType>
+int32 FiTweenRegistry::AddToGroup(TMap<KeyType, TArray<AiTweenEvent*>>& groups, const KeyType& key, AiTweenEvent* e)
+{
+	return groups.FindOrAdd(key).Add(e);
+}
+
+template<typename KeyType>
+void FiTweenRegistry::RemoveFromGroup(TMap<KeyType, TArray<AiTweenEvent*>>& groups, const KeyType& key, int32 slot, int32 FEntry::* slotMember)
+{
+	TArray<AiTweenEvent*>& group = groups.FindChecked(key);
+	group.RemoveAtSwap(slot, 1, false);
+	if (slot < group.Num())
+	{
+		entries.FindChecked(group[slot]).*slotMember = slot;
+	}
+	else if (group.Num() == 0)
+	{
+		//Tween names come and go with the tweens, drop the empty groups so the maps stay small
+		groups.Remove(key);
+	}
+}
+
+void FiTweenRegistry::RemoveKeys(FEntry& entry)
+{
+	if (entry.tweenNameSlot != INDEX_NONE)
+	{
+		RemoveFromGroup(eventsByTweenName, entry.tweenName, entry.tweenNameSlot, &FEntry::tweenNameSlot);
+		entry.tweenNameSlot = INDEX_NONE;
+	}
+
+	if (entry.objectSlot != INDEX_NONE)
+	{
+		RemoveFromGroup(eventsByObject, entry.object, entry.objectSlot, &FEntry::objectSlot);
+		RemoveFromGroup(eventsByObjectName, entry.objectName, entry.objectNameSlot, &FEntry::objectNameSlot);
+		entry.objectSlot = INDEX_NONE;
+		entry.objectNameSlot = INDEX_NONE;
+	}
+}
@@ -200,13 +200,296 @@ struct FDataTypeValues
 		FLinearColor linearColorCurrent = FLinearColor::Black;
 };
 
+/**
+* How finely one curve is baked into its easing table, see FiTweenEasing::BakeTables
+*/
+USTRUCT(BlueprintType)
+struct FiTweenEasingTableResolution
+{
+	GENERATED_USTRUCT_BODY()
+
+	//The ease type to bake, ignored if a custom curve is set
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Easing Tables")
+		TEnumAsByte<EEaseType::EaseType> easeType = EEaseType::EaseType::linear;
+
+	//The custom curve asset to bake, for the customCurve tweens using it
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Easing Tables")
+		UCurveFloat* customEaseTypeCurve = nullptr;
+
+	//Samples over [0, 1], below 2 the curve is left on its equation
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Easing Tables")
+		int32 resolution = 256;
+};
+
+/**
+* Everything a pooled transform tween needs, the entry points fill it the same way they fill an event actor
+*/
+struct FiTweenPoolDesc
+{
+	//One of actorMoveFromTo, actorRotateFromTo, actorScaleFromTo, compMoveFromTo, compRotateFromTo or compScaleFromTo
+	TEnumAsByte<EEventType::EventType> eventType = EEventType::EventType::actorMoveFromTo;
+
+	FName tweenName = "";
+	AActor* actorTweening = nullptr;
+	USceneComponent* componentTweening = nullptr;
+
+	//Move and scale values
+	FVector vectorFrom = FVector::ZeroVector;
+	FVector vectorTo = FVector::ZeroVector;
+
+	//Rotate values
+	FRotator rotatorFrom = FRotator::ZeroRotator;
+	FRotator rotatorTo = FRotator::ZeroRotator;
+	bool shortestPath = false;
+
+	bool enforceValueTo = true;
+	bool sweep = false;
+	bool tieToObjectValidity = true;
+	TEnumAsByte<EVectorConstraints::VectorConstraints> vectorConstraints = EVectorConstraints::VectorConstraints::none;
+	TEnumAsByte<ERotatorConstraints::RotatorConstraints> rotatorConstraints = ERotatorConstraints::RotatorConstraints::none;
+
+	float delay = 0.f;
+	TEnumAsByte<EDelayType::DelayType> delayType = EDelayType::DelayType::first;
+	TEnumAsByte<ETickType::TickType> tickType = ETickType::TickType::seconds;
+	float tickTypeValue = 5.f;
+	TEnumAsByte<EEaseType::EaseType> easeType = EEaseType::EaseType::linear;
+	UCurveFloat* customEaseTypeCurve = nullptr;
+	float punchAmplitude = 1.f;
+	TEnumAsByte<ELoopType::LoopType> loopType = ELoopType::LoopType::once;
+	int32 maximumLoopSections = 0;
+
+	UObject* onTweenStartTarget = nullptr;
+	UObject* onTweenUpdateTarget = nullptr;
+	UObject* onTweenLoopTarget = nullptr;
+	UObject* onTweenCompleteTarget = nullptr;
+	FString OnTweenStartFunctionName;
+	FString OnTweenUpdateFunctionName;
+	FString OnTweenLoopFunctionName;
+	FString OnTweenCompleteFunctionName;
+};
+
+/** Which pooled tweens a stop, pause or resume applies to */
+namespace EiTweenPoolMatch
+{
+	enum Type
+	{
+		all,
+		tweenName,
+		objectName,
+		objectReference
+	};
+}
+
+/**
+* Runs the actor and component move, rotate and scale tweens of the aux without an event actor per tween.
+* The tweens are stored as structure of arrays, the per frame values are packed in the hot arrays and walked
+* in one pass, the callbacks and loop settings live in the cold array and are only read on a state change.
+* Each tick eases all the moving tweens at once by FiTweenEasing::EvaluateGrouped and interpolates their values in bulk,
+* before the values are set and the messages sent.
+* A tween behaves like its event actor, the callbacks get no event operator.
+*/
+class SGAME_API FiTweenPool
+{
+public:
+	//Add the tween, it starts on the next tick like a spawned event actor. Returns the id of the tween, or INDEX_NONE if
+	//the target is missing
+	int32 Add(const FiTweenPoolDesc& desc, float worldToMeters);
+
+	//Advance all the tweens, the tweens added by the callbacks start on the next tick
+	void Tick(float deltaSeconds);
+
+	//Stop the matching tweens, they send the complete message like a stopped event actor
+	void Stop(EiTweenPoolMatch::Type match, FName name = NAME_None, UObject* object = nullptr);
+
+	//Pause or resume the matching tweens
+	void SetPaused(bool pause, EiTweenPoolMatch::Type match, FName name = NAME_None, UObject* object = nullptr);
+
+	//Stop the tween of the id, returns false if it already finished
+	bool StopById(int32 id);
+
+	//Pause or resume the tween of the id, returns false if it already finished
+	bool SetPausedById(bool pause, int32 id);
+
+	//Whether the tween of the id is running or paused
+	bool IsActiveById(int32 id) const;
+
+	//How many tweens are running or paused
+	int32 Num() const;
+
+private:
+	//Hot flags, one byte per tween
+	enum EHotFlags
+	{
+		tweening = 1 << 0,
+		delaying = 1 << 1,
+		paused = 1 << 2,
+		finished = 1 << 3,
+		shortestPath = 1 << 4
+	};
+
+	//Per tween state read on a state change only
+	struct FColdData
+	{
+		int32 id;
+		FName tweenName;
+		TWeakObjectPtr<AActor> actorTweening;
+		TWeakObjectPtr<UCurveFloat> customEaseTypeCurve;
+		float punchAmplitude;
+		bool enforceValueTo;
+		bool sweep;
+		bool tieToObjectValidity;
+		bool firstSet;
+		bool playingBackward;
+		bool successfulTransform;
+		TEnumAsByte<EVectorConstraints::VectorConstraints> vectorConstraints;
+		TEnumAsByte<ERotatorConstraints::RotatorConstraints> rotatorConstraints;
+		float delay;
+		float delayCount;
+		TEnumAsByte<EDelayType::DelayType> delayType;
+		TEnumAsByte<ELoopType::LoopType> loopType;
+		int32 maximumLoopSections;
+		int32 numberOfLoopSections;
+		FHitResult sweepResult;
+
+		//Start, update, loop and complete targets and named functions, by ETweenInterfaceType
+		TWeakObjectPtr<UObject> interfaceTargets[4];
+		FTimerDynamicDelegate delegates[4];
+	};
+
+	//Set the from value, on the first start of the tween
+	void FirstSet(int32 index, USceneComponent* target);
+
+	//Set the interpolated value, a location or scale, or a rotator as pitch, yaw and roll
+	void InterpTween(int32 index, USceneComponent* target, const FVector& value);
+
+	//Set the to value, on the end of each loop section
+	void LastSet(int32 index, USceneComponent* target);
+
+	//Loop or complete the tween at the end of a loop section
+	void CheckLoopType(int32 index);
+
+	//Send the complete message, the tween is removed on the next tick
+	void EndPhase(int32 index);
+
+	//Send the callbacks like AiTweenEvent::RunInterface
+	void RunInterface(int32 index, ETweenInterfaceType::TweenInterfaceType type);
+
+	//Whether the tween is one of the matching ones
+	bool IsMatch(int32 index, EiTweenPoolMatch::Type match, FName name, UObject* object) const;
+
+	//Drop the finished tweens
+	void Compact();
+
+	//Hot arrays, indexed by the tween, walked every tick
+	TArray<TWeakObjectPtr<USceneComponent>> targets;
+	TArray<uint8> eventTypes;
+	TArray<FVector> fromValues;
+	TArray<FVector> toValues;
+	TArray<float> alphas;
+	TArray<float> durations;
+	TArray<uint8> easeTypes;
+	TArray<uint8> flags;
+
+	//Cold array, indexed by the tween
+	TArray<FColdData> coldData;
+
+	//The tweens by id, the index changes when a finished tween is swapped out
+	TMap<int32, int32> indicesById;
+	int32 nextId = 0;
+
+	//Whether a tween finished since the last compaction
+	bool hasFinished = false;
+
+	//Scratch of the tick, indexed by the moving tween
+	TArray<int32> movingIndices;
+	TArray<uint8> movingEaseTypes;
+	TArray<float> nextAlphas;
+	TArray<float> easedAlphas;
+	TArray<FVector> interpValues;
+
+	//Scratch of FiTweenEasing::EvaluateGrouped
+	TArray<int32> easingIndices;
+	TArray<float> easingValues;
+};
+
 class AiTweenEvent;
-UCLASS()
+/**
+* The tween events of the aux, indexed by their index, tween name, tweening object and tweening object name. Each group
+* is an array an event is swapped out of on removal, so adding and removing an event is O(1) and a stop, pause or resume
+* only visits the matching events
+*/
+class SGAME_API FiTweenRegistry
+{
+public:
+	//Add the spawned event to the events of the aux, returns the index the ByIndex functions find it by
+	int32 Add(AiTweenEvent* e, TArray<AiTweenEvent*>& events);
+
+	//Index the event by its current tween name and tweening object, they are set after the event is spawned
+	void UpdateKeys(AiTweenEvent* e);
+
+	void Remove(AiTweenEvent* e, TArray<AiTweenEvent*>& events);
+
+	AiTweenEvent* FindByIndex(int32 index) const;
+
+	//The groups change when a tween is added or removed, copy one before stopping its tweens
+	const TArray<AiTweenEvent*>& FindByTweenName(FName tweenName) const;
+	const TArray<AiTweenEvent*>& FindByObject(const UObject* object) const;
+	const TArray<AiTweenEvent*>& FindByObjectName(FName objectName) const;
+
+private:
+	struct FEntry
+	{
+		int32 index;
+		int32 eventSlot;
+		FName tweenName;
+		int32 tweenNameSlot;
+		const UObject* object;
+		int32 objectSlot;
+		FName objectName;
+		int32 objectNameSlot;
+	};
+
+	template<typename KeyType>
+	int32 AddToGroup(TMap<KeyType, TArray<AiTweenEvent*>>& groups, const KeyType& key, AiTweenEvent* e);
+
+	template<typename KeyType>
+	void RemoveFromGroup(TMap<KeyType, TArray<AiTweenEvent*>>& groups, const KeyType& key, int32 slot, int32 FEntry::* slotMember);
+
+	void RemoveKeys(FEntry& entry);
+
+	TMap<AiTweenEvent*, FEntry> entries;
+	TMap<int32, AiTweenEvent*> eventsByIndex;
+	TMap<FName, TArray<AiTweenEvent*>> eventsByTweenName;
+	TMap<const UObject*, TArray<AiTweenEvent*>> eventsByObject;
+	TMap<FName, TArray<AiTweenEvent*>> eventsByObjectName;
+	int32 nextIndex = 0;
+};
+
+UCLASS(Config = Game)
 class SGAME_API AiTAux : public AActor
 {
 	GENERATED_BODY()
 
 public:
+	AiTAux();
+
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	virtual void Tick(float DeltaSeconds) override;
+
+	//Bake the easing tables with the settings below, and log their errors if asked to. The last bake of any world sets
+	//the tables, they are kept until every aux which baked them ends play
+	UFUNCTION(BlueprintCallable, Category = "iTween|Easing Tables")
+		void BakeEasingTables();
+
+	//Whether the aux baked the tables and releases them at EndPlay
+	bool IsRetainingEasingTables() const
+	{
+		return retainsEasingTables;
+	}
+
 	//Properties
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Debug)
 		bool performDebugOperations = false;
@@ -226,7 +509,38 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = iTween)
 		float defaultTimerInterval = 0.f;
 
+	//Run the plain actor and component move, rotate and scale tweens on the tween pool, instead of an event actor each
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = iTween)
+		bool poolTransformTweens = true;
+
+	//Ease from lookup tables baked when the aux begins play, instead of the equations and the curve assets every tick.
+	//The easing table settings are read from the game config, so the aux spawned by the tweens uses them too
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "iTween|Easing Tables")
+		bool bakeEasingTables = false;
+
+	//Samples of the tables not listed below, custom curves not listed are baked with it the first time they are used
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "iTween|Easing Tables")
+		int32 easingTableResolution = 256;
+
+	//Resolutions of single ease types and custom curve assets
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "iTween|Easing Tables")
+		TArray<FiTweenEasingTableResolution> easingTableResolutions;
+
+	//Log the max error of every baked table against its equation or curve
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "iTween|Easing Tables")
+		bool reportEasingTableErrors = true;
+
+	//The spawned events, in no particular order since a removed event is swapped out
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = iTween)
 		TArray<AiTweenEvent*> currentTweens;
+
+	//The spawned events by index, tween name and tweening object
+	FiTweenRegistry tweenRegistry;
+
+	//The pooled tweens, all advanced by the aux tick
+	FiTweenPool tweenPool;
+
+private:
+	bool retainsEasingTables = false;
 };
 
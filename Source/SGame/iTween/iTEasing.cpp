@@ -0,0 +1,1060 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGame.h"
+#include "iTweenPCH.h"
+#include "iTEasing.h"
+
+const float FiTweenEasing::pi = (22 / 7);
+
+//One curve baked over [0, 1], read with linear interpolation between the samples
+struct FiTweenEasingTable
+{
+	TArray<float> samples;
+	float lastIndex = 0.f;
+
+	bool IsBaked() const
+	{
+		return samples.Num() >= 2;
+	}
+
+	template<typename CurveType>
+	void Bake(int32 resolution, CurveType curve)
+	{
+		if (resolution < 2)
+		{
+			samples.Empty();
+			lastIndex = 0.f;
+			return;
+		}
+
+		samples.SetNumUninitialized(resolution);
+		lastIndex = (float)(resolution - 1);
+		for (int32 i = 0; i < resolution; i++)
+		{
+			samples[i] = curve(i / lastIndex);
+		}
+	}
+
+	//The value must be in [0, 1]
+	FORCEINLINE float Sample(float value) const
+	{
+		const float position = value * lastIndex;
+		const int32 index = FMath::Min((int32)position, samples.Num() - 2);
+		return FMath::Lerp(samples[index], samples[index + 1], position - index);
+	}
+};
+
+//The tables of the ease types, customCurve and linear are never baked
+static FiTweenEasingTable easeTables[FiTweenEasing::easeTypeCount];
+
+//The tables of the custom curve assets, a curve listed with a resolution below 2 is kept with an empty table
+static TMap<TWeakObjectPtr<UCurveFloat>, FiTweenEasingTable> curveTables;
+
+static bool tablesBaked = false;
+static int32 defaultCurveResolution = 0;
+static int32 tableUserCount = 0;
+
+static const FiTweenEasingTable* FindOrBakeCurveTable(UCurveFloat* customEaseTypeCurve)
+{
+	FiTweenEasingTable* table = curveTables.Find(customEaseTypeCurve);
+	if (table == nullptr)
+	{
+		table = &curveTables.Add(customEaseTypeCurve);
+		table->Bake(defaultCurveResolution, [customEaseTypeCurve](float value) { return customEaseTypeCurve->GetFloatValue(value); });
+	}
+	return table->IsBaked() ? table : nullptr;
+}
+
+float FiTweenEasing::Evaluate(EEaseType::EaseType easeType, float value, UCurveFloat* customEaseTypeCurve, float punchAmplitude)
+{
+	if (tablesBaked && value >= 0.f && value <= 1.f)
+	{
+		if (easeType == EEaseType::EaseType::customCurve)
+		{
+			if (customEaseTypeCurve)
+			{
+				if (const FiTweenEasingTable* table = FindOrBakeCurveTable(customEaseTypeCurve))
+				{
+					return table->Sample(value);
+				}
+			}
+		}
+		else if (easeType < easeTypeCount && easeTables[easeType].IsBaked())
+		{
+			//punch is baked with an amplitude of 1
+			const float eased = easeTables[easeType].Sample(value);
+			return (easeType == EEaseType::EaseType::punch) ? punchAmplitude * eased : eased;
+		}
+	}
+
+	return EvaluateAnalytic(easeType, value, customEaseTypeCurve, punchAmplitude);
+}
+
+void FiTweenEasing::BakeTables(int32 defaultResolution, const TArray<FiTweenEasingTableResolution>& resolutions)
+{
+	ClearTables();
+
+	int32 easeResolutions[easeTypeCount];
+	for (int32 easeType = 0; easeType < easeTypeCount; easeType++)
+	{
+		easeResolutions[easeType] = defaultResolution;
+	}
+
+	for (const FiTweenEasingTableResolution& resolution : resolutions)
+	{
+		if (resolution.customEaseTypeCurve)
+		{
+			UCurveFloat* curve = resolution.customEaseTypeCurve;
+			curveTables.FindOrAdd(curve).Bake(resolution.resolution, [curve](float value) { return curve->GetFloatValue(value); });
+		}
+		else if (resolution.easeType < easeTypeCount)
+		{
+			easeResolutions[resolution.easeType] = resolution.resolution;
+		}
+	}
+
+	for (int32 easeType = 0; easeType < easeTypeCount; easeType++)
+	{
+		if (easeType != EEaseType::EaseType::linear && easeType != EEaseType::EaseType::customCurve)
+		{
+			easeTables[easeType].Bake(easeResolutions[easeType], [easeType](float value) { return EvaluateAnalytic((EEaseType::EaseType)easeType, value); });
+		}
+	}
+
+	defaultCurveResolution = defaultResolution;
+	tablesBaked = true;
+}
+
+void FiTweenEasing::ClearTables()
+{
+	for (FiTweenEasingTable& table : easeTables)
+	{
+		table.samples.Empty();
+		table.lastIndex = 0.f;
+	}
+	curveTables.Empty();
+	defaultCurveResolution = 0;
+	tablesBaked = false;
+}
+
+bool FiTweenEasing::AreTablesBaked()
+{
+	return tablesBaked;
+}
+
+void FiTweenEasing::RetainTables()
+{
+	tableUserCount++;
+}
+
+void FiTweenEasing::ReleaseTables()
+{
+	check(tableUserCount > 0);
+	tableUserCount--;
+	if (tableUserCount == 0)
+	{
+		ClearTables();
+	}
+}
+
+bool FiTweenEasing::AreTablesRetained()
+{
+	return tableUserCount > 0;
+}
+
+template<typename CurveType>
+static FiTweenEasingTableError MeasureTableError(const FString& name, const FiTweenEasingTable& table, int32 testsPerSample, CurveType curve)
+{
+	FiTweenEasingTableError error;
+	error.name = name;
+	error.resolution = table.samples.Num();
+
+	const int32 testCount = (table.samples.Num() - 1) * testsPerSample + 1;
+	double errorSum = 0;
+	for (int32 i = 0; i < testCount; i++)
+	{
+		const float value = (float)i / (testCount - 1);
+		const float difference = FMath::Abs(table.Sample(value) - curve(value));
+		errorSum += difference;
+		if (difference > error.maxError)
+		{
+			error.maxError = difference;
+			error.maxErrorAlpha = value;
+		}
+	}
+	error.meanError = (float)(errorSum / testCount);
+	return error;
+}
+
+void FiTweenEasing::GetTableErrors(TArray<FiTweenEasingTableError>& outErrors, int32 testsPerSample)
+{
+	outErrors.Reset();
+	testsPerSample = FMath::Max(testsPerSample, 1);
+
+	const UEnum* easeTypeEnum = FindObject<UEnum>(ANY_PACKAGE, TEXT("EEaseType"));
+	for (int32 easeType = 0; easeType < easeTypeCount; easeType++)
+	{
+		if (easeTables[easeType].IsBaked())
+		{
+			const FString name = easeTypeEnum ? easeTypeEnum->GetNameStringByIndex(easeType) : FString::FromInt(easeType);
+			outErrors.Add(MeasureTableError(name, easeTables[easeType], testsPerSample, [easeType](float value) { return EvaluateAnalytic((EEaseType::EaseType)easeType, value); }));
+		}
+	}
+
+	for (const TPair<TWeakObjectPtr<UCurveFloat>, FiTweenEasingTable>& curveTable : curveTables)
+	{
+		UCurveFloat* curve = curveTable.Key.Get();
+		if (curve && curveTable.Value.IsBaked())
+		{
+			outErrors.Add(MeasureTableError(curve->GetName(), curveTable.Value, testsPerSample, [curve](float value) { return curve->GetFloatValue(value); }));
+		}
+	}
+}
+
+float FiTweenEasing::EvaluateAnalytic(EEaseType::EaseType easeType, float value, UCurveFloat* customEaseTypeCurve, float punchAmplitude)
+{
+	//Big thanks to Bob Berkebile at PixelPlacement for the original iTween equation interpretations. Unlike the rest of 
+	//iTween for UE4, Easetype equations are taken almost 100% verbatim from iTween source code (with Bob's permission, 
+	//of course).
+
+	//TERMS OF USE - EASING EQUATIONS Open source under the BSD License. Copyright(c)2001 Robert PennerAll rights reserved. 
+
+	//Redistribution and use in source and binary forms, with or without modification, are permitted provided that the 
+	//following conditions are met : Redistributions of source code must retain the above copyright notice, this list 
+	//of conditions and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+	//notice, this list of conditions and the following disclaimer in the documentation and / or other materials 
+	//provided with the distribution. Neither the name of the author nor the names of contributors may be used to endorse 
+	//or promote products derived from this software without specific prior written permission. THIS SOFTWARE IS PROVIDED 
+	//BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED 
+	//TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL 
+	//THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR 
+	//CONSEQUENTIAL DAMAGES(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, 
+	//OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
+	//LIABILITY, OR TORT(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+	//ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+	float start = 0.f;
+	float end = 1.f;
+
+	switch (easeType)
+	{
+
+	case EEaseType::EaseType::linear:
+		return value;
+
+	case EEaseType::EaseType::spring:
+	{
+				   value = FMath::Clamp<float>(value, start, end);
+				   value = (FMath::Sin(value * pi * (0.2f + 2.5f * value * value * value)) * FMath::Pow(1.f - value, 2.2f) + value) * (1.f + (1.2f * (1.f - value)));
+				   return start + (end - start) * value;
+	}
+
+
+	case EEaseType::EaseType::easeInQuadratic:
+	{
+							end -= start;
+							return end * value * value + start;
+	}
+
+
+	case EEaseType::EaseType::easeOutQuadratic:
+	{
+							 end -= start;
+							 return -end * value * (value - 2) + start;
+	}
+
+
+	case EEaseType::EaseType::easeInAndOutQuadratic:
+	{
+								  value /= 0.5f;
+								  end -= start;
+								  if (value < 1) return end / 2 * value * value + start;
+								  value--;
+								  return -end / 2 * (value * (value - 2) - 1) + start;
+	}
+
+
+	case EEaseType::EaseType::easeInCubic:
+	{
+						end -= start;
+						return end * value * value * value + start;
+	}
+
+
+	case EEaseType::EaseType::easeOutCubic:
+	{
+						 value--;
+						 end -= start;
+						 return end * (value * value * value + 1) + start;
+	}
+
+
+	case EEaseType::EaseType::easeInAndOutCubic:
+	{
+							  value /= 0.5f;
+							  end -= start;
+							  if (value < 1) return end / 2 * value * value * value + start;
+							  value -= 2;
+							  return end / 2 * (value * value * value + 2) + start;
+	}
+
+
+	case EEaseType::EaseType::easeInQuartic:
+	{
+						  end -= start;
+						  return end * value * value * value * value + start;
+	}
+
+
+	case EEaseType::EaseType::easeOutQuartic:
+	{
+						   value--;
+						   end -= start;
+						   return -end * (value * value * value * value - 1) + start;
+	}
+
+
+	case EEaseType::EaseType::easeInAndOutQuartic:
+	{
+								value /= 0.5f;
+								end -= start;
+								if (value < 1) return end / 2 * value * value * value * value + start;
+								value -= 2;
+								return -end / 2 * (value * value * value * value - 2) + start;
+	}
+
+
+	case EEaseType::EaseType::easeInQuintic:
+	{
+						  end -= start;
+						  return end * value * value * value * value * value + start;
+	}
+
+
+	case EEaseType::EaseType::easeOutQuintic:
+	{
+						   value--;
+						   end -= start;
+						   return end * (value * value * value * value * value + 1) + start;
+	}
+
+
+	case EEaseType::EaseType::easeInAndOutQuintic:
+	{
+								value /= 0.5f;
+								end -= start;
+								if (value < 1) return end / 2 * value * value * value * value * value + start;
+								value -= 2;
+								return end / 2 * (value * value * value * value * value + 2) + start;
+	}
+
+
+	case EEaseType::EaseType::easeInSine:
+	{
+					   end -= start;
+					   return -end * FMath::Cos(value / 1 * (pi / 2)) + end + start;
+	}
+
+
+	case EEaseType::EaseType::easeOutSine:
+	{
+						end -= start;
+						return end * FMath::Sin(value / 1 * (pi / 2)) + start;
+	}
+
+
+	case EEaseType::EaseType::easeInAndOutSine:
+	{
+							 end -= start;
+							 return -end / 2 * (FMath::Cos(pi * value / 1) - 1) + start;
+	}
+
+
+	case EEaseType::EaseType::easeInExponential:
+	{
+							  end -= start;
+							  return end * FMath::Pow(2, 10 * (value / 1 - 1)) + start;
+	}
+
+
+	case EEaseType::EaseType::easeOutExponential:
+	{
+							   end -= start;
+							   return end * (-FMath::Pow(2, -10 * value / 1) + 1) + start;
+	}
+
+
+	case EEaseType::EaseType::easeInAndOutExponential:
+	{
+									value /= 0.5f;
+									end -= start;
+									if (value < 1) return end / 2 * FMath::Pow(2, 10 * (value - 1)) + start;
+									value--;
+									return end / 2 * (-FMath::Pow(2, -10 * value) + 2) + start;
+	}
+
+
+	case EEaseType::EaseType::easeInCircular:
+	{
+						   end -= start;
+						   return -end * (FMath::Sqrt(1 - value * value) - 1) + start;
+	}
+
+
+	case EEaseType::EaseType::easeOutCircular:
+	{
+							value--;
+							end -= start;
+							return end * FMath::Sqrt(1 - value * value) + start;
+	}
+
+
+	case EEaseType::EaseType::easeInAndOutCircular:
+	{
+								 value /= 0.5f;
+								 end -= start;
+								 if (value < 1) return -end / 2 * (FMath::Sqrt(1 - value * value) - 1) + start;
+								 value -= 2;
+								 return end / 2 * (FMath::Sqrt(1 - value * value) + 1) + start;
+	}
+
+
+	case EEaseType::EaseType::easeInBounce:
+		return EaseInBounce(value);
+
+	case EEaseType::EaseType::easeOutBounce:
+		return EaseOutBounce(value);
+
+
+	case EEaseType::EaseType::easeInAndOutBounce:
+		return EaseInOutBounce(value);
+
+	case EEaseType::EaseType::easeInBack:
+	{
+					   end -= start;
+					   value /= 1;
+					   float s = 1.70158f;
+					   return end * (value)* value * ((s + 1) * value - s) + start;
+	}
+
+
+	case EEaseType::EaseType::easeOutBack:
+	{
+						float s = 1.70158f;
+						end -= start;
+						value = (value / 1) - 1;
+						return end * ((value)* value * ((s + 1) * value + s) + 1) + start;
+	}
+
+
+	case EEaseType::EaseType::easeInAndOutBack:
+	{
+							 float s = 1.70158f;
+							 end -= start;
+							 value /= 0.5f;
+							 if ((value) < 1){
+								 s *= (1.525f);
+								 return end / 2 * (value * value * (((s)+1) * value - s)) + start;
+							 }
+							 value -= 2;
+							 s *= (1.525f);
+							 return end / 2 * ((value)* value * (((s)+1) * value + s) + 2) + start;
+	}
+
+
+	case EEaseType::EaseType::punch:
+	{
+				  float s = 9;
+				  if (value == 0){
+					  return 0;
+				  }
+				  if (value == 1){
+					  return 0;
+				  }
+				  float period = 1 * 0.3f;
+				  s = period / (2 * pi) * FMath::Asin(0);
+				  return (punchAmplitude * FMath::Pow(2, -10 * value) * FMath::Sin((value * 1 - s) * (2 * pi) / period));
+	}
+
+
+	case EEaseType::EaseType::easeInElastic:
+	{
+						  end -= start;
+
+						  float d = 1.f;
+						  float p = d * 0.3f;
+						  float s = 0;
+						  float a = 0;
+
+						  if (value == 0) return start;
+
+						  if ((value /= d) == 1) return start + end;
+
+						  if (a == 0.f || a < FMath::Abs(end)){
+							  a = end;
+							  s = p / 4;
+						  }
+						  else{
+							  s = p / (2 * pi) * FMath::Asin(end / a);
+						  }
+						  value -= 1;
+						  return -(a * FMath::Pow(2, 10 * (value)) * FMath::Sin((value * d - s) * (2 * pi) / p)) + start;
+	}
+
+
+	case EEaseType::EaseType::easeOutElastic:
+		//Thank you to rafael.marteleto for fixing this as a port over from Pedro's UnityTween
+	{
+						   end -= start;
+
+						   float d = 1.f;
+						   float p = d * 0.3f;
+						   float s = 0;
+						   float a = 0;
+
+						   if (value == 0) return start;
+
+						   if ((value /= d) == 1) return start + end;
+
+						   if (a == 0.f || a < FMath::Abs(end)){
+							   a = end;
+							   s = p / 4;
+						   }
+						   else{
+							   s = p / (2 * pi) * FMath::Asin(end / a);
+						   }
+
+						   return (a * FMath::Pow(2, -10 * value) * FMath::Sin((value * d - s) * (2 * pi) / p) + end + start);
+	}
+
+
+	case EEaseType::EaseType::easeInAndOutElastic:
+	{
+								end -= start;
+
+								float d = 1.f;
+								float p = d * 0.3f;
+								float s = 0;
+								float a = 0;
+
+								if (value == 0) return start;
+
+								if ((value /= d / 2) == 2) return start + end;
+
+								if (a == 0.f || a < FMath::Abs(end)){
+									a = end;
+									s = p / 4;
+								}
+								else{
+									s = p / (2 * pi) * FMath::Asin(end / a);
+								}
+
+#if !PLATFORM_IOS && !PLATFORM_ANDROID
+								if (value < 1) return -0.5f * (a * FMath::Pow(2, 10 * (value -= 1)) * FMath::Sin((value * d - s) * (2 * pi) / p)) + start;
+								return a * FMath::Pow(2, -10 * (value -= 1)) * FMath::Sin((value * d - s) * (2 * pi) / p) * 0.5f + end + start;
+#else //This is still broken on mobile, but at least you'll be able to build. Instead, try using ease in elastic then ease out elastic.
+								value = value - 1;
+								if (value < 1) return -0.5f * (a * FMath::Pow(2, 10 * (value)) * FMath::Sin((value * d - s) * (2 * pi) / p)) + start;
+								return a * FMath::Pow(2, -10 * (value)) * FMath::Sin((value * d - s) * (2 * pi) / p) * 0.5f + end + start;
+#endif
+	}
+
+	case EEaseType::EaseType::customCurve:
+	{
+						if (customEaseTypeCurve)
+						{
+							return customEaseTypeCurve->GetFloatValue(value);
+						}
+						else
+						{
+							return value;
+						}
+	}
+	default:
+		return value;
+	}
+}
+
+float FiTweenEasing::EaseInBounce(float value)
+{
+	float start = 0.f;
+	float end = 1.f;
+	end -= start;
+	float d = 1.f;
+	return end - EaseOutBounce(d - value) + start;
+}
+
+float FiTweenEasing::EaseOutBounce(float value)
+{
+	float start = 0.f;
+	float end = 1.f;
+	value /= 1.f;
+	end -= start;
+	if (value < (1 / 2.75f)){
+		return end * (7.5625f * value * value) + start;
+	}
+	else if (value < (2 / 2.75f)){
+		value -= (1.5f / 2.75f);
+		return end * (7.5625f * (value)* value + 0.75f) + start;
+	}
+	else if (value < (2.5 / 2.75)){
+		value -= (2.25f / 2.75f);
+		return end * (7.5625f * (value)* value + 0.9375f) + start;
+	}
+	else{
+		value -= (2.625f / 2.75f);
+		return end * (7.5625f * (value)* value + 0.984375f) + start;
+	}
+}
+
+float FiTweenEasing::EaseInOutBounce(float value)
+{
+	float start = 0.f;
+	float end = 1.f;
+	end -= start;
+	float d = 1.f;
+	if (value < d / 2)
+	{
+		return EaseInBounce(value *= 2) * 0.5f + start;
+	}
+	else
+	{
+		return EaseOutBounce(value * 2 - d) * 0.5f + end*0.5f + start;
+	}
+}
+
+//Vector terms of the equations, each lane holds the alpha of one tween
+
+static FORCEINLINE VectorRegister EaseSin(const VectorRegister& value)
+{
+	VectorRegister sine, cosine;
+	VectorSinCos(&sine, &cosine, &value);
+	return sine;
+}
+
+static FORCEINLINE VectorRegister EaseCos(const VectorRegister& value)
+{
+	VectorRegister sine, cosine;
+	VectorSinCos(&sine, &cosine, &value);
+	return cosine;
+}
+
+//VectorPow runs per lane in this engine version, the rest of each equation stays in the registers
+static FORCEINLINE VectorRegister EaseExp2(const VectorRegister& value)
+{
+	return VectorPow(VectorSetFloat1(2.f), value);
+}
+
+//Square root of a value in [0, 1], zero stays zero
+static FORCEINLINE VectorRegister EaseSqrt(const VectorRegister& value)
+{
+	const VectorRegister clamped = VectorMax(value, VectorZero());
+	return VectorMultiply(clamped, VectorReciprocalSqrtAccurate(VectorMax(clamped, VectorSetFloat1(1e-30f))));
+}
+
+//value < limit
+static FORCEINLINE VectorRegister EaseLess(const VectorRegister& value, float limit)
+{
+	return VectorCompareGT(VectorSetFloat1(limit), value);
+}
+
+static FORCEINLINE VectorRegister EaseOutBounce(const VectorRegister& value)
+{
+	const VectorRegister bounce = VectorSetFloat1(7.5625f);
+	VectorRegister offset = VectorSubtract(value, VectorSetFloat1(2.625f / 2.75f));
+	VectorRegister result = VectorMultiplyAdd(VectorMultiply(bounce, offset), offset, VectorSetFloat1(0.984375f));
+
+	offset = VectorSubtract(value, VectorSetFloat1(2.25f / 2.75f));
+	result = VectorSelect(EaseLess(value, 2.5f / 2.75f), VectorMultiplyAdd(VectorMultiply(bounce, offset), offset, VectorSetFloat1(0.9375f)), result);
+
+	offset = VectorSubtract(value, VectorSetFloat1(1.5f / 2.75f));
+	result = VectorSelect(EaseLess(value, 2 / 2.75f), VectorMultiplyAdd(VectorMultiply(bounce, offset), offset, VectorSetFloat1(0.75f)), result);
+
+	return VectorSelect(EaseLess(value, 1 / 2.75f), VectorMultiply(VectorMultiply(bounce, value), value), result);
+}
+
+//Run the kernel over the values, the last register is padded with zeros and only its used lanes are written back
+template<typename KernelType>
+static FORCEINLINE void RunEaseKernel(const float* values, float* outEased, int32 count, KernelType kernel)
+{
+	int32 i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		VectorStore(kernel(VectorLoad(values + i)), outEased + i);
+	}
+
+	if (i < count)
+	{
+		float tail[4] = { 0.f, 0.f, 0.f, 0.f };
+		FMemory::Memcpy(tail, values + i, (count - i) * sizeof(float));
+		VectorStore(kernel(VectorLoad(tail)), tail);
+		FMemory::Memcpy(outEased + i, tail, (count - i) * sizeof(float));
+	}
+}
+
+void FiTweenEasing::EvaluateGrouped(const uint8* easeTypes, const float* values, float* outEased, int32 count, TArray<int32>& scratchIndices, TArray<float>& scratchValues)
+{
+	//Counting sort of the alphas by ease type, an unknown type eases linear like Evaluate
+	int32 groupStarts[easeTypeCount + 1] = { 0 };
+	for (int32 i = 0; i < count; i++)
+	{
+		const int32 easeType = (easeTypes[i] < easeTypeCount) ? easeTypes[i] : EEaseType::EaseType::linear;
+		groupStarts[easeType + 1]++;
+	}
+	for (int32 easeType = 0; easeType < easeTypeCount; easeType++)
+	{
+		groupStarts[easeType + 1] += groupStarts[easeType];
+	}
+
+	//The sorted values are eased in place, in the second half of the scratch
+	scratchIndices.SetNumUninitialized(count, false);
+	scratchValues.SetNumUninitialized(count * 2, false);
+	float* sortedValues = scratchValues.GetData();
+	float* sortedEased = sortedValues + count;
+
+	int32 groupCursors[easeTypeCount];
+	FMemory::Memcpy(groupCursors, groupStarts, sizeof(groupCursors));
+	for (int32 i = 0; i < count; i++)
+	{
+		const int32 easeType = (easeTypes[i] < easeTypeCount) ? easeTypes[i] : EEaseType::EaseType::linear;
+		const int32 sortedIndex = groupCursors[easeType]++;
+		scratchIndices[sortedIndex] = i;
+		sortedValues[sortedIndex] = values[i];
+	}
+
+	for (int32 easeType = 0; easeType < easeTypeCount; easeType++)
+	{
+		const int32 groupCount = groupStarts[easeType + 1] - groupStarts[easeType];
+		if (groupCount > 0)
+		{
+			EvaluateBatch((EEaseType::EaseType)easeType, sortedValues + groupStarts[easeType], sortedEased + groupStarts[easeType], groupCount);
+		}
+	}
+
+	for (int32 sortedIndex = 0; sortedIndex < count; sortedIndex++)
+	{
+		outEased[scratchIndices[sortedIndex]] = sortedEased[sortedIndex];
+	}
+}
+
+void FiTweenEasing::EvaluateBatch(EEaseType::EaseType easeType, const float* values, float* outEased, int32 count)
+{
+	if (easeType < easeTypeCount && easeTables[easeType].IsBaked())
+	{
+		const FiTweenEasingTable& table = easeTables[easeType];
+		for (int32 i = 0; i < count; i++)
+		{
+			outEased[i] = table.Sample(FMath::Clamp(values[i], 0.f, 1.f));
+		}
+		return;
+	}
+
+	//The same equations as Evaluate with start 0 and end 1, the two branch ones select per lane
+	const VectorRegister one = VectorOne();
+	const VectorRegister two = VectorSetFloat1(2.f);
+	const VectorRegister half = VectorSetFloat1(0.5f);
+
+	switch (easeType)
+	{
+	case EEaseType::EaseType::spring:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			value = VectorMin(VectorMax(value, VectorZero()), one);
+			const VectorRegister cube = VectorMultiply(VectorMultiply(value, value), value);
+			const VectorRegister angle = VectorMultiply(VectorMultiply(value, VectorSetFloat1(pi)), VectorMultiplyAdd(VectorSetFloat1(2.5f), cube, VectorSetFloat1(0.2f)));
+			const VectorRegister rest = VectorSubtract(one, value);
+			const VectorRegister wobble = VectorMultiplyAdd(EaseSin(angle), VectorPow(rest, VectorSetFloat1(2.2f)), value);
+			return VectorMultiply(wobble, VectorMultiplyAdd(VectorSetFloat1(1.2f), rest, one));
+		});
+		break;
+
+	case EEaseType::EaseType::easeInQuadratic:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			return VectorMultiply(value, value);
+		});
+		break;
+
+	case EEaseType::EaseType::easeOutQuadratic:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			return VectorNegate(VectorMultiply(value, VectorSubtract(value, two)));
+		});
+		break;
+
+	case EEaseType::EaseType::easeInAndOutQuadratic:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			value = VectorMultiply(value, two);
+			const VectorRegister first = VectorMultiply(VectorMultiply(half, value), value);
+			const VectorRegister offset = VectorSubtract(value, one);
+			const VectorRegister second = VectorMultiply(VectorNegate(half), VectorSubtract(VectorMultiply(offset, VectorSubtract(offset, two)), one));
+			return VectorSelect(EaseLess(value, 1.f), first, second);
+		});
+		break;
+
+	case EEaseType::EaseType::easeInCubic:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			return VectorMultiply(VectorMultiply(value, value), value);
+		});
+		break;
+
+	case EEaseType::EaseType::easeOutCubic:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			value = VectorSubtract(value, one);
+			return VectorMultiplyAdd(VectorMultiply(value, value), value, one);
+		});
+		break;
+
+	case EEaseType::EaseType::easeInAndOutCubic:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			value = VectorMultiply(value, two);
+			const VectorRegister offset = VectorSelect(EaseLess(value, 1.f), value, VectorSubtract(value, two));
+			const VectorRegister cube = VectorMultiply(VectorMultiply(offset, offset), offset);
+			return VectorSelect(EaseLess(value, 1.f), VectorMultiply(half, cube), VectorMultiply(half, VectorAdd(cube, two)));
+		});
+		break;
+
+	case EEaseType::EaseType::easeInQuartic:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			const VectorRegister square = VectorMultiply(value, value);
+			return VectorMultiply(square, square);
+		});
+		break;
+
+	case EEaseType::EaseType::easeOutQuartic:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			value = VectorSubtract(value, one);
+			const VectorRegister square = VectorMultiply(value, value);
+			return VectorSubtract(one, VectorMultiply(square, square));
+		});
+		break;
+
+	case EEaseType::EaseType::easeInAndOutQuartic:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			value = VectorMultiply(value, two);
+			const VectorRegister offset = VectorSelect(EaseLess(value, 1.f), value, VectorSubtract(value, two));
+			const VectorRegister square = VectorMultiply(offset, offset);
+			const VectorRegister quartic = VectorMultiply(square, square);
+			return VectorSelect(EaseLess(value, 1.f), VectorMultiply(half, quartic), VectorMultiply(VectorNegate(half), VectorSubtract(quartic, two)));
+		});
+		break;
+
+	case EEaseType::EaseType::easeInQuintic:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			const VectorRegister square = VectorMultiply(value, value);
+			return VectorMultiply(VectorMultiply(square, square), value);
+		});
+		break;
+
+	case EEaseType::EaseType::easeOutQuintic:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			value = VectorSubtract(value, one);
+			const VectorRegister square = VectorMultiply(value, value);
+			return VectorMultiplyAdd(VectorMultiply(square, square), value, one);
+		});
+		break;
+
+	case EEaseType::EaseType::easeInAndOutQuintic:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			value = VectorMultiply(value, two);
+			const VectorRegister offset = VectorSelect(EaseLess(value, 1.f), value, VectorSubtract(value, two));
+			const VectorRegister square = VectorMultiply(offset, offset);
+			const VectorRegister quintic = VectorMultiply(VectorMultiply(square, square), offset);
+			return VectorSelect(EaseLess(value, 1.f), VectorMultiply(half, quintic), VectorMultiply(half, VectorAdd(quintic, two)));
+		});
+		break;
+
+	case EEaseType::EaseType::easeInSine:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			return VectorSubtract(one, EaseCos(VectorMultiply(value, VectorSetFloat1(pi / 2))));
+		});
+		break;
+
+	case EEaseType::EaseType::easeOutSine:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			return EaseSin(VectorMultiply(value, VectorSetFloat1(pi / 2)));
+		});
+		break;
+
+	case EEaseType::EaseType::easeInAndOutSine:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			return VectorMultiply(VectorNegate(half), VectorSubtract(EaseCos(VectorMultiply(value, VectorSetFloat1(pi))), one));
+		});
+		break;
+
+	case EEaseType::EaseType::easeInExponential:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			return EaseExp2(VectorMultiply(VectorSetFloat1(10.f), VectorSubtract(value, one)));
+		});
+		break;
+
+	case EEaseType::EaseType::easeOutExponential:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			return VectorSubtract(one, EaseExp2(VectorMultiply(VectorSetFloat1(-10.f), value)));
+		});
+		break;
+
+	case EEaseType::EaseType::easeInAndOutExponential:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			//One power per lane, the exponent of the lane's half
+			value = VectorMultiply(value, two);
+			const VectorRegister firstHalf = EaseLess(value, 1.f);
+			const VectorRegister offset = VectorMultiply(VectorSetFloat1(10.f), VectorSubtract(value, one));
+			const VectorRegister power = EaseExp2(VectorSelect(firstHalf, offset, VectorNegate(offset)));
+			return VectorSelect(firstHalf, VectorMultiply(half, power), VectorMultiply(half, VectorSubtract(two, power)));
+		});
+		break;
+
+	case EEaseType::EaseType::easeInCircular:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			return VectorSubtract(one, EaseSqrt(VectorSubtract(one, VectorMultiply(value, value))));
+		});
+		break;
+
+	case EEaseType::EaseType::easeOutCircular:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			value = VectorSubtract(value, one);
+			return EaseSqrt(VectorSubtract(one, VectorMultiply(value, value)));
+		});
+		break;
+
+	case EEaseType::EaseType::easeInAndOutCircular:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			value = VectorMultiply(value, two);
+			const VectorRegister firstHalf = EaseLess(value, 1.f);
+			const VectorRegister offset = VectorSelect(firstHalf, value, VectorSubtract(value, two));
+			const VectorRegister root = EaseSqrt(VectorSubtract(one, VectorMultiply(offset, offset)));
+			return VectorSelect(firstHalf, VectorMultiply(VectorNegate(half), VectorSubtract(root, one)), VectorMultiply(half, VectorAdd(root, one)));
+		});
+		break;
+
+	case EEaseType::EaseType::easeInBounce:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			return VectorSubtract(one, EaseOutBounce(VectorSubtract(one, value)));
+		});
+		break;
+
+	case EEaseType::EaseType::easeOutBounce:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			return EaseOutBounce(value);
+		});
+		break;
+
+	case EEaseType::EaseType::easeInAndOutBounce:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			//One bounce per lane, the in half bounces out backwards
+			const VectorRegister firstHalf = EaseLess(value, 0.5f);
+			value = VectorMultiply(value, two);
+			const VectorRegister bounce = EaseOutBounce(VectorSelect(firstHalf, VectorSubtract(one, value), VectorSubtract(value, one)));
+			return VectorSelect(firstHalf, VectorMultiply(VectorSubtract(one, bounce), half), VectorMultiplyAdd(bounce, half, half));
+		});
+		break;
+
+	case EEaseType::EaseType::easeInBack:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			const float s = 1.70158f;
+			return VectorMultiply(VectorMultiply(value, value), VectorSubtract(VectorMultiply(VectorSetFloat1(s + 1), value), VectorSetFloat1(s)));
+		});
+		break;
+
+	case EEaseType::EaseType::easeOutBack:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			const float s = 1.70158f;
+			value = VectorSubtract(value, one);
+			return VectorMultiplyAdd(VectorMultiply(value, value), VectorMultiplyAdd(VectorSetFloat1(s + 1), value, VectorSetFloat1(s)), one);
+		});
+		break;
+
+	case EEaseType::EaseType::easeInAndOutBack:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			const float s = 1.70158f * 1.525f;
+			value = VectorMultiply(value, two);
+			const VectorRegister firstHalf = EaseLess(value, 1.f);
+			const VectorRegister offset = VectorSelect(firstHalf, value, VectorSubtract(value, two));
+			const VectorRegister sign = VectorSelect(firstHalf, VectorNegate(one), one);
+			const VectorRegister curve = VectorMultiply(VectorMultiply(offset, offset), VectorMultiplyAdd(VectorSetFloat1(s + 1), offset, VectorMultiply(sign, VectorSetFloat1(s))));
+			return VectorSelect(firstHalf, VectorMultiply(half, curve), VectorMultiply(half, VectorAdd(curve, two)));
+		});
+		break;
+
+	case EEaseType::EaseType::punch:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			const float period = 1 * 0.3f;
+			const VectorRegister ends = VectorBitwiseOr(VectorCompareEQ(value, VectorZero()), VectorCompareEQ(value, one));
+			const VectorRegister result = VectorMultiply(EaseExp2(VectorMultiply(VectorSetFloat1(-10.f), value)), EaseSin(VectorMultiply(value, VectorSetFloat1((2 * pi) / period))));
+			return VectorSelect(ends, VectorZero(), result);
+		});
+		break;
+
+	case EEaseType::EaseType::easeInElastic:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			const float period = 1 * 0.3f;
+			const VectorRegister offset = VectorSubtract(value, one);
+			const VectorRegister wave = EaseSin(VectorMultiply(VectorSubtract(offset, VectorSetFloat1(period / 4)), VectorSetFloat1((2 * pi) / period)));
+			const VectorRegister result = VectorNegate(VectorMultiply(EaseExp2(VectorMultiply(VectorSetFloat1(10.f), offset)), wave));
+			return VectorSelect(VectorCompareEQ(value, VectorZero()), VectorZero(), VectorSelect(VectorCompareEQ(value, one), one, result));
+		});
+		break;
+
+	case EEaseType::EaseType::easeOutElastic:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			const float period = 1 * 0.3f;
+			const VectorRegister wave = EaseSin(VectorMultiply(VectorSubtract(value, VectorSetFloat1(period / 4)), VectorSetFloat1((2 * pi) / period)));
+			const VectorRegister result = VectorMultiplyAdd(EaseExp2(VectorMultiply(VectorSetFloat1(-10.f), value)), wave, one);
+			return VectorSelect(VectorCompareEQ(value, VectorZero()), VectorZero(), VectorSelect(VectorCompareEQ(value, one), one, result));
+		});
+		break;
+
+	case EEaseType::EaseType::easeInAndOutElastic:
+		RunEaseKernel(values, outEased, count, [=](VectorRegister value)
+		{
+			const float period = 1 * 0.3f;
+			const VectorRegister doubled = VectorMultiply(value, two);
+			const VectorRegister offset = VectorSubtract(doubled, one);
+			const VectorRegister wave = EaseSin(VectorMultiply(VectorSubtract(offset, VectorSetFloat1(period / 4)), VectorSetFloat1((2 * pi) / period)));
+#if !PLATFORM_IOS && !PLATFORM_ANDROID
+			const VectorRegister firstHalf = EaseLess(doubled, 1.f);
+			const VectorRegister exponent = VectorMultiply(VectorSetFloat1(10.f), offset);
+			const VectorRegister curve = VectorMultiply(EaseExp2(VectorSelect(firstHalf, exponent, VectorNegate(exponent))), wave);
+			const VectorRegister result = VectorSelect(firstHalf, VectorMultiply(VectorNegate(half), curve), VectorMultiplyAdd(curve, half, one));
+#else //The mobile version of the scalar equation only has the first half
+			const VectorRegister result = VectorMultiply(VectorNegate(half), VectorMultiply(EaseExp2(VectorMultiply(VectorSetFloat1(10.f), offset)), wave));
+#endif
+			return VectorSelect(VectorCompareEQ(value, VectorZero()), VectorZero(), VectorSelect(VectorCompareEQ(doubled, two), one, result));
+		});
+		break;
+
+	default:
+		//linear, and customCurve which the caller evaluates on the curve
+		FMemory::Memcpy(outEased, values, count * sizeof(float));
+		break;
+	}
+}
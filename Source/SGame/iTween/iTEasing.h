@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "iTweenPCH.h"
+#include "iTAux.h"
+
+/**
+* The error of one baked easing table against its equation or curve
+*/
+struct FiTweenEasingTableError
+{
+	//The ease type or the custom curve asset name
+	FString name;
+	int32 resolution = 0;
+	float maxError = 0.f;
+	//Where the max error is, in [0, 1]
+	float maxErrorAlpha = 0.f;
+	float meanError = 0.f;
+};
+
+/**
+* The easing equations of iTween, shared by the event actors and the aux tween pool so both give the same curves
+*/
+struct SGAME_API FiTweenEasing
+{
+	//Eased alpha of the linear alpha in [0, 1]. The custom curve is only used by the customCurve ease type, the amplitude only by punch.
+	//Reads the baked table of the ease type or the curve if there is one
+	static float Evaluate(EEaseType::EaseType easeType, float value, UCurveFloat* customEaseTypeCurve = nullptr, float punchAmplitude = 1.f);
+
+	//Eased alpha from the equation or the curve asset, even if the tables are baked
+	static float EvaluateAnalytic(EEaseType::EaseType easeType, float value, UCurveFloat* customEaseTypeCurve = nullptr, float punchAmplitude = 1.f);
+
+	//Bake every ease type but linear, and the listed custom curves, into tables of samples over [0, 1] read with linear
+	//interpolation by Evaluate and EvaluateBatch from then on. A listed resolution replaces the default one of its ease
+	//type or curve. Custom curves not listed are baked with the default resolution the first time they are evaluated
+	static void BakeTables(int32 defaultResolution, const TArray<FiTweenEasingTableResolution>& resolutions);
+
+	//Back to the equations and the curve assets
+	static void ClearTables();
+
+	static bool AreTablesBaked();
+
+	//The tables are shared by every world, each user retains them once and they are cleared when the last one releases them
+	static void RetainTables();
+
+	static void ReleaseTables();
+
+	static bool AreTablesRetained();
+
+	//The error of every baked table, checked at testsPerSample points between each two samples where the interpolation is off most
+	static void GetTableErrors(TArray<FiTweenEasingTableError>& outErrors, int32 testsPerSample = 8);
+
+	static float EaseInBounce(float value);
+
+	static float EaseOutBounce(float value);
+
+	static float EaseInOutBounce(float value);
+
+	//Eased alphas of the alphas in [0, 1], all by the same ease type. Runs the vector kernel of the ease type, four
+	//alphas per register, or reads its table if baked. customCurve gives the linear alpha and punch an amplitude of 1,
+	//the caller applies the curve and the amplitude. The results match Evaluate within float precision
+	static void EvaluateBatch(EEaseType::EaseType easeType, const float* values, float* outEased, int32 count);
+
+	//Eased alphas of the alphas in [0, 1], each by its own ease type. The alphas are grouped by ease type and each
+	//group goes through EvaluateBatch, the scratch arrays are kept by the caller so a call allocates nothing
+	static void EvaluateGrouped(const uint8* easeTypes, const float* values, float* outEased, int32 count, TArray<int32>& scratchIndices, TArray<float>& scratchValues);
+
+	static const int32 easeTypeCount = EEaseType::EaseType::customCurve + 1;
+
+private:
+	//The original integer 22 / 7, kept so the sine, elastic and spring curves don't change
+	static const float pi;
+};
+
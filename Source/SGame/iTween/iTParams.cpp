@@ -0,0 +1,803 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SGame.h"
+#include "iTweenPCH.h"
+#include "iTParams.h"
+#include "iTween.h"
+
+//The parameter keys in the order the event applies them, e.g. 'time' wins over 'speed' wherever they are in the string
+enum EParamKey
+{
+	keyName,
+	keyFloatFrom,
+	keyFloatTo,
+	keyCoordinateSpace,
+	keyVectorFrom,
+	keyVectorTo,
+	keyVector2DFrom,
+	keyVector2DTo,
+	keyRotatorFrom,
+	keyRotatorTo,
+	keyLinearColorFrom,
+	keyLinearColorTo,
+	keyDelayType,
+	keyDelay,
+	keyTickType,
+	keyTickTypeValue,
+	keySpeed,
+	keyTimeInSeconds,
+	keyTime,
+	keyPunchAmplitude,
+	keyGeneratedPointDistance,
+	keySweep,
+	keyVectorConstraints,
+	keyVector2DConstraints,
+	keyRotatorConstraints,
+	keyLoopType,
+	keyOrientation,
+	keyOrientationSpeed,
+	keyTickWhenPaused,
+	keyIgnoreTimeDilation,
+	keyInterpolateToSpline,
+	keySwitchPathOrientationDirection,
+	keyDestroySplineObject,
+	keyShortestPath,
+	keyEaseType,
+	keyTimerInterval,
+	keyTieToObjectValidity,
+	keyEnforceValueTo,
+	keyMaximumLoopSections,
+	keyCullNonRenderedTweens,
+	keySecondsToWaitBeforeCull,
+	keyStartFunction,
+	keyUpdateFunction,
+	keyLoopFunction,
+	keyCompleteFunction,
+	keyCount
+};
+
+struct FParamAlias
+{
+	const TCHAR* alias;
+	EParamKey key;
+};
+
+//Every name a key can be written with, lower case and without spaces
+static const FParamAlias paramAliases[] =
+{
+	{ TEXT("name"), keyName },
+	{ TEXT("floatfrom"), keyFloatFrom }, { TEXT("ffrom"), keyFloatFrom },
+	{ TEXT("floatto"), keyFloatTo }, { TEXT("fto"), keyFloatTo },
+	{ TEXT("coordinatespace"), keyCoordinateSpace }, { TEXT("cspace"), keyCoordinateSpace },
+	{ TEXT("vectorfrom"), keyVectorFrom }, { TEXT("vfrom"), keyVectorFrom },
+	{ TEXT("vectorto"), keyVectorTo }, { TEXT("vto"), keyVectorTo },
+	{ TEXT("vector2dfrom"), keyVector2DFrom }, { TEXT("v2from"), keyVector2DFrom },
+	{ TEXT("vector2dto"), keyVector2DTo }, { TEXT("v2to"), keyVector2DTo },
+	{ TEXT("rotatorfrom"), keyRotatorFrom }, { TEXT("rfrom"), keyRotatorFrom },
+	{ TEXT("rotatorto"), keyRotatorTo }, { TEXT("rto"), keyRotatorTo },
+	{ TEXT("linearcolorfrom"), keyLinearColorFrom }, { TEXT("linearcolourfrom"), keyLinearColorFrom }, { TEXT("colorfrom"), keyLinearColorFrom },
+	{ TEXT("colourfrom"), keyLinearColorFrom }, { TEXT("cfrom"), keyLinearColorFrom }, { TEXT("lcfrom"), keyLinearColorFrom },
+	{ TEXT("linearcolorto"), keyLinearColorTo }, { TEXT("linearcolourto"), keyLinearColorTo }, { TEXT("colorto"), keyLinearColorTo },
+	{ TEXT("colourto"), keyLinearColorTo }, { TEXT("cto"), keyLinearColorTo }, { TEXT("lcto"), keyLinearColorTo },
+	{ TEXT("delaytype"), keyDelayType }, { TEXT("dtype"), keyDelayType },
+	{ TEXT("delay"), keyDelay },
+	{ TEXT("ticktype"), keyTickType }, { TEXT("ttype"), keyTickType },
+	{ TEXT("ticktypevalue"), keyTickTypeValue }, { TEXT("ttv"), keyTickTypeValue },
+	{ TEXT("speed"), keySpeed },
+	{ TEXT("timeinseconds"), keyTimeInSeconds },
+	{ TEXT("time"), keyTime },
+	{ TEXT("punchamplitude"), keyPunchAmplitude }, { TEXT("punch"), keyPunchAmplitude }, { TEXT("pamp"), keyPunchAmplitude },
+	{ TEXT("generatedpointdistance"), keyGeneratedPointDistance }, { TEXT("gpd"), keyGeneratedPointDistance },
+	{ TEXT("sweep"), keySweep },
+	{ TEXT("vectorconstraints"), keyVectorConstraints }, { TEXT("vconst"), keyVectorConstraints },
+	{ TEXT("vector2dconstraints"), keyVector2DConstraints }, { TEXT("v2const"), keyVector2DConstraints },
+	{ TEXT("rotatorconstraints"), keyRotatorConstraints }, { TEXT("rconst"), keyRotatorConstraints },
+	{ TEXT("looptype"), keyLoopType }, { TEXT("loop"), keyLoopType },
+	{ TEXT("looktype"), keyOrientation }, { TEXT("orientation"), keyOrientation }, { TEXT("look"), keyOrientation },
+	{ TEXT("orientationspeed"), keyOrientationSpeed }, { TEXT("lookspeed"), keyOrientationSpeed }, { TEXT("ospeed"), keyOrientationSpeed },
+	{ TEXT("tickwhenpaused"), keyTickWhenPaused }, { TEXT("twp"), keyTickWhenPaused },
+	{ TEXT("ignoretimedilation"), keyIgnoreTimeDilation }, { TEXT("itd"), keyIgnoreTimeDilation },
+	{ TEXT("interp"), keyInterpolateToSpline },
+	{ TEXT("switchpathorientationdirection"), keySwitchPathOrientationDirection }, { TEXT("spod"), keySwitchPathOrientationDirection },
+	{ TEXT("destroysplineobject"), keyDestroySplineObject }, { TEXT("destroyspline"), keyDestroySplineObject }, { TEXT("dso"), keyDestroySplineObject },
+	{ TEXT("shortestpath"), keyShortestPath }, { TEXT("short"), keyShortestPath },
+	{ TEXT("easetype"), keyEaseType }, { TEXT("ease"), keyEaseType },
+	{ TEXT("timerinterval"), keyTimerInterval }, { TEXT("interval"), keyTimerInterval }, { TEXT("tiin"), keyTimerInterval },
+	{ TEXT("tietoobjectvalidity"), keyTieToObjectValidity }, { TEXT("tov"), keyTieToObjectValidity },
+	{ TEXT("enforcevalueto"), keyEnforceValueTo }, { TEXT("evt"), keyEnforceValueTo },
+	{ TEXT("maximumloopsections"), keyMaximumLoopSections }, { TEXT("maxloops"), keyMaximumLoopSections }, { TEXT("mls"), keyMaximumLoopSections },
+	{ TEXT("cullnonrenderedtweens"), keyCullNonRenderedTweens }, { TEXT("cull"), keyCullNonRenderedTweens },
+	{ TEXT("secondstowaitbeforecull"), keySecondsToWaitBeforeCull }, { TEXT("cullwait"), keySecondsToWaitBeforeCull }, { TEXT("stwbc"), keySecondsToWaitBeforeCull },
+	{ TEXT("startfunction"), keyStartFunction }, { TEXT("osfn"), keyStartFunction },
+	{ TEXT("updatefunction"), keyUpdateFunction }, { TEXT("tickfunction"), keyUpdateFunction }, { TEXT("oufn"), keyUpdateFunction },
+	{ TEXT("loopfunction"), keyLoopFunction }, { TEXT("olfn"), keyLoopFunction },
+	{ TEXT("completefunction"), keyCompleteFunction }, { TEXT("ocfn"), keyCompleteFunction },
+};
+
+struct FEaseName
+{
+	const TCHAR* name;
+	const TCHAR* shortName;
+	EEaseType::EaseType easeType;
+};
+
+//Checked in order, the first name the value contains wins
+static const FEaseName easeNames[] =
+{
+	{ TEXT("linear"), nullptr, EEaseType::EaseType::linear },
+	{ TEXT("punch"), nullptr, EEaseType::EaseType::punch },
+	{ TEXT("spring"), nullptr, EEaseType::EaseType::spring },
+	{ TEXT("curve"), nullptr, EEaseType::EaseType::customCurve },
+	{ TEXT("easeInAndOutBack"), TEXT("ioback"), EEaseType::EaseType::easeInAndOutBack },
+	{ TEXT("easeInAndOutBounce"), TEXT("iobounce"), EEaseType::EaseType::easeInAndOutBounce },
+	{ TEXT("easeInAndOutCircular"), TEXT("iocirc"), EEaseType::EaseType::easeInAndOutCircular },
+	{ TEXT("easeInAndOutCubic"), TEXT("iocubic"), EEaseType::EaseType::easeInAndOutCubic },
+	{ TEXT("easeInAndOutElastic"), TEXT("ioelas"), EEaseType::EaseType::easeInAndOutElastic },
+	{ TEXT("easeInAndOutExponential"), TEXT("ioexpo"), EEaseType::EaseType::easeInAndOutExponential },
+	{ TEXT("easeInAndOutQuadratic"), TEXT("ioquad"), EEaseType::EaseType::easeInAndOutQuadratic },
+	{ TEXT("easeInAndOutQuartic"), TEXT("ioquart"), EEaseType::EaseType::easeInAndOutQuartic },
+	{ TEXT("easeInAndOutQuintic"), TEXT("ioquint"), EEaseType::EaseType::easeInAndOutQuintic },
+	{ TEXT("easeInAndOutSine"), TEXT("iosine"), EEaseType::EaseType::easeInAndOutSine },
+	{ TEXT("easeInBack"), TEXT("iback"), EEaseType::EaseType::easeInBack },
+	{ TEXT("easeInBounce"), TEXT("ibounce"), EEaseType::EaseType::easeInBounce },
+	{ TEXT("easeInCircular"), TEXT("icirc"), EEaseType::EaseType::easeInCircular },
+	{ TEXT("easeInCubic"), TEXT("icubic"), EEaseType::EaseType::easeInCubic },
+	{ TEXT("easeInElastic"), TEXT("ielas"), EEaseType::EaseType::easeInElastic },
+	{ TEXT("easeInExponential"), TEXT("iexpo"), EEaseType::EaseType::easeInExponential },
+	{ TEXT("easeInQuadratic"), TEXT("iquad"), EEaseType::EaseType::easeInQuadratic },
+	{ TEXT("easeInQuartic"), TEXT("iquart"), EEaseType::EaseType::easeInQuartic },
+	{ TEXT("easeInQuintic"), TEXT("iquint"), EEaseType::EaseType::easeInQuintic },
+	{ TEXT("easeInSine"), TEXT("isine"), EEaseType::EaseType::easeInSine },
+	{ TEXT("easeOutBack"), TEXT("oback"), EEaseType::EaseType::easeOutBack },
+	{ TEXT("easeOutBounce"), TEXT("obounce"), EEaseType::EaseType::easeOutBounce },
+	{ TEXT("easeOutCircular"), TEXT("ocirc"), EEaseType::EaseType::easeOutCircular },
+	{ TEXT("easeOutCubic"), TEXT("ocubic"), EEaseType::EaseType::easeOutCubic },
+	{ TEXT("easeOutElastic"), TEXT("oelas"), EEaseType::EaseType::easeOutElastic },
+	{ TEXT("easeOutExponential"), TEXT("oexpo"), EEaseType::EaseType::easeOutExponential },
+	{ TEXT("easeOutQuadratic"), TEXT("oquad"), EEaseType::EaseType::easeOutQuadratic },
+	{ TEXT("easeOutQuartic"), TEXT("oquart"), EEaseType::EaseType::easeOutQuartic },
+	{ TEXT("easeOutQuintic"), TEXT("oquint"), EEaseType::EaseType::easeOutQuintic },
+	{ TEXT("easeOutSine"), TEXT("osine"), EEaseType::EaseType::easeOutSine },
+};
+
+//Compiled parameter strings by the case sensitive hash of the string. Tweens are only spawned on the game thread
+struct FCompiledParams
+{
+	FString source;
+	FiTweenParams params;
+};
+static TMap<uint32, FCompiledParams> compiledParams;
+
+//Strings built per spawn, e.g. with a formatted location in them, would grow the cache forever, so it starts over when full
+static const int32 maxCompiledParams = 1024;
+
+//Blank out the brackets, so "(1, 2, 3)", "[1, 2, 3]" and "1, 2, 3" read the same
+static FString CleanValue(const FString& value)
+{
+	FString cleaned = value;
+	cleaned.ReplaceInline(TEXT("("), TEXT(" "));
+	cleaned.ReplaceInline(TEXT("{"), TEXT(" "));
+	cleaned.ReplaceInline(TEXT("["), TEXT(" "));
+	cleaned.ReplaceInline(TEXT(")"), TEXT(" "));
+	cleaned.ReplaceInline(TEXT("}"), TEXT(" "));
+	cleaned.ReplaceInline(TEXT("]"), TEXT(" "));
+	cleaned.TrimStartAndEndInline();
+	return cleaned;
+}
+
+//The factor after '*', e.g. "5*2" is 10 and "current*2" is twice the current value
+static float ParseScale(const FString& value)
+{
+	FString left;
+	FString right;
+	if (value.Split(TEXT("*"), &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart))
+	{
+		return FCString::Atof(*right);
+	}
+	return 1.f;
+}
+
+static float ParseFloat(const FString& value)
+{
+	const FString cleaned = CleanValue(value);
+	return FCString::Atof(*cleaned) * ParseScale(cleaned);
+}
+
+static bool ParseBool(const FString& value)
+{
+	return value.Contains(TEXT("true"));
+}
+
+static bool IsCurrentKeyword(const FString& value)
+{
+	return value.Contains(TEXT("current")) || value.Contains(TEXT("this"));
+}
+
+//Split the cleaned value at the commas, the components are not scaled
+static int32 ParseComponents(const FString& value, float* outComponents, int32 maxComponents)
+{
+	TArray<FString> parse;
+	value.ParseIntoArray(parse, TEXT(","), true);
+
+	for (int32 i = 0; i < parse.Num() && i < maxComponents; i++)
+	{
+		outComponents[i] = FCString::Atof(*parse[i]);
+	}
+	return parse.Num();
+}
+
+//Parse a vector, vector 2D or rotator value. Returns false if the value has too few components
+static bool ParseVectorValue(const FString& value, const TCHAR* typeName, const TCHAR* const* componentNames, int32 componentCount,
+	FiTweenParams& outParams, FiTweenParams::ECurrentValue currentValue, bool& outCurrent, float* outComponents)
+{
+	FString cleaned = CleanValue(value);
+	cleaned.ReplaceInline(typeName, TEXT(" "));
+	cleaned.ReplaceInline(componentNames[0], TEXT(" "));
+	for (int32 i = 1; i < componentCount; i++)
+	{
+		cleaned.ReplaceInline(componentNames[i], TEXT(","));
+	}
+	cleaned.TrimStartAndEndInline();
+
+	const float scale = ParseScale(cleaned);
+	outCurrent = false;
+	if (cleaned.Contains(TEXT("zero")))
+	{
+		for (int32 i = 0; i < componentCount; i++)
+		{
+			outComponents[i] = 0.f;
+		}
+	}
+	else if (cleaned.Contains(TEXT("one")))
+	{
+		for (int32 i = 0; i < componentCount; i++)
+		{
+			outComponents[i] = scale;
+		}
+	}
+	else if (IsCurrentKeyword(cleaned))
+	{
+		outCurrent = true;
+		outParams.currentScales[currentValue] = scale;
+	}
+	else
+	{
+		if (ParseComponents(cleaned, outComponents, componentCount) < componentCount)
+		{
+			UiTween::Print(FString::Printf(TEXT("%s parameters take %d arguments: %s"), typeName, componentCount, *value), "error");
+			return false;
+		}
+
+		for (int32 i = 0; i < componentCount; i++)
+		{
+			outComponents[i] *= scale;
+		}
+	}
+	return true;
+}
+
+static bool ParseFloatValue(const FString& value, FiTweenParams& outParams, FiTweenParams::ECurrentValue currentValue, bool& outCurrent, float& outValue)
+{
+	const FString cleaned = CleanValue(value);
+	outCurrent = IsCurrentKeyword(cleaned);
+	if (outCurrent)
+	{
+		outParams.currentScales[currentValue] = ParseScale(cleaned);
+	}
+	else
+	{
+		outValue = FCString::Atof(*cleaned) * ParseScale(cleaned);
+	}
+	return true;
+}
+
+static bool ParseLinearColor(const FString& value, FLinearColor& outColor)
+{
+	FString cleaned = CleanValue(value);
+	cleaned.ReplaceInline(TEXT("FLinearColor"), TEXT(" "));
+	cleaned.ReplaceInline(TEXT("R="), TEXT(" "));
+	cleaned.ReplaceInline(TEXT("G="), TEXT(","));
+	cleaned.ReplaceInline(TEXT("B="), TEXT(","));
+	cleaned.ReplaceInline(TEXT("A="), TEXT(","));
+	cleaned.TrimStartAndEndInline();
+
+	float components[4] = { 0.f, 0.f, 0.f, 1.f };
+	const int32 componentCount = ParseComponents(cleaned, components, 4);
+	if (componentCount == 1)
+	{
+		static const TCHAR* colorNames[] = { TEXT("black"), TEXT("blue"), TEXT("cyan"), TEXT("green"), TEXT("magenta"), TEXT("red"), TEXT("white"), TEXT("yellow") };
+		const FColor colors[] = { FColor::Black, FColor::Blue, FColor::Cyan, FColor::Green, FColor::Magenta, FColor::Red, FColor::White, FColor::Yellow };
+
+		int32 colorIndex = 0;
+		while (colorIndex < ARRAY_COUNT(colorNames) && !cleaned.Contains(colorNames[colorIndex]))
+		{
+			colorIndex++;
+		}
+		if (colorIndex == ARRAY_COUNT(colorNames))
+		{
+			UiTween::Print("Unknown color name: " + value, "error");
+			return false;
+		}
+		outColor = FLinearColor(colors[colorIndex]);
+	}
+	else if (componentCount == 3 || componentCount == 4)
+	{
+		outColor = FLinearColor(components[0], components[1], components[2], components[3]);
+	}
+	else
+	{
+		UiTween::Print("Linear color parameters take 1, 3, or 4 arguments, not " + FString::FromInt(componentCount) + ".", "error");
+		return false;
+	}
+
+	//The factor scales the color but not the alpha
+	const float scale = ParseScale(cleaned);
+	outColor *= scale;
+	outColor.A /= scale;
+	return true;
+}
+
+FiTweenParams::FiTweenParams()
+{
+	for (int32 i = 0; i < currentValueCount; i++)
+	{
+		currentScales[i] = 1.f;
+	}
+}
+
+FiTweenParams& FiTweenParams::SetFromCurrent(ECurrentValue value, float scale)
+{
+	currentScales[value] = scale;
+	switch (value)
+	{
+	case currentFloatFrom:
+		floatFromCurrent = overrideFloatFrom = true;
+		break;
+	case currentFloatTo:
+		floatToCurrent = overrideFloatTo = true;
+		break;
+	case currentVectorFrom:
+		vectorFromCurrent = overrideVectorFrom = true;
+		break;
+	case currentVectorTo:
+		vectorToCurrent = overrideVectorTo = true;
+		break;
+	case currentVector2DFrom:
+		vector2DFromCurrent = overrideVector2DFrom = true;
+		break;
+	case currentVector2DTo:
+		vector2DToCurrent = overrideVector2DTo = true;
+		break;
+	case currentRotatorFrom:
+		rotatorFromCurrent = overrideRotatorFrom = true;
+		break;
+	case currentRotatorTo:
+		rotatorToCurrent = overrideRotatorTo = true;
+		break;
+	default:
+		break;
+	}
+	return *this;
+}
+
+const FiTweenParams& FiTweenParams::FindOrCompile(const FString& params)
+{
+	const uint32 hash = FCrc::StrCrc32(*params);
+	FCompiledParams* compiled = compiledParams.Find(hash);
+	if (compiled && compiled->source.Equals(params, ESearchCase::CaseSensitive))
+	{
+		return compiled->params;
+	}
+
+	if (compiled)
+	{
+		//Another string has the same hash, compile this one without caching it
+		static FiTweenParams collidedParams;
+		collidedParams = FiTweenParams();
+		Compile(params, collidedParams);
+		return collidedParams;
+	}
+
+	if (compiledParams.Num() >= maxCompiledParams)
+	{
+		compiledParams.Empty();
+	}
+
+	FCompiledParams& added = compiledParams.Add(hash);
+	added.source = params;
+	Compile(params, added.params);
+	return added.params;
+}
+
+void FiTweenParams::Compile(const FString& params, FiTweenParams& outParams)
+{
+	//Split into an entry at each semicolon, then into key and value at the equal sign. A later entry of the same key wins
+	FString keys[keyCount];
+	FString values[keyCount];
+	bool hasValue[keyCount] = {};
+
+	TArray<FString> arr;
+	params.ParseIntoArray(arr, TEXT(";"), true);
+	for (FString& entry : arr)
+	{
+		FString left;
+		FString right;
+		entry.Split(TEXT("="), &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
+		left = left.ToLower();
+		left.ReplaceInline(TEXT(" "), TEXT(""));
+		right.TrimStartAndEndInline();
+		if (left.IsEmpty())
+		{
+			continue;
+		}
+
+		int32 aliasIndex = 0;
+		while (aliasIndex < ARRAY_COUNT(paramAliases) && left != paramAliases[aliasIndex].alias)
+		{
+			aliasIndex++;
+		}
+		if (aliasIndex == ARRAY_COUNT(paramAliases))
+		{
+			UiTween::Print("Unknown iTween parameter: " + left, "error");
+			continue;
+		}
+
+		const EParamKey key = paramAliases[aliasIndex].key;
+		keys[key] = left;
+		values[key] = right;
+		hasValue[key] = true;
+	}
+
+	for (int32 keyIndex = 0; keyIndex < keyCount; keyIndex++)
+	{
+		if (!hasValue[keyIndex])
+		{
+			continue;
+		}
+
+		const FString& value = values[keyIndex];
+		switch (keyIndex)
+		{
+		case keyName:
+			outParams.tweenName = FName(*value);
+			outParams.overrideTweenName = true;
+			break;
+		case keyFloatFrom:
+			outParams.overrideFloatFrom = ParseFloatValue(value, outParams, currentFloatFrom, outParams.floatFromCurrent, outParams.floatFrom);
+			break;
+		case keyFloatTo:
+			outParams.overrideFloatTo = ParseFloatValue(value, outParams, currentFloatTo, outParams.floatToCurrent, outParams.floatTo);
+			break;
+		case keyCoordinateSpace:
+			if (value.Contains(TEXT("world")))
+			{
+				outParams.SetCoordinateSpace(ECoordinateSpace::CoordinateSpace::world);
+			}
+			else if (value.Contains(TEXT("parent")))
+			{
+				outParams.SetCoordinateSpace(ECoordinateSpace::CoordinateSpace::parent);
+			}
+			else if (value.Contains(TEXT("self")))
+			{
+				outParams.SetCoordinateSpace(ECoordinateSpace::CoordinateSpace::self);
+			}
+			break;
+		case keyVectorFrom:
+		case keyVectorTo:
+		{
+			static const TCHAR* componentNames[] = { TEXT("X="), TEXT("Y="), TEXT("Z=") };
+			const bool from = keyIndex == keyVectorFrom;
+			float components[3];
+			if (ParseVectorValue(value, TEXT("FVector"), componentNames, 3, outParams, from ? currentVectorFrom : currentVectorTo, from ? outParams.vectorFromCurrent : outParams.vectorToCurrent, components))
+			{
+				(from ? outParams.overrideVectorFrom : outParams.overrideVectorTo) = true;
+				(from ? outParams.vectorFrom : outParams.vectorTo) = FVector(components[0], components[1], components[2]);
+			}
+			break;
+		}
+		case keyVector2DFrom:
+		case keyVector2DTo:
+		{
+			static const TCHAR* componentNames[] = { TEXT("X="), TEXT("Y=") };
+			const bool from = keyIndex == keyVector2DFrom;
+			float components[2];
+			if (ParseVectorValue(value, TEXT("FVector2D"), componentNames, 2, outParams, from ? currentVector2DFrom : currentVector2DTo, from ? outParams.vector2DFromCurrent : outParams.vector2DToCurrent, components))
+			{
+				(from ? outParams.overrideVector2DFrom : outParams.overrideVector2DTo) = true;
+				(from ? outParams.vector2DFrom : outParams.vector2DTo) = FVector2D(components[0], components[1]);
+			}
+			break;
+		}
+		case keyRotatorFrom:
+		case keyRotatorTo:
+		{
+			static const TCHAR* componentNames[] = { TEXT("P="), TEXT("Y="), TEXT("R=") };
+			const bool from = keyIndex == keyRotatorFrom;
+			float components[3];
+			if (ParseVectorValue(value, TEXT("FRotator"), componentNames, 3, outParams, from ? currentRotatorFrom : currentRotatorTo, from ? outParams.rotatorFromCurrent : outParams.rotatorToCurrent, components))
+			{
+				(from ? outParams.overrideRotatorFrom : outParams.overrideRotatorTo) = true;
+				(from ? outParams.rotatorFrom : outParams.rotatorTo) = FRotator(components[0], components[1], components[2]);
+			}
+			break;
+		}
+		case keyLinearColorFrom:
+			outParams.overrideLinearColorFrom = ParseLinearColor(value, outParams.linearColorFrom);
+			break;
+		case keyLinearColorTo:
+			outParams.overrideLinearColorTo = ParseLinearColor(value, outParams.linearColorTo);
+			break;
+		case keyDelayType:
+			if (value.Equals(TEXT("first"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetDelayType(EDelayType::DelayType::first);
+			}
+			else if (value.Equals(TEXT("firstloop"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetDelayType(EDelayType::DelayType::firstLoop);
+			}
+			else if (value.Equals(TEXT("firstloopfull"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetDelayType(EDelayType::DelayType::firstLoopFull);
+			}
+			else if (value.Equals(TEXT("loop"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetDelayType(EDelayType::DelayType::loop);
+			}
+			else if (value.Equals(TEXT("loopfull"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetDelayType(EDelayType::DelayType::loopFull);
+			}
+			else
+			{
+				UiTween::Print("Acceptable parameters for the delayType argument are: first, firstloop, firstloopfull, loop, and loopfull.", "error");
+			}
+			break;
+		case keyDelay:
+			outParams.SetDelay(ParseFloat(value));
+			break;
+		case keyTickType:
+			if (value.Equals(TEXT("seconds"), ESearchCase::IgnoreCase))
+			{
+				outParams.tickType = ETickType::TickType::seconds;
+				outParams.overrideTickType = true;
+			}
+			else if (value.Equals(TEXT("speed"), ESearchCase::IgnoreCase))
+			{
+				outParams.tickType = ETickType::TickType::speed;
+				outParams.overrideTickType = true;
+			}
+			else
+			{
+				UiTween::Print("Acceptable parameters for the tickType argument are: seconds and speed.", "error");
+			}
+			break;
+		case keyTickTypeValue:
+			outParams.tickTypeValue = ParseFloat(value);
+			outParams.overrideTickTypeValue = true;
+			break;
+		case keySpeed:
+			outParams.SetSpeed(ParseFloat(value));
+			break;
+		case keyTimeInSeconds:
+		case keyTime:
+			outParams.SetTimeInSeconds(ParseFloat(value));
+			break;
+		case keyPunchAmplitude:
+			outParams.SetPunchAmplitude(ParseFloat(value));
+			break;
+		case keyGeneratedPointDistance:
+			outParams.SetGeneratedPointDistance(ParseFloat(value));
+			break;
+		case keySweep:
+			outParams.SetSweep(ParseBool(value));
+			break;
+		case keyVectorConstraints:
+			if (value.Contains(TEXT("no")))
+			{
+				outParams.SetVectorConstraints(EVectorConstraints::VectorConstraints::none);
+			}
+			else if (value.Equals(TEXT("x"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetVectorConstraints(EVectorConstraints::VectorConstraints::xOnly);
+			}
+			else if (value.Equals(TEXT("y"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetVectorConstraints(EVectorConstraints::VectorConstraints::yOnly);
+			}
+			else if (value.Equals(TEXT("z"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetVectorConstraints(EVectorConstraints::VectorConstraints::zOnly);
+			}
+			else if (value.Equals(TEXT("xy"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetVectorConstraints(EVectorConstraints::VectorConstraints::xyOnly);
+			}
+			else if (value.Equals(TEXT("xz"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetVectorConstraints(EVectorConstraints::VectorConstraints::xzOnly);
+			}
+			else if (value.Equals(TEXT("yz"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetVectorConstraints(EVectorConstraints::VectorConstraints::yzOnly);
+			}
+			else
+			{
+				UiTween::Print("Acceptable parameters for the vectorConstraints argument are: no, none, x, y, z, xy, xz, and yz.", "error");
+			}
+			break;
+		case keyVector2DConstraints:
+			if (value.Contains(TEXT("no")))
+			{
+				outParams.SetVector2DConstraints(EVector2DConstraints::Vector2DConstraints::none);
+			}
+			else if (value.Equals(TEXT("x"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetVector2DConstraints(EVector2DConstraints::Vector2DConstraints::xOnly);
+			}
+			else if (value.Equals(TEXT("y"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetVector2DConstraints(EVector2DConstraints::Vector2DConstraints::yOnly);
+			}
+			else
+			{
+				UiTween::Print("Acceptable parameters for the vector2DConstraints argument are: no, none, x, and y.", "error");
+			}
+			break;
+		case keyRotatorConstraints:
+			if (value.Contains(TEXT("no")))
+			{
+				outParams.SetRotatorConstraints(ERotatorConstraints::RotatorConstraints::none);
+			}
+			else if (value.Equals(TEXT("pitch"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetRotatorConstraints(ERotatorConstraints::RotatorConstraints::pitchOnly);
+			}
+			else if (value.Equals(TEXT("yaw"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetRotatorConstraints(ERotatorConstraints::RotatorConstraints::yawOnly);
+			}
+			else if (value.Equals(TEXT("roll"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetRotatorConstraints(ERotatorConstraints::RotatorConstraints::rollOnly);
+			}
+			else if (value.Equals(TEXT("pitchyaw"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetRotatorConstraints(ERotatorConstraints::RotatorConstraints::pitchYawOnly);
+			}
+			else if (value.Equals(TEXT("pitchroll"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetRotatorConstraints(ERotatorConstraints::RotatorConstraints::pitchRollOnly);
+			}
+			else if (value.Equals(TEXT("yawroll"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetRotatorConstraints(ERotatorConstraints::RotatorConstraints::yawRollOnly);
+			}
+			else
+			{
+				UiTween::Print("Acceptable parameters for the rotatorConstraints argument are: no, none, pitch, yaw, roll, pitchyaw, pitchroll, and yawroll.", "error");
+			}
+			break;
+		case keyLoopType:
+			if (value.Equals(TEXT("once"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetLoopType(ELoopType::LoopType::once);
+			}
+			else if (value.Equals(TEXT("pingpong"), ESearchCase::IgnoreCase) || value.Equals(TEXT("backandforth"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetLoopType(ELoopType::LoopType::pingPong);
+			}
+			else if (value.Equals(TEXT("rewind"), ESearchCase::IgnoreCase))
+			{
+				outParams.SetLoopType(ELoopType::LoopType::rewind);
+			}
+			else
+			{
+				UiTween::Print("Acceptable parameters for the loopType argument are: once, pingpong or backandforth, and rewind.", "error");
+			}
+			break;
+		case keyOrientation:
+			if (value.Contains(TEXT("no")))
+			{
+				outParams.orientation = ELookType::LookType::noOrientationChange;
+				outParams.overrideOrientation = true;
+			}
+			else if (value.Contains(TEXT("path")))
+			{
+				outParams.orientation = ELookType::LookType::orientToPath;
+				outParams.overrideOrientation = true;
+			}
+			else if (value.Contains(TEXT("target")))
+			{
+				outParams.orientation = ELookType::LookType::orientToTarget;
+				outParams.overrideOrientation = true;
+			}
+			else
+			{
+				UiTween::Print("Acceptable parameters for the orientation argument are: no, path, and target.", "error");
+			}
+			break;
+		case keyOrientationSpeed:
+			outParams.orientationSpeed = ParseFloat(value);
+			outParams.overrideOrientationSpeed = true;
+			break;
+		case keyTickWhenPaused:
+			outParams.SetTickWhenPaused(ParseBool(value));
+			break;
+		case keyIgnoreTimeDilation:
+			outParams.SetIgnoreTimeDilation(ParseBool(value));
+			break;
+		case keyInterpolateToSpline:
+			outParams.SetInterpolateToSpline(ParseBool(value));
+			break;
+		case keySwitchPathOrientationDirection:
+			outParams.SetSwitchPathOrientationDirection(ParseBool(value));
+			break;
+		case keyDestroySplineObject:
+			outParams.SetDestroySplineObject(ParseBool(value));
+			break;
+		case keyShortestPath:
+			outParams.SetShortestPath(ParseBool(value));
+			break;
+		case keyEaseType:
+		{
+			int32 easeIndex = 0;
+			while (easeIndex < ARRAY_COUNT(easeNames) && !value.Contains(easeNames[easeIndex].name) && !(easeNames[easeIndex].shortName && value.Contains(easeNames[easeIndex].shortName)))
+			{
+				easeIndex++;
+			}
+			if (easeIndex < ARRAY_COUNT(easeNames))
+			{
+				outParams.SetEaseType(easeNames[easeIndex].easeType);
+			}
+			break;
+		}
+		case keyTimerInterval:
+			outParams.SetTimerInterval(ParseFloat(value));
+			if (value.Contains(TEXT("fps")))
+			{
+				outParams.timerInterval = 1 / outParams.timerInterval;
+			}
+			break;
+		case keyTieToObjectValidity:
+			outParams.SetTieToObjectValidity(ParseBool(value));
+			break;
+		case keyEnforceValueTo:
+			outParams.SetEnforceValueTo(ParseBool(value));
+			break;
+		case keyMaximumLoopSections:
+		{
+			const FString cleaned = CleanValue(value);
+			FString left;
+			FString right;
+			const int32 scale = cleaned.Split(TEXT("*"), &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart) ? FCString::Atoi(*right) : 1;
+			outParams.SetMaximumLoopSections(FCString::Atoi(*cleaned) * scale);
+			break;
+		}
+		case keyCullNonRenderedTweens:
+			outParams.cullNonRenderedTweens = ParseBool(value);
+			outParams.overrideCullNonRenderedTweens = true;
+			break;
+		case keySecondsToWaitBeforeCull:
+			outParams.secondsToWaitBeforeCull = ParseFloat(value);
+			outParams.overrideSecondsToWaitBeforeCull = true;
+			break;
+		case keyStartFunction:
+			outParams.OnTweenStartFunctionName = value;
+			break;
+		case keyUpdateFunction:
+			outParams.OnTweenUpdateFunctionName = value;
+			break;
+		case keyLoopFunction:
+			outParams.OnTweenLoopFunctionName = value;
+			break;
+		case keyCompleteFunction:
+			outParams.OnTweenCompleteFunctionName = value;
+			break;
+		default:
+			break;
+		}
+
+		UiTween::Print(keys[keyIndex] + ": " + value);
+	}
+}
@@ -0,0 +1,271 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "iTweenPCH.h"
+#include "iTAux.h"
+#include "iTParams.generated.h"
+
+/**
+* Typed iTween parameters, only the overridden values are applied to the tween. A parameter string of the Expert and Min
+* functions is compiled into one of these the first time it is seen and cached by the string hash, so spawning a tween with
+* the same string again does not parse or allocate. To skip the strings entirely, build one with the setters in C++ or with
+* the Make node in Blueprint, spawn with an empty parameter string and initializeOnSpawn off, and call ApplyParameters
+*/
+USTRUCT(BlueprintType)
+struct SGAME_API FiTweenParams
+{
+	GENERATED_USTRUCT_BODY()
+
+	//The values the 'current' and 'this' keywords read from the tweened object
+	enum ECurrentValue
+	{
+		currentFloatFrom,
+		currentFloatTo,
+		currentVectorFrom,
+		currentVectorTo,
+		currentVector2DFrom,
+		currentVector2DTo,
+		currentRotatorFrom,
+		currentRotatorTo,
+		currentValueCount
+	};
+
+	FiTweenParams();
+
+	//Compile the parameter string, or return the cached compile of the same string
+	static const FiTweenParams& FindOrCompile(const FString& params);
+
+	//Parse the parameter string, prints the errors of the unknown values like the event did
+	static void Compile(const FString& params, FiTweenParams& outParams);
+
+	//General
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideTweenName = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General", meta = (PinHiddenByDefault, editcondition = "overrideTweenName"))
+		FName tweenName;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideCoordinateSpace = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General", meta = (PinHiddenByDefault, editcondition = "overrideCoordinateSpace"))
+		TEnumAsByte<ECoordinateSpace::CoordinateSpace> coordinateSpace = ECoordinateSpace::CoordinateSpace::world;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideSweep = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General", meta = (PinHiddenByDefault, editcondition = "overrideSweep"))
+		bool sweep = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideTieToObjectValidity = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General", meta = (PinHiddenByDefault, editcondition = "overrideTieToObjectValidity"))
+		bool tieToObjectValidity = true;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideEnforceValueTo = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General", meta = (PinHiddenByDefault, editcondition = "overrideEnforceValueTo"))
+		bool enforceValueTo = true;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideTimerInterval = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General", meta = (PinHiddenByDefault, editcondition = "overrideTimerInterval"))
+		float timerInterval = 0.f;
+
+	//From/To values, the current flags take the value from the tweened object when the tween is applied
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideFloatFrom = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, editcondition = "overrideFloatFrom"))
+		float floatFrom = 0.f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault))
+		bool floatFromCurrent = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideFloatTo = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, editcondition = "overrideFloatTo"))
+		float floatTo = 0.f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault))
+		bool floatToCurrent = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideVectorFrom = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, editcondition = "overrideVectorFrom"))
+		FVector vectorFrom = FVector::ZeroVector;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault))
+		bool vectorFromCurrent = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideVectorTo = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, editcondition = "overrideVectorTo"))
+		FVector vectorTo = FVector::ZeroVector;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault))
+		bool vectorToCurrent = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideVector2DFrom = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, editcondition = "overrideVector2DFrom"))
+		FVector2D vector2DFrom = FVector2D::ZeroVector;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault))
+		bool vector2DFromCurrent = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideVector2DTo = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, editcondition = "overrideVector2DTo"))
+		FVector2D vector2DTo = FVector2D::ZeroVector;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault))
+		bool vector2DToCurrent = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideRotatorFrom = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, editcondition = "overrideRotatorFrom"))
+		FRotator rotatorFrom = FRotator::ZeroRotator;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault))
+		bool rotatorFromCurrent = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideRotatorTo = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, editcondition = "overrideRotatorTo"))
+		FRotator rotatorTo = FRotator::ZeroRotator;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault))
+		bool rotatorToCurrent = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideLinearColorFrom = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, editcondition = "overrideLinearColorFrom"))
+		FLinearColor linearColorFrom = FLinearColor::Black;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideLinearColorTo = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Values", meta = (PinHiddenByDefault, editcondition = "overrideLinearColorTo"))
+		FLinearColor linearColorTo = FLinearColor::Black;
+
+	//Timing
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideDelay = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, editcondition = "overrideDelay"))
+		float delay = 0.f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideDelayType = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, editcondition = "overrideDelayType"))
+		TEnumAsByte<EDelayType::DelayType> delayType = EDelayType::DelayType::first;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideTickType = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, editcondition = "overrideTickType"))
+		TEnumAsByte<ETickType::TickType> tickType = ETickType::TickType::seconds;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideTickTypeValue = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, editcondition = "overrideTickTypeValue"))
+		float tickTypeValue = 5.f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideEaseType = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, editcondition = "overrideEaseType"))
+		TEnumAsByte<EEaseType::EaseType> easeType = EEaseType::EaseType::linear;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overridePunchAmplitude = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, editcondition = "overridePunchAmplitude"))
+		float punchAmplitude = 1.f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideLoopType = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, editcondition = "overrideLoopType"))
+		TEnumAsByte<ELoopType::LoopType> loopType = ELoopType::LoopType::once;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideMaximumLoopSections = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, editcondition = "overrideMaximumLoopSections"))
+		int32 maximumLoopSections = 0;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideTickWhenPaused = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, editcondition = "overrideTickWhenPaused"))
+		bool tickWhenPaused = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideIgnoreTimeDilation = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, editcondition = "overrideIgnoreTimeDilation"))
+		bool ignoreTimeDilation = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideCullNonRenderedTweens = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, editcondition = "overrideCullNonRenderedTweens"))
+		bool cullNonRenderedTweens = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideSecondsToWaitBeforeCull = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (PinHiddenByDefault, editcondition = "overrideSecondsToWaitBeforeCull"))
+		float secondsToWaitBeforeCull = 3.f;
+
+	//Constraints and orientation
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Constraints", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideVectorConstraints = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Constraints", meta = (PinHiddenByDefault, editcondition = "overrideVectorConstraints"))
+		TEnumAsByte<EVectorConstraints::VectorConstraints> vectorConstraints = EVectorConstraints::VectorConstraints::none;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Constraints", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideVector2DConstraints = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Constraints", meta = (PinHiddenByDefault, editcondition = "overrideVector2DConstraints"))
+		TEnumAsByte<EVector2DConstraints::Vector2DConstraints> vector2DConstraints = EVector2DConstraints::Vector2DConstraints::none;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Constraints", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideRotatorConstraints = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Constraints", meta = (PinHiddenByDefault, editcondition = "overrideRotatorConstraints"))
+		TEnumAsByte<ERotatorConstraints::RotatorConstraints> rotatorConstraints = ERotatorConstraints::RotatorConstraints::none;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Constraints", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideShortestPath = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Constraints", meta = (PinHiddenByDefault, editcondition = "overrideShortestPath"))
+		bool shortestPath = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Constraints", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideOrientation = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Constraints", meta = (PinHiddenByDefault, editcondition = "overrideOrientation"))
+		TEnumAsByte<ELookType::LookType> orientation = ELookType::LookType::noOrientationChange;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Constraints", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideOrientationSpeed = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Constraints", meta = (PinHiddenByDefault, editcondition = "overrideOrientationSpeed"))
+		float orientationSpeed = 5.f;
+
+	//Spline
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spline", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideInterpolateToSpline = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spline", meta = (PinHiddenByDefault, editcondition = "overrideInterpolateToSpline"))
+		bool interpolateToSpline = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spline", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideSwitchPathOrientationDirection = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spline", meta = (PinHiddenByDefault, editcondition = "overrideSwitchPathOrientationDirection"))
+		bool switchPathOrientationDirection = true;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spline", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideDestroySplineObject = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spline", meta = (PinHiddenByDefault, editcondition = "overrideDestroySplineObject"))
+		bool destroySplineObject = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spline", meta = (PinHiddenByDefault, InlineEditConditionToggle))
+		bool overrideGeneratedPointDistance = false;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spline", meta = (PinHiddenByDefault, editcondition = "overrideGeneratedPointDistance"))
+		float generatedPointDistance = 100.f;
+
+	//Delegate function names, empty names are not applied
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Delegates", meta = (PinHiddenByDefault))
+		FString OnTweenStartFunctionName;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Delegates", meta = (PinHiddenByDefault))
+		FString OnTweenUpdateFunctionName;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Delegates", meta = (PinHiddenByDefault))
+		FString OnTweenLoopFunctionName;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Delegates", meta = (PinHiddenByDefault))
+		FString OnTweenCompleteFunctionName;
+
+	//The scale of each current value, e.g. "vfrom=current*2"
+	float currentScales[currentValueCount];
+
+	//C++ builder, each setter overrides its value
+	FiTweenParams& SetTweenName(FName value) { tweenName = value; overrideTweenName = true; return *this; }
+	FiTweenParams& SetCoordinateSpace(ECoordinateSpace::CoordinateSpace value) { coordinateSpace = value; overrideCoordinateSpace = true; return *this; }
+	FiTweenParams& SetSweep(bool value) { sweep = value; overrideSweep = true; return *this; }
+	FiTweenParams& SetTieToObjectValidity(bool value) { tieToObjectValidity = value; overrideTieToObjectValidity = true; return *this; }
+	FiTweenParams& SetEnforceValueTo(bool value) { enforceValueTo = value; overrideEnforceValueTo = true; return *this; }
+	FiTweenParams& SetTimerInterval(float value) { timerInterval = value; overrideTimerInterval = true; return *this; }
+	FiTweenParams& SetFloatFrom(float value) { floatFrom = value; floatFromCurrent = false; overrideFloatFrom = true; return *this; }
+	FiTweenParams& SetFloatTo(float value) { floatTo = value; floatToCurrent = false; overrideFloatTo = true; return *this; }
+	FiTweenParams& SetVectorFrom(const FVector& value) { vectorFrom = value; vectorFromCurrent = false; overrideVectorFrom = true; return *this; }
+	FiTweenParams& SetVectorTo(const FVector& value) { vectorTo = value; vectorToCurrent = false; overrideVectorTo = true; return *this; }
+	FiTweenParams& SetVector2DFrom(const FVector2D& value) { vector2DFrom = value; vector2DFromCurrent = false; overrideVector2DFrom = true; return *this; }
+	FiTweenParams& SetVector2DTo(const FVector2D& value) { vector2DTo = value; vector2DToCurrent = false; overrideVector2DTo = true; return *this; }
+	FiTweenParams& SetRotatorFrom(const FRotator& value) { rotatorFrom = value; rotatorFromCurrent = false; overrideRotatorFrom = true; return *this; }
+	FiTweenParams& SetRotatorTo(const FRotator& value) { rotatorTo = value; rotatorToCurrent = false; overrideRotatorTo = true; return *this; }
+	FiTweenParams& SetLinearColorFrom(const FLinearColor& value) { linearColorFrom = value; overrideLinearColorFrom = true; return *this; }
+	FiTweenParams& SetLinearColorTo(const FLinearColor& value) { linearColorTo = value; overrideLinearColorTo = true; return *this; }
+	FiTweenParams& SetFromCurrent(ECurrentValue value, float scale = 1.f);
+	FiTweenParams& SetDelay(float value) { delay = value; overrideDelay = true; return *this; }
+	FiTweenParams& SetDelayType(EDelayType::DelayType value) { delayType = value; overrideDelayType = true; return *this; }
+	FiTweenParams& SetTimeInSeconds(float value) { tickType = ETickType::TickType::seconds; tickTypeValue = value; overrideTickType = true; overrideTickTypeValue = true; return *this; }
+	FiTweenParams& SetSpeed(float value) { tickType = ETickType::TickType::speed; tickTypeValue = value; overrideTickType = true; overrideTickTypeValue = true; return *this; }
+	FiTweenParams& SetEaseType(EEaseType::EaseType value) { easeType = value; overrideEaseType = true; return *this; }
+	FiTweenParams& SetPunchAmplitude(float value) { punchAmplitude = value; overridePunchAmplitude = true; return *this; }
+	FiTweenParams& SetLoopType(ELoopType::LoopType value) { loopType = value; overrideLoopType = true; return *this; }
+	FiTweenParams& SetMaximumLoopSections(int32 value) { maximumLoopSections = value; overrideMaximumLoopSections = true; return *this; }
+	FiTweenParams& SetTickWhenPaused(bool value) { tickWhenPaused = value; overrideTickWhenPaused = true; return *this; }
+	FiTweenParams& SetIgnoreTimeDilation(bool value) { ignoreTimeDilation = value; overrideIgnoreTimeDilation = true; return *this; }
+	FiTweenParams& SetCullNonRenderedTweens(bool value, float secondsToWait = 3.f) { cullNonRenderedTweens = value; secondsToWaitBeforeCull = secondsToWait; overrideCullNonRenderedTweens = true; overrideSecondsToWaitBeforeCull = true; return *this; }
+	FiTweenParams& SetVectorConstraints(EVectorConstraints::VectorConstraints value) { vectorConstraints = value; overrideVectorConstraints = true; return *this; }
+	FiTweenParams& SetVector2DConstraints(EVector2DConstraints::Vector2DConstraints value) { vector2DConstraints = value; overrideVector2DConstraints = true; return *this; }
+	FiTweenParams& SetRotatorConstraints(ERotatorConstraints::RotatorConstraints value) { rotatorConstraints = value; overrideRotatorConstraints = true; return *this; }
+	FiTweenParams& SetShortestPath(bool value) { shortestPath = value; overrideShortestPath = true; return *this; }
+	FiTweenParams& SetOrientation(ELookType::LookType value, float speed = 5.f) { orientation = value; orientationSpeed = speed; overrideOrientation = true; overrideOrientationSpeed = true; return *this; }
+	FiTweenParams& SetInterpolateToSpline(bool value) { interpolateToSpline = value; overrideInterpolateToSpline = true; return *this; }
+	FiTweenParams& SetSwitchPathOrientationDirection(bool value) { switchPathOrientationDirection = value; overrideSwitchPathOrientationDirection = true; return *this; }
+	FiTweenParams& SetDestroySplineObject(bool value) { destroySplineObject = value; overrideDestroySplineObject = true; return *this; }
+	FiTweenParams& SetGeneratedPointDistance(float value) { generatedPointDistance = value; overrideGeneratedPointDistance = true; return *this; }
+};
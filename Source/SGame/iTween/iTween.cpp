@@ -7,12 +7,19 @@
 
 UWorld* UiTween::GetWorldLocal()
 {
-	for (TObjectIterator<UGameViewportClient> Itr; Itr; ++Itr)
+	//The game viewport is looked up once, its world follows the level changes
+	static TWeakObjectPtr<UGameViewportClient> viewportClient;
+
+	if (!viewportClient.IsValid())
 	{
-		return Itr->GetWorld();
+		for (TObjectIterator<UGameViewportClient> Itr; Itr; ++Itr)
+		{
+			viewportClient = *Itr;
+			break;
+		}
 	}
 
-	return nullptr;
+	return viewportClient.IsValid() ? viewportClient->GetWorld() : nullptr;
 }
 
 AiTweenEvent* UiTween::SpawnEvent(AiTAux* aux)
@@ -40,7 +47,7 @@ AiTweenEvent* UiTween::SpawnEvent(AiTAux* aux)
 				ie = world->SpawnActor<AiTweenEvent>(AiTweenEvent::StaticClass(), params);
 			}
 
-			ie->tweenIndex = (aux->currentTweens.Add(ie));
+			ie->tweenIndex = aux->tweenRegistry.Add(ie, aux->currentTweens);
 
 			return ie;
 		}
@@ -70,24 +77,50 @@ AiTweenEvent* UiTween::SpawnEvent(AiTAux* aux)
 	}
 }
 
+//Add the tween to the tween pool of the aux, if the aux allows it. Returns the pool id, or INDEX_NONE if not pooled
+static int32 AddPooledTween(AiTAux* aux, const FiTweenPoolDesc& desc)
+{
+	if (aux && aux->poolTransformTweens && !aux->tickWhenPaused && !aux->ignoreTimeDilation)
+	{
+		return aux->tweenPool.Add(desc, aux->GetWorldSettings()->WorldToMeters);
+	}
+	return INDEX_NONE;
+}
+
 AiTAux* UiTween::GetAux()
 {
-	AiTAux* aux = nullptr;
+	//The aux of the world is cached when it is found or spawned, only a new world looks for it again
+	static TWeakObjectPtr<AiTAux> cachedAux;
 
-	for (TObjectIterator<AiTAux> Itr; Itr; ++Itr)
+	UWorld* world = GetWorldLocal();
+	if (cachedAux.IsValid() && cachedAux->GetWorld() == world)
 	{
-		if (Itr->IsA(AiTAux::StaticClass()))
-		{
-			return *Itr;
-		}
+		return cachedAux.Get();
+	}
+
+	cachedAux = nullptr;
+	if (!world)
+	{
+		return nullptr;
+	}
+
+	for (TActorIterator<AiTAux> Itr(world); Itr; ++Itr)
+	{
+		cachedAux = *Itr;
+		return *Itr;
 	}
 
 	FActorSpawnParameters params;
 	params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
-	aux = (AiTAux*)(GetWorldLocal()->SpawnActor<AiTAux>(AiTAux::StaticClass(), params));
+	cachedAux = world->SpawnActor<AiTAux>(AiTAux::StaticClass(), params);
 
-	return aux;
+	return cachedAux.Get();
+}
+
+FiTweenParams UiTween::CompileParameters(FString parameters)
+{
+	return FiTweenParams::FindOrCompile(parameters);
 }
 
 UObject* UiTween::FindObjectByName(FString s)
@@ -277,441 +310,305 @@ float UiTween::GetDistanceBetweenTwoVectors(FVector sourceVector, FVector destin
 }
 
 //Stopping, Pausing and Resuming Tweens
-void UiTween::StopTweeningByIndex(int32 index)
-{
-	GetAux()->currentTweens[index]->EndPhase();
-}
-
-void UiTween::StopTweeningByTweeningObjectName(FName objectName)
+//The complete messages of the stopped events may start or stop other tweens, so the matching events are copied first
+static void StopEvents(TArray<AiTweenEvent*> events)
 {
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	for (AiTweenEvent* e : events)
 	{
-		if (e->actorTweening != nullptr)
-		{
-			if (e->actorTweening->GetFName() == objectName)
-			{
-				e->EndPhase();
-			}
-		}
-		else if (e->componentTweening != nullptr)
-		{
-			if (e->componentTweening->GetFName() == objectName)
-			{
-				e->EndPhase();
-			}
-		}
-		else if (e->widgetTweening != nullptr)
+		//An earlier complete message may have stopped it already
+		if (!e->IsPendingKillPending())
 		{
-			if (e->widgetTweening->GetFName() == objectName)
-			{
-				e->EndPhase();
-			}
+			e->EndPhase();
 		}
 	}
 }
 
-void UiTween::StopTweeningByTweenName(FName tweenName)
+static void SetEventsPaused(const TArray<AiTweenEvent*>& events, bool pause)
 {
-	TArray<FName> arr;
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	for (AiTweenEvent* e : events)
 	{
-		arr.Add(e->tweenName);
+		e->isTweenPaused = pause;
+		e->shouldTick = !pause;
 	}
-	while (arr.Contains(tweenName))
-	{
-		for (AiTweenEvent* e : GetAux()->currentTweens)
-		{
-			if (e->tweenName == tweenName)
-			{
-				e->EndPhase();
-
-				break;
-			}
-		}
-
-		arr.Empty();
+}
 
-		for (AiTweenEvent* e : GetAux()->currentTweens)
-		{
-			arr.Add(e->tweenName);
-		}
+//The event if it is still a tween of the aux
+static AiTweenEvent* FindEvent(AiTAux* aux, AiTweenEvent* object)
+{
+	if (aux && object && aux->tweenRegistry.FindByIndex(object->tweenIndex) == object)
+	{
+		return object;
 	}
+	return nullptr;
+}
 
+void UiTween::StopTweeningByIndex(int32 index)
+{
+	AiTAux* aux = GetAux();
+	AiTweenEvent* e = aux ? aux->tweenRegistry.FindByIndex(index) : nullptr;
+	if (e)
+	{
+		e->EndPhase();
+	}
 }
 
-void UiTween::StopTweeningByTweeningObjectReference(UObject* object)
+void UiTween::StopTweeningByTweeningObjectName(FName objectName)
 {
-	TArray<UObject*> arr;
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	if (AiTAux* aux = GetAux())
 	{
-		if (e->actorTweening != nullptr)
-		{
-			arr.Add(e->actorTweening);
-		}
-		else if (e->componentTweening != nullptr)
-		{
-			arr.Add(e->componentTweening);
-		}
-		else if (e->widgetTweening != nullptr)
-		{
-			arr.Add(e->widgetTweening);
-		}
+		StopEvents(aux->tweenRegistry.FindByObjectName(objectName));
+
+		//Pooled tweens
+		aux->tweenPool.Stop(EiTweenPoolMatch::objectName, objectName);
 	}
-	while (arr.Contains(object))
+}
+
+void UiTween::StopTweeningByTweenName(FName tweenName)
+{
+	if (AiTAux* aux = GetAux())
 	{
-		for (AiTweenEvent* e : GetAux()->currentTweens)
-		{
-			if (e->actorTweening != nullptr)
-			{
-				if (e->actorTweening == object)
-				{
-					e->EndPhase();
-				}
-			}
-			else if (e->componentTweening != nullptr)
-			{
-				if (e->componentTweening == object)
-				{
-					e->EndPhase();
-				}
-			}
-			else if (e->widgetTweening != nullptr)
-			{
-				if (e->widgetTweening == object)
-				{
-					e->EndPhase();
-				}
-			}
+		StopEvents(aux->tweenRegistry.FindByTweenName(tweenName));
 
-			break;
-		}
+		//Pooled tweens
+		aux->tweenPool.Stop(EiTweenPoolMatch::tweenName, tweenName);
+	}
+}
 
-		arr.Empty();
+void UiTween::StopTweeningByTweeningObjectReference(UObject* object)
+{
+	if (AiTAux* aux = GetAux())
+	{
+		StopEvents(aux->tweenRegistry.FindByObject(object));
 
-		for (AiTweenEvent* e : GetAux()->currentTweens)
-		{
-			if (e->actorTweening != nullptr)
-			{
-				arr.Add(e->actorTweening);
-			}
-			else if (e->componentTweening != nullptr)
-			{
-				arr.Add(e->componentTweening);
-			}
-			else if (e->widgetTweening != nullptr)
-			{
-				arr.Add(e->widgetTweening);
-			}
-		}
+		//Pooled tweens
+		aux->tweenPool.Stop(EiTweenPoolMatch::objectReference, NAME_None, object);
 	}
 }
 
 void UiTween::StopTweeningByEventReference(AiTweenEvent* object)
 {
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	if (AiTweenEvent* e = FindEvent(GetAux(), object))
 	{
-		if (e == object)
-		{
-			e->EndPhase();
-		}
+		e->EndPhase();
 	}
 }
 
 void UiTween::StopAllTweens()
 {
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	if (AiTAux* aux = GetAux())
 	{
-		e->EndPhase();
+		StopEvents(aux->currentTweens);
+
+		//Pooled tweens
+		aux->tweenPool.Stop(EiTweenPoolMatch::all);
 	}
 }
 
 void UiTween::PauseTweeningByIndex(int32 index)
 {
-	AiTweenEvent* e = GetAux()->currentTweens[index];
-	e->isTweenPaused = true;
-	e->shouldTick = false;
+	AiTAux* aux = GetAux();
+	AiTweenEvent* e = aux ? aux->tweenRegistry.FindByIndex(index) : nullptr;
+	if (e)
+	{
+		e->isTweenPaused = true;
+		e->shouldTick = false;
+	}
 }
 
 void UiTween::PauseTweeningByTweeningObjectName(FName objectName)
 {
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	if (AiTAux* aux = GetAux())
 	{
-		if (e->actorTweening != nullptr)
-		{
-			if (e->actorTweening->GetFName() == objectName)
-			{
-				e->isTweenPaused = true;
-				e->shouldTick = false;
-			}
-		}
-		else if (e->componentTweening != nullptr)
-		{
-			if (e->componentTweening->GetFName() == objectName)
-			{
-				e->isTweenPaused = true;
-				e->shouldTick = false;
-			}
-		}
-		else if (e->widgetTweening != nullptr)
-		{
-			if (e->widgetTweening->GetFName() == objectName)
-			{
-				e->isTweenPaused = true;
-				e->shouldTick = false;
-			}
-		}
+		SetEventsPaused(aux->tweenRegistry.FindByObjectName(objectName), true);
+
+		//Pooled tweens
+		aux->tweenPool.SetPaused(true, EiTweenPoolMatch::objectName, objectName);
 	}
 }
 
 void UiTween::PauseTweeningByTweenName(FName tweenName)
 {
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	if (AiTAux* aux = GetAux())
 	{
-		if (e->tweenName == tweenName)
-		{
-			e->isTweenPaused = true;
-			e->shouldTick = false;
-		}
+		SetEventsPaused(aux->tweenRegistry.FindByTweenName(tweenName), true);
+
+		//Pooled tweens
+		aux->tweenPool.SetPaused(true, EiTweenPoolMatch::tweenName, tweenName);
 	}
 }
 
 void UiTween::PauseTweeningByTweeningObjectReference(UObject* object)
 {
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	if (AiTAux* aux = GetAux())
 	{
-		if (e->actorTweening != nullptr)
-		{
-			if (e->actorTweening == object)
-			{
-				e->isTweenPaused = true;
-				e->shouldTick = false;
-			}
-		}
-		else if (e->componentTweening != nullptr)
-		{
-			if (e->componentTweening == object)
-			{
-				e->isTweenPaused = true;
-				e->shouldTick = false;
-			}
-		}
-		else if (e->widgetTweening != nullptr)
-		{
-			if (e->widgetTweening == object)
-			{
-				e->isTweenPaused = true;
-				e->shouldTick = false;
-			}
-		}
+		SetEventsPaused(aux->tweenRegistry.FindByObject(object), true);
+
+		//Pooled tweens
+		aux->tweenPool.SetPaused(true, EiTweenPoolMatch::objectReference, NAME_None, object);
 	}
 }
 
 void UiTween::PauseTweeningByEventReference(AiTweenEvent* object)
 {
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	if (AiTweenEvent* e = FindEvent(GetAux(), object))
 	{
-		if (e == object)
-		{
-			e->isTweenPaused = true;
-			e->shouldTick = false;
-		}
+		e->isTweenPaused = true;
+		e->shouldTick = false;
 	}
 }
 
 void UiTween::PauseAllTweens()
 {
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	if (AiTAux* aux = GetAux())
 	{
-		e->isTweenPaused = true;
-		e->shouldTick = false;
+		SetEventsPaused(aux->currentTweens, true);
+
+		//Pooled tweens
+		aux->tweenPool.SetPaused(true, EiTweenPoolMatch::all);
 	}
 }
 
 void UiTween::ResumeTweeningByIndex(int32 index)
 {
-	AiTweenEvent* e = GetAux()->currentTweens[index];
-	e->isTweenPaused = false;
-	e->shouldTick = true;
+	AiTAux* aux = GetAux();
+	AiTweenEvent* e = aux ? aux->tweenRegistry.FindByIndex(index) : nullptr;
+	if (e)
+	{
+		e->isTweenPaused = false;
+		e->shouldTick = true;
+	}
 }
 
 void UiTween::ResumeTweeningByTweeningObjectName(FName objectName)
 {
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	if (AiTAux* aux = GetAux())
 	{
-		if (e->actorTweening != nullptr)
-		{
-			if (e->actorTweening->GetFName() == objectName)
-			{
-				e->isTweenPaused = false;
-				e->shouldTick = true;
-			}
-		}
-		else if (e->componentTweening != nullptr)
-		{
-			if (e->componentTweening->GetFName() == objectName)
-			{
-				e->isTweenPaused = false;
-				e->shouldTick = true;
-			}
-		}
-		else if (e->widgetTweening != nullptr)
-		{
-			if (e->widgetTweening->GetFName() == objectName)
-			{
-				e->isTweenPaused = false;
-				e->shouldTick = true;
-			}
-		}
+		SetEventsPaused(aux->tweenRegistry.FindByObjectName(objectName), false);
+
+		//Pooled tweens
+		aux->tweenPool.SetPaused(false, EiTweenPoolMatch::objectName, objectName);
 	}
 }
 
 void UiTween::ResumeTweeningByTweenName(FName tweenName)
 {
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	if (AiTAux* aux = GetAux())
 	{
-		if (e->tweenName == tweenName)
-		{
-			e->isTweenPaused = false;
-			e->shouldTick = true;
-		}
+		SetEventsPaused(aux->tweenRegistry.FindByTweenName(tweenName), false);
+
+		//Pooled tweens
+		aux->tweenPool.SetPaused(false, EiTweenPoolMatch::tweenName, tweenName);
 	}
 }
 
 void UiTween::ResumeTweeningByTweeningObjectReference(UObject* object)
 {
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	if (AiTAux* aux = GetAux())
 	{
-		if (e->actorTweening != nullptr)
-		{
-			if (e->actorTweening == object)
-			{
-				e->isTweenPaused = false;
-				e->shouldTick = true;
-			}
-		}
-		else if (e->componentTweening != nullptr)
-		{
-			if (e->componentTweening == object)
-			{
-				e->isTweenPaused = false;
-				e->shouldTick = true;
-			}
-		}
-		else if (e->widgetTweening != nullptr)
-		{
-			if (e->widgetTweening == object)
-			{
-				e->isTweenPaused = false;
-				e->shouldTick = true;
-			}
-		}
+		SetEventsPaused(aux->tweenRegistry.FindByObject(object), false);
+
+		//Pooled tweens
+		aux->tweenPool.SetPaused(false, EiTweenPoolMatch::objectReference, NAME_None, object);
 	}
 }
 
 void UiTween::ResumeTweeningByEventReference(AiTweenEvent* object)
 {
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	if (AiTweenEvent* e = FindEvent(GetAux(), object))
 	{
-		if (e == object)
-		{
-			e->isTweenPaused = false;
-			e->shouldTick = true;
-		}
+		e->isTweenPaused = false;
+		e->shouldTick = true;
 	}
 }
 
 void UiTween::ResumeAllTweens()
 {
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	if (AiTAux* aux = GetAux())
 	{
-		e->isTweenPaused = false;
-		e->shouldTick = true;
+		SetEventsPaused(aux->currentTweens, false);
+
+		//Pooled tweens
+		aux->tweenPool.SetPaused(false, EiTweenPoolMatch::all);
 	}
 }
 
-//Get iTweenEvents
-AiTweenEvent* UiTween::GetEventByIndex(int32 index)
+void UiTween::StopTweeningByHandle(const FiTweenHandle& handle)
 {
-	return GetAux()->currentTweens[index];
+	if (handle.event)
+	{
+		StopTweeningByEventReference(handle.event);
+	}
+	else if (AiTAux* aux = GetAux())
+	{
+		aux->tweenPool.StopById(handle.poolId);
+	}
 }
 
-TArray<AiTweenEvent*> UiTween::GetEventsByTweeningObjectName(FName objectName)
+void UiTween::PauseTweeningByHandle(const FiTweenHandle& handle)
 {
-	TArray<AiTweenEvent*> arr;
-
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+	if (handle.event)
 	{
-		if (e->actorTweening != nullptr)
-		{
-			if (e->actorTweening->GetFName() == objectName)
-			{
-				arr.Add(e);
-			}
-		}
-		else if (e->componentTweening != nullptr)
-		{
-			if (e->componentTweening->GetFName() == objectName)
-			{
-				arr.Add(e);
-			}
-		}
-		else if (e->widgetTweening != nullptr)
-		{
-			if (e->widgetTweening->GetFName() == objectName)
-			{
-				arr.Add(e);
-			}
-		}
+		PauseTweeningByEventReference(handle.event);
+	}
+	else if (AiTAux* aux = GetAux())
+	{
+		aux->tweenPool.SetPausedById(true, handle.poolId);
 	}
+}
 
-	return arr;
+void UiTween::ResumeTweeningByHandle(const FiTweenHandle& handle)
+{
+	if (handle.event)
+	{
+		ResumeTweeningByEventReference(handle.event);
+	}
+	else if (AiTAux* aux = GetAux())
+	{
+		aux->tweenPool.SetPausedById(false, handle.poolId);
+	}
 }
 
-TArray<AiTweenEvent*> UiTween::GetEventsByTweenName(FName tweenName)
+bool UiTween::IsTweenActive(const FiTweenHandle& handle)
 {
-	TArray<AiTweenEvent*> arr;
+	AiTAux* aux = GetAux();
+	if (handle.event)
+	{
+		return FindEvent(aux, handle.event) != nullptr;
+	}
+	return aux && aux->tweenPool.IsActiveById(handle.poolId);
+}
 
-	for (AiTweenEvent* e : GetAux()->currentTweens)
+void UiTween::BakeEasingTables()
+{
+	if (AiTAux* aux = GetAux())
 	{
-		if (e->tweenName == tweenName)
-		{
-			arr.Add(e);
-		}
+		aux->BakeEasingTables();
 	}
+}
 
-	return arr;
+//Get iTweenEvents
+AiTweenEvent* UiTween::GetEventByIndex(int32 index)
+{
+	AiTAux* aux = GetAux();
+	return aux ? aux->tweenRegistry.FindByIndex(index) : nullptr;
 }
 
-TArray<AiTweenEvent*> UiTween::GetEventsByTweeningObjectReference(UObject* object)
+TArray<AiTweenEvent*> UiTween::GetEventsByTweeningObjectName(FName objectName)
 {
-	TArray<AiTweenEvent*> arr;
+	AiTAux* aux = GetAux();
+	return aux ? aux->tweenRegistry.FindByObjectName(objectName) : TArray<AiTweenEvent*>();
+}
 
-	for (AiTweenEvent* e : GetAux()->currentTweens)
-	{
-		if (e->actorTweening != nullptr)
-		{
-			if (e->actorTweening == object)
-			{
-				arr.Add(e);
-			}
-		}
-		else if (e->componentTweening != nullptr)
-		{
-			if (e->componentTweening == object)
-			{
-				arr.Add(e);
-			}
-		}
-		else if (e->widgetTweening != nullptr)
-		{
-			if (e->widgetTweening == object)
-			{
-				arr.Add(e);
-			}
-		}
-	}
+TArray<AiTweenEvent*> UiTween::GetEventsByTweenName(FName tweenName)
+{
+	AiTAux* aux = GetAux();
+	return aux ? aux->tweenRegistry.FindByTweenName(tweenName) : TArray<AiTweenEvent*>();
+}
 
-	return arr;
+TArray<AiTweenEvent*> UiTween::GetEventsByTweeningObjectReference(UObject* object)
+{
+	AiTAux* aux = GetAux();
+	return aux ? aux->tweenRegistry.FindByObject(object) : TArray<AiTweenEvent*>();
 }
 
 //FRotator UiTween::GetActorRotationByParent(AActor* actor)
@@ -722,10 +619,55 @@ TArray<AiTweenEvent*> UiTween::GetEventsByTweeningObjectReference(UObject* objec
 //Actor
 //Actor Move From/To
 AiTweenEvent* UiTween::ActorMoveFromToFull(float timerInterval /*= 0.f*/, FName tweenName /*= "No Name"*/, AActor* actorToMove /*= nullptr*/, FVector locationFrom /*= FVector::ZeroVector*/, FVector locationTo /*= FVector::ZeroVector*/, bool enforceValueTo /*= true*/, EVectorConstraints::VectorConstraints vectorConstraints /*= VectorConstraints::none*/, ECoordinateSpace::CoordinateSpace coordinateSpace /*= CoordinateSpace::world*/, bool sweep /*= false*/, float delay /*= 0.0f*/, EDelayType::DelayType delayType /*= first*/, ETickType::TickType tickType /*= seconds*/, float tickTypeValue /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, UCurveFloat* customEaseTypeCurve /*= nullptr*/, float punchAmplitude /*= 1.0f*/, ELoopType::LoopType loopType /*= once*/, int32 maximumLoopSections /*= 0*/, ELookType::LookType orientation /*= noOrientationChange*/, UObject* orientationTarget /*= nullptr*/, float orientationSpeed /*= 5.0f*/, ERotatorConstraints::RotatorConstraints rotatorConstraints /*= RotatorConstraints::none*/, UObject* onTweenStartTarget /*= nullptr*/, FString OnTweenStartFunctionName /*= ""*/, UObject* onTweenUpdateTarget /*= nullptr*/, FString OnTweenUpdateFunctionName /*= ""*/, UObject* onTweenLoopTarget /*= nullptr*/, FString OnTweenLoopFunctionName /*= ""*/, UObject* onTweenCompleteTarget /*= nullptr*/, FString OnTweenCompleteFunctionName /*= ""*/, bool tickWhenPaused /*= false*/, bool ignoreTimeDilation /*= false*/, bool tieToObjectValidity /*= true*/, bool cullNonRenderedTweens /*= false*/, float secondsToWaitBeforeCull /*= 3.f*/)
+{
+	return ActorMoveFromToFullWithHandle(timerInterval, tweenName, actorToMove, locationFrom, locationTo, enforceValueTo, vectorConstraints, coordinateSpace, sweep, delay, delayType, tickType, tickTypeValue, easeType, customEaseTypeCurve, punchAmplitude, loopType, maximumLoopSections, orientation, orientationTarget, orientationSpeed, rotatorConstraints, onTweenStartTarget, OnTweenStartFunctionName, onTweenUpdateTarget, OnTweenUpdateFunctionName, onTweenLoopTarget, OnTweenLoopFunctionName, onTweenCompleteTarget, OnTweenCompleteFunctionName, tickWhenPaused, ignoreTimeDilation, tieToObjectValidity, cullNonRenderedTweens, secondsToWaitBeforeCull).event;
+}
+
+FiTweenHandle UiTween::ActorMoveFromToFullWithHandle(float timerInterval /*= 0.f*/, FName tweenName /*= "No Name"*/, AActor* actorToMove /*= nullptr*/, FVector locationFrom /*= FVector::ZeroVector*/, FVector locationTo /*= FVector::ZeroVector*/, bool enforceValueTo /*= true*/, EVectorConstraints::VectorConstraints vectorConstraints /*= VectorConstraints::none*/, ECoordinateSpace::CoordinateSpace coordinateSpace /*= CoordinateSpace::world*/, bool sweep /*= false*/, float delay /*= 0.0f*/, EDelayType::DelayType delayType /*= first*/, ETickType::TickType tickType /*= seconds*/, float tickTypeValue /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, UCurveFloat* customEaseTypeCurve /*= nullptr*/, float punchAmplitude /*= 1.0f*/, ELoopType::LoopType loopType /*= once*/, int32 maximumLoopSections /*= 0*/, ELookType::LookType orientation /*= noOrientationChange*/, UObject* orientationTarget /*= nullptr*/, float orientationSpeed /*= 5.0f*/, ERotatorConstraints::RotatorConstraints rotatorConstraints /*= RotatorConstraints::none*/, UObject* onTweenStartTarget /*= nullptr*/, FString OnTweenStartFunctionName /*= ""*/, UObject* onTweenUpdateTarget /*= nullptr*/, FString OnTweenUpdateFunctionName /*= ""*/, UObject* onTweenLoopTarget /*= nullptr*/, FString OnTweenLoopFunctionName /*= ""*/, UObject* onTweenCompleteTarget /*= nullptr*/, FString OnTweenCompleteFunctionName /*= ""*/, bool tickWhenPaused /*= false*/, bool ignoreTimeDilation /*= false*/, bool tieToObjectValidity /*= true*/, bool cullNonRenderedTweens /*= false*/, float secondsToWaitBeforeCull /*= 3.f*/)
 {
 	//Make sure we have a valid object to tween before proceeding
 	if (actorToMove)
 	{
+		//Plain transform tweens run on the tween pool of the aux, no event actor is spawned, the handle gets the pool id
+		if (FMath::Abs(timerInterval) <= 0.0001f && coordinateSpace == CoordinateSpace::world && orientation == LookType::noOrientationChange && !tickWhenPaused && !ignoreTimeDilation && !cullNonRenderedTweens)
+		{
+			FiTweenPoolDesc desc;
+			desc.eventType = EEventType::EventType::actorMoveFromTo;
+			desc.tweenName = tweenName;
+			desc.actorTweening = actorToMove;
+			desc.vectorFrom = locationFrom;
+			desc.vectorTo = locationTo;
+			desc.sweep = sweep;
+			desc.enforceValueTo = enforceValueTo;
+			desc.vectorConstraints = vectorConstraints;
+			desc.rotatorConstraints = rotatorConstraints;
+			desc.tieToObjectValidity = tieToObjectValidity;
+			desc.delay = delay;
+			desc.delayType = delayType;
+			desc.tickType = tickType;
+			desc.tickTypeValue = tickTypeValue;
+			desc.easeType = easeType;
+			desc.customEaseTypeCurve = customEaseTypeCurve;
+			desc.punchAmplitude = punchAmplitude;
+			desc.loopType = loopType;
+			desc.maximumLoopSections = maximumLoopSections;
+			desc.onTweenStartTarget = onTweenStartTarget;
+			desc.OnTweenStartFunctionName = OnTweenStartFunctionName;
+			desc.onTweenUpdateTarget = onTweenUpdateTarget;
+			desc.OnTweenUpdateFunctionName = OnTweenUpdateFunctionName;
+			desc.onTweenLoopTarget = onTweenLoopTarget;
+			desc.OnTweenLoopFunctionName = OnTweenLoopFunctionName;
+			desc.onTweenCompleteTarget = onTweenCompleteTarget;
+			desc.OnTweenCompleteFunctionName = OnTweenCompleteFunctionName;
+
+			FiTweenHandle handle;
+			handle.poolId = AddPooledTween(GetAux(), desc);
+			if (handle.poolId != INDEX_NONE)
+			{
+				return handle;
+			}
+		}
+
 		//Create Actor Instance
 		AiTweenEvent* ie = (AiTweenEvent*)SpawnEvent(GetAux());
 		//Set Event Type
@@ -773,15 +715,45 @@ AiTweenEvent* UiTween::ActorMoveFromToFull(float timerInterval /*= 0.f*/, FName
 	else
 	{
 		Print("No tweenable object defined. No tweening operation will occur.", "error");
-		return nullptr;
+		return FiTweenHandle();
 	}
 }
 
 AiTweenEvent* UiTween::ActorMoveFromToSimple(FName tweenName /*= "No Name"*/, AActor* actorToMove /*= nullptr*/, FVector locationFrom /*= FVector::ZeroVector*/, FVector locationTo /*= FVector::ZeroVector*/, ECoordinateSpace::CoordinateSpace coordinateSpace, bool sweep, float timeInSeconds /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, FString parameters, UObject* onTweenStartTarget /*= nullptr*/, UObject* onTweenUpdateTarget /*= nullptr*/, UObject* onTweenLoopTarget /*= nullptr*/, UObject* onTweenCompleteTarget /*= nullptr*/)
+{
+	return ActorMoveFromToSimpleWithHandle(tweenName, actorToMove, locationFrom, locationTo, coordinateSpace, sweep, timeInSeconds, easeType, parameters, onTweenStartTarget, onTweenUpdateTarget, onTweenLoopTarget, onTweenCompleteTarget).event;
+}
+
+FiTweenHandle UiTween::ActorMoveFromToSimpleWithHandle(FName tweenName /*= "No Name"*/, AActor* actorToMove /*= nullptr*/, FVector locationFrom /*= FVector::ZeroVector*/, FVector locationTo /*= FVector::ZeroVector*/, ECoordinateSpace::CoordinateSpace coordinateSpace, bool sweep, float timeInSeconds /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, FString parameters, UObject* onTweenStartTarget /*= nullptr*/, UObject* onTweenUpdateTarget /*= nullptr*/, UObject* onTweenLoopTarget /*= nullptr*/, UObject* onTweenCompleteTarget /*= nullptr*/)
 {
 	//Make sure we have a valid object to tween before proceeding
 	if (actorToMove)
 	{
+		//Plain transform tweens run on the tween pool of the aux, no event actor is spawned, the handle gets the pool id
+		if (coordinateSpace == CoordinateSpace::world && parameters == "")
+		{
+			FiTweenPoolDesc desc;
+			desc.eventType = EEventType::EventType::actorMoveFromTo;
+			desc.tweenName = tweenName;
+			desc.actorTweening = actorToMove;
+			desc.vectorFrom = locationFrom;
+			desc.vectorTo = locationTo;
+			desc.sweep = sweep;
+			desc.tickTypeValue = timeInSeconds;
+			desc.easeType = easeType;
+			desc.onTweenStartTarget = onTweenStartTarget;
+			desc.onTweenUpdateTarget = onTweenUpdateTarget;
+			desc.onTweenLoopTarget = onTweenLoopTarget;
+			desc.onTweenCompleteTarget = onTweenCompleteTarget;
+
+			FiTweenHandle handle;
+			handle.poolId = AddPooledTween(GetAux(), desc);
+			if (handle.poolId != INDEX_NONE)
+			{
+				return handle;
+			}
+		}
+
 		//Create Actor Instance
 		AiTweenEvent* ie = (AiTweenEvent*)SpawnEvent(GetAux());
 		//Set Event Type
@@ -809,7 +781,7 @@ AiTweenEvent* UiTween::ActorMoveFromToSimple(FName tweenName /*= "No Name"*/, AA
 	else
 	{
 		Print("No tweenable object defined. No tweening operation will occur.", "error");
-		return nullptr;
+		return FiTweenHandle();
 	}
 }
 
@@ -1114,10 +1086,54 @@ void UiTween::ActorMoveUpdate(AActor* actorToMove, FVector locationTo, float del
 
 //Actor Rotate From/To
 AiTweenEvent* UiTween::ActorRotateFromToFull(float timerInterval, FName tweenName /*= "No Name"*/, AActor* actorToRotate /*= nullptr*/, FRotator rotationFrom /*= FRotator::ZeroRotator*/, FRotator rotationTo /*= FRotator::ZeroRotator*/, bool enforceValueTo, ERotatorConstraints::RotatorConstraints rotatorConstraints /*= VectorConstraints::none*/, ECoordinateSpace::CoordinateSpace coordinateSpace, bool shortestPath /*= false*/, float delay /*= 0.0f*/, EDelayType::DelayType delayType /*= first*/, ETickType::TickType tickType /*= seconds*/, float tickTypeValue /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, UCurveFloat* customEaseTypeCurve /*= nullptr*/, float punchAmplitude /*= 1.0f*/, ELoopType::LoopType loopType /*= once*/, int32 maximumLoopSections, UObject* onTweenStartTarget /*= nullptr*/, FString OnTweenStartFunctionName /*= ""*/, UObject* onTweenUpdateTarget /*= nullptr*/, FString OnTweenUpdateFunctionName /*= ""*/, UObject* onTweenLoopTarget /*= nullptr*/, FString OnTweenLoopFunctionName /*= ""*/, UObject* onTweenCompleteTarget /*= nullptr*/, FString OnTweenCompleteFunctionName /*= ""*/, bool tickWhenPaused /*= false*/, bool ignoreTimeDilation /*= false*/, bool tieToObjectValidity, bool cullNonRenderedTweens, float secondsToWaitBeforeCull)
+{
+	return ActorRotateFromToFullWithHandle(timerInterval, tweenName, actorToRotate, rotationFrom, rotationTo, enforceValueTo, rotatorConstraints, coordinateSpace, shortestPath, delay, delayType, tickType, tickTypeValue, easeType, customEaseTypeCurve, punchAmplitude, loopType, maximumLoopSections, onTweenStartTarget, OnTweenStartFunctionName, onTweenUpdateTarget, OnTweenUpdateFunctionName, onTweenLoopTarget, OnTweenLoopFunctionName, onTweenCompleteTarget, OnTweenCompleteFunctionName, tickWhenPaused, ignoreTimeDilation, tieToObjectValidity, cullNonRenderedTweens, secondsToWaitBeforeCull).event;
+}
+
+FiTweenHandle UiTween::ActorRotateFromToFullWithHandle(float timerInterval, FName tweenName /*= "No Name"*/, AActor* actorToRotate /*= nullptr*/, FRotator rotationFrom /*= FRotator::ZeroRotator*/, FRotator rotationTo /*= FRotator::ZeroRotator*/, bool enforceValueTo, ERotatorConstraints::RotatorConstraints rotatorConstraints /*= VectorConstraints::none*/, ECoordinateSpace::CoordinateSpace coordinateSpace, bool shortestPath /*= false*/, float delay /*= 0.0f*/, EDelayType::DelayType delayType /*= first*/, ETickType::TickType tickType /*= seconds*/, float tickTypeValue /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, UCurveFloat* customEaseTypeCurve /*= nullptr*/, float punchAmplitude /*= 1.0f*/, ELoopType::LoopType loopType /*= once*/, int32 maximumLoopSections, UObject* onTweenStartTarget /*= nullptr*/, FString OnTweenStartFunctionName /*= ""*/, UObject* onTweenUpdateTarget /*= nullptr*/, FString OnTweenUpdateFunctionName /*= ""*/, UObject* onTweenLoopTarget /*= nullptr*/, FString OnTweenLoopFunctionName /*= ""*/, UObject* onTweenCompleteTarget /*= nullptr*/, FString OnTweenCompleteFunctionName /*= ""*/, bool tickWhenPaused /*= false*/, bool ignoreTimeDilation /*= false*/, bool tieToObjectValidity, bool cullNonRenderedTweens, float secondsToWaitBeforeCull)
 {
 	//Make sure we have a valid object to tween before proceeding
 	if (actorToRotate)
 	{
+		//Plain transform tweens run on the tween pool of the aux, no event actor is spawned, the handle gets the pool id
+		if (FMath::Abs(timerInterval) <= 0.0001f && coordinateSpace == CoordinateSpace::world && !tickWhenPaused && !ignoreTimeDilation && !cullNonRenderedTweens)
+		{
+			FiTweenPoolDesc desc;
+			desc.eventType = EEventType::EventType::actorRotateFromTo;
+			desc.tweenName = tweenName;
+			desc.actorTweening = actorToRotate;
+			desc.rotatorFrom = rotationFrom;
+			desc.rotatorTo = rotationTo;
+			desc.shortestPath = shortestPath;
+			desc.enforceValueTo = enforceValueTo;
+			desc.rotatorConstraints = rotatorConstraints;
+			desc.tieToObjectValidity = tieToObjectValidity;
+			desc.delay = delay;
+			desc.delayType = delayType;
+			desc.tickType = tickType;
+			desc.tickTypeValue = tickTypeValue;
+			desc.easeType = easeType;
+			desc.customEaseTypeCurve = customEaseTypeCurve;
+			desc.punchAmplitude = punchAmplitude;
+			desc.loopType = loopType;
+			desc.maximumLoopSections = maximumLoopSections;
+			desc.onTweenStartTarget = onTweenStartTarget;
+			desc.OnTweenStartFunctionName = OnTweenStartFunctionName;
+			desc.onTweenUpdateTarget = onTweenUpdateTarget;
+			desc.OnTweenUpdateFunctionName = OnTweenUpdateFunctionName;
+			desc.onTweenLoopTarget = onTweenLoopTarget;
+			desc.OnTweenLoopFunctionName = OnTweenLoopFunctionName;
+			desc.onTweenCompleteTarget = onTweenCompleteTarget;
+			desc.OnTweenCompleteFunctionName = OnTweenCompleteFunctionName;
+
+			FiTweenHandle handle;
+			handle.poolId = AddPooledTween(GetAux(), desc);
+			if (handle.poolId != INDEX_NONE)
+			{
+				return handle;
+			}
+		}
+
 		//Create Actor Instance
 		AiTweenEvent* ie = (AiTweenEvent*)SpawnEvent(GetAux());
 		//Set Event Type
@@ -1162,15 +1178,45 @@ AiTweenEvent* UiTween::ActorRotateFromToFull(float timerInterval, FName tweenNam
 	else
 	{
 		Print("No tweenable object defined. No tweening operation will occur.", "error");
-		return nullptr;
+		return FiTweenHandle();
 	}
 }
 
 AiTweenEvent* UiTween::ActorRotateFromToSimple(FName tweenName /*= "No Name"*/, AActor* actorToRotate /*= nullptr*/, FRotator rotationFrom /*= FRotator::ZeroRotator*/, FRotator rotationTo /*= FRotator::ZeroRotator*/, ECoordinateSpace::CoordinateSpace coordinateSpace, bool shortestPath /*= false*/, float timeInSeconds /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, FString parameters, UObject* onTweenStartTarget /*= nullptr*/, UObject* onTweenUpdateTarget /*= nullptr*/, UObject* onTweenLoopTarget /*= nullptr*/, UObject* onTweenCompleteTarget /*= nullptr*/)
+{
+	return ActorRotateFromToSimpleWithHandle(tweenName, actorToRotate, rotationFrom, rotationTo, coordinateSpace, shortestPath, timeInSeconds, easeType, parameters, onTweenStartTarget, onTweenUpdateTarget, onTweenLoopTarget, onTweenCompleteTarget).event;
+}
+
+FiTweenHandle UiTween::ActorRotateFromToSimpleWithHandle(FName tweenName /*= "No Name"*/, AActor* actorToRotate /*= nullptr*/, FRotator rotationFrom /*= FRotator::ZeroRotator*/, FRotator rotationTo /*= FRotator::ZeroRotator*/, ECoordinateSpace::CoordinateSpace coordinateSpace, bool shortestPath /*= false*/, float timeInSeconds /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, FString parameters, UObject* onTweenStartTarget /*= nullptr*/, UObject* onTweenUpdateTarget /*= nullptr*/, UObject* onTweenLoopTarget /*= nullptr*/, UObject* onTweenCompleteTarget /*= nullptr*/)
 {
 	//Make sure we have a valid object to tween before proceeding
 	if (actorToRotate)
 	{
+		//Plain transform tweens run on the tween pool of the aux, no event actor is spawned, the handle gets the pool id
+		if (coordinateSpace == CoordinateSpace::world && parameters == "")
+		{
+			FiTweenPoolDesc desc;
+			desc.eventType = EEventType::EventType::actorRotateFromTo;
+			desc.tweenName = tweenName;
+			desc.actorTweening = actorToRotate;
+			desc.rotatorFrom = rotationFrom;
+			desc.rotatorTo = rotationTo;
+			desc.shortestPath = shortestPath;
+			desc.tickTypeValue = timeInSeconds;
+			desc.easeType = easeType;
+			desc.onTweenStartTarget = onTweenStartTarget;
+			desc.onTweenUpdateTarget = onTweenUpdateTarget;
+			desc.onTweenLoopTarget = onTweenLoopTarget;
+			desc.onTweenCompleteTarget = onTweenCompleteTarget;
+
+			FiTweenHandle handle;
+			handle.poolId = AddPooledTween(GetAux(), desc);
+			if (handle.poolId != INDEX_NONE)
+			{
+				return handle;
+			}
+		}
+
 		//Create Actor Instance
 		AiTweenEvent* ie = (AiTweenEvent*)SpawnEvent(GetAux());
 		//Set Event Type
@@ -1199,7 +1245,7 @@ AiTweenEvent* UiTween::ActorRotateFromToSimple(FName tweenName /*= "No Name"*/,
 	else
 	{
 		Print("No tweenable object defined. No tweening operation will occur.", "error");
-		return nullptr;
+		return FiTweenHandle();
 	}
 }
 
@@ -1478,10 +1524,53 @@ void UiTween::ActorRotateUpdate(AActor* actorToRotate, FRotator rotationTo, floa
 
 //Actor Scale From/To
 AiTweenEvent* UiTween::ActorScaleFromToFull(float timerInterval, FName tweenName /*= "No Name"*/, AActor* actorToScale /*= nullptr*/, FVector scaleFrom /*= FVector::ZeroVector*/, FVector scaleTo /*= FVector(1,1,1)*/, bool enforceValueTo, EVectorConstraints::VectorConstraints vectorConstraints /*= VectorConstraints::none*/, bool isLocal, float delay /*= 0.0f*/, EDelayType::DelayType delayType /*= first*/, ETickType::TickType tickType /*= seconds*/, float tickTypeValue /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, UCurveFloat* customEaseTypeCurve /*= nullptr*/, float punchAmplitude /*= 1.0f*/, ELoopType::LoopType loopType /*= once*/, int32 maximumLoopSections, UObject* onTweenStartTarget /*= nullptr*/, FString OnTweenStartFunctionName /*= ""*/, UObject* onTweenUpdateTarget /*= nullptr*/, FString OnTweenUpdateFunctionName /*= ""*/, UObject* onTweenLoopTarget /*= nullptr*/, FString OnTweenLoopFunctionName /*= ""*/, UObject* onTweenCompleteTarget /*= nullptr*/, FString OnTweenCompleteFunctionName /*= ""*/, bool tickWhenPaused /*= false*/, bool ignoreTimeDilation /*= false*/, bool tieToObjectValidity, bool cullNonRenderedTweens, float secondsToWaitBeforeCull)
+{
+	return ActorScaleFromToFullWithHandle(timerInterval, tweenName, actorToScale, scaleFrom, scaleTo, enforceValueTo, vectorConstraints, isLocal, delay, delayType, tickType, tickTypeValue, easeType, customEaseTypeCurve, punchAmplitude, loopType, maximumLoopSections, onTweenStartTarget, OnTweenStartFunctionName, onTweenUpdateTarget, OnTweenUpdateFunctionName, onTweenLoopTarget, OnTweenLoopFunctionName, onTweenCompleteTarget, OnTweenCompleteFunctionName, tickWhenPaused, ignoreTimeDilation, tieToObjectValidity, cullNonRenderedTweens, secondsToWaitBeforeCull).event;
+}
+
+FiTweenHandle UiTween::ActorScaleFromToFullWithHandle(float timerInterval, FName tweenName /*= "No Name"*/, AActor* actorToScale /*= nullptr*/, FVector scaleFrom /*= FVector::ZeroVector*/, FVector scaleTo /*= FVector(1,1,1)*/, bool enforceValueTo, EVectorConstraints::VectorConstraints vectorConstraints /*= VectorConstraints::none*/, bool isLocal, float delay /*= 0.0f*/, EDelayType::DelayType delayType /*= first*/, ETickType::TickType tickType /*= seconds*/, float tickTypeValue /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, UCurveFloat* customEaseTypeCurve /*= nullptr*/, float punchAmplitude /*= 1.0f*/, ELoopType::LoopType loopType /*= once*/, int32 maximumLoopSections, UObject* onTweenStartTarget /*= nullptr*/, FString OnTweenStartFunctionName /*= ""*/, UObject* onTweenUpdateTarget /*= nullptr*/, FString OnTweenUpdateFunctionName /*= ""*/, UObject* onTweenLoopTarget /*= nullptr*/, FString OnTweenLoopFunctionName /*= ""*/, UObject* onTweenCompleteTarget /*= nullptr*/, FString OnTweenCompleteFunctionName /*= ""*/, bool tickWhenPaused /*= false*/, bool ignoreTimeDilation /*= false*/, bool tieToObjectValidity, bool cullNonRenderedTweens, float secondsToWaitBeforeCull)
 {
 	//Make sure we have a valid object to tween before proceeding
 	if (actorToScale)
 	{
+		//Plain transform tweens run on the tween pool of the aux, no event actor is spawned, the handle gets the pool id
+		if (FMath::Abs(timerInterval) <= 0.0001f && !isLocal && !tickWhenPaused && !ignoreTimeDilation && !cullNonRenderedTweens)
+		{
+			FiTweenPoolDesc desc;
+			desc.eventType = EEventType::EventType::actorScaleFromTo;
+			desc.tweenName = tweenName;
+			desc.actorTweening = actorToScale;
+			desc.vectorFrom = scaleFrom;
+			desc.vectorTo = scaleTo;
+			desc.enforceValueTo = enforceValueTo;
+			desc.vectorConstraints = vectorConstraints;
+			desc.tieToObjectValidity = tieToObjectValidity;
+			desc.delay = delay;
+			desc.delayType = delayType;
+			desc.tickType = tickType;
+			desc.tickTypeValue = tickTypeValue;
+			desc.easeType = easeType;
+			desc.customEaseTypeCurve = customEaseTypeCurve;
+			desc.punchAmplitude = punchAmplitude;
+			desc.loopType = loopType;
+			desc.maximumLoopSections = maximumLoopSections;
+			desc.onTweenStartTarget = onTweenStartTarget;
+			desc.OnTweenStartFunctionName = OnTweenStartFunctionName;
+			desc.onTweenUpdateTarget = onTweenUpdateTarget;
+			desc.OnTweenUpdateFunctionName = OnTweenUpdateFunctionName;
+			desc.onTweenLoopTarget = onTweenLoopTarget;
+			desc.OnTweenLoopFunctionName = OnTweenLoopFunctionName;
+			desc.onTweenCompleteTarget = onTweenCompleteTarget;
+			desc.OnTweenCompleteFunctionName = OnTweenCompleteFunctionName;
+
+			FiTweenHandle handle;
+			handle.poolId = AddPooledTween(GetAux(), desc);
+			if (handle.poolId != INDEX_NONE)
+			{
+				return handle;
+			}
+		}
+
 		//Create Actor Instance
 		AiTweenEvent* ie = (AiTweenEvent*)SpawnEvent(GetAux());
 		//Set Event Type
@@ -1527,15 +1616,44 @@ AiTweenEvent* UiTween::ActorScaleFromToFull(float timerInterval, FName tweenName
 	else
 	{
 		Print("No tweenable object defined. No tweening operation will occur.", "error");
-		return nullptr;
+		return FiTweenHandle();
 	}
 }
 
 AiTweenEvent* UiTween::ActorScaleFromToSimple(FName tweenName /*= "No Name"*/, AActor* actorToScale /*= nullptr*/, FVector scaleFrom /*= FVector::ZeroVector*/, FVector scaleTo /*= FVector(1,1,1)*/, bool isLocal, float timeInSeconds /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, FString parameters, UObject* onTweenStartTarget /*= nullptr*/, UObject* onTweenUpdateTarget /*= nullptr*/, UObject* onTweenLoopTarget /*= nullptr*/, UObject* onTweenCompleteTarget /*= nullptr*/)
+{
+	return ActorScaleFromToSimpleWithHandle(tweenName, actorToScale, scaleFrom, scaleTo, isLocal, timeInSeconds, easeType, parameters, onTweenStartTarget, onTweenUpdateTarget, onTweenLoopTarget, onTweenCompleteTarget).event;
+}
+
+FiTweenHandle UiTween::ActorScaleFromToSimpleWithHandle(FName tweenName /*= "No Name"*/, AActor* actorToScale /*= nullptr*/, FVector scaleFrom /*= FVector::ZeroVector*/, FVector scaleTo /*= FVector(1,1,1)*/, bool isLocal, float timeInSeconds /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, FString parameters, UObject* onTweenStartTarget /*= nullptr*/, UObject* onTweenUpdateTarget /*= nullptr*/, UObject* onTweenLoopTarget /*= nullptr*/, UObject* onTweenCompleteTarget /*= nullptr*/)
 {
 	//Make sure we have a valid object to tween before proceeding
 	if (actorToScale)
 	{
+		//Plain transform tweens run on the tween pool of the aux, no event actor is spawned, the handle gets the pool id
+		if (!isLocal && parameters == "")
+		{
+			FiTweenPoolDesc desc;
+			desc.eventType = EEventType::EventType::actorScaleFromTo;
+			desc.tweenName = tweenName;
+			desc.actorTweening = actorToScale;
+			desc.vectorFrom = scaleFrom;
+			desc.vectorTo = scaleTo;
+			desc.tickTypeValue = timeInSeconds;
+			desc.easeType = easeType;
+			desc.onTweenStartTarget = onTweenStartTarget;
+			desc.onTweenUpdateTarget = onTweenUpdateTarget;
+			desc.onTweenLoopTarget = onTweenLoopTarget;
+			desc.onTweenCompleteTarget = onTweenCompleteTarget;
+
+			FiTweenHandle handle;
+			handle.poolId = AddPooledTween(GetAux(), desc);
+			if (handle.poolId != INDEX_NONE)
+			{
+				return handle;
+			}
+		}
+
 		//Create Actor Instance
 		AiTweenEvent* ie = (AiTweenEvent*)SpawnEvent(GetAux());
 		//Set Event Type
@@ -1566,7 +1684,7 @@ AiTweenEvent* UiTween::ActorScaleFromToSimple(FName tweenName /*= "No Name"*/, A
 	else
 	{
 		Print("No tweenable object defined. No tweening operation will occur.", "error");
-		return nullptr;
+		return FiTweenHandle();
 	}
 }
 
@@ -1657,10 +1775,55 @@ void UiTween::ActorScaleUpdate(AActor* actorToScale, FVector scaleTo, float delt
 //Component
 //Component Move From/To
 AiTweenEvent* UiTween::ComponentMoveFromToFull(float timerInterval, FName tweenName /*= "No Name"*/, USceneComponent* componentToMove /*= nullptr*/, FVector locationFrom /*= FVector::ZeroVector*/, FVector locationTo /*= FVector::ZeroVector*/, bool enforceValueTo, EVectorConstraints::VectorConstraints vectorConstraints /*= VectorConstraints::none*/, ECoordinateSpace::CoordinateSpace coordinateSpace /*= CoordinateSpace::world*/, bool sweep /*= false*/, float delay /*= 0.0f*/, EDelayType::DelayType delayType /*= first*/, ETickType::TickType tickType /*= seconds*/, float tickTypeValue /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, UCurveFloat* customEaseTypeCurve /*= nullptr*/, float punchAmplitude /*= 1.0f*/, ELoopType::LoopType loopType /*= once*/, int32 maximumLoopSections, ELookType::LookType orientation /*= noOrientationChange*/, UObject* orientationTarget /*= nullptr*/, float orientationSpeed /*= 5.0f*/, ERotatorConstraints::RotatorConstraints rotatorConstraints /*= RotatorConstraints::none*/, UObject* onTweenStartTarget /*= nullptr*/, FString OnTweenStartFunctionName /*= ""*/, UObject* onTweenUpdateTarget /*= nullptr*/, FString OnTweenUpdateFunctionName /*= ""*/, UObject* onTweenLoopTarget /*= nullptr*/, FString OnTweenLoopFunctionName /*= ""*/, UObject* onTweenCompleteTarget /*= nullptr*/, FString OnTweenCompleteFunctionName /*= ""*/, bool tickWhenPaused /*= false*/, bool ignoreTimeDilation /*= false*/, bool tieToObjectValidity, bool cullNonRenderedTweens, float secondsToWaitBeforeCull)
+{
+	return ComponentMoveFromToFullWithHandle(timerInterval, tweenName, componentToMove, locationFrom, locationTo, enforceValueTo, vectorConstraints, coordinateSpace, sweep, delay, delayType, tickType, tickTypeValue, easeType, customEaseTypeCurve, punchAmplitude, loopType, maximumLoopSections, orientation, orientationTarget, orientationSpeed, rotatorConstraints, onTweenStartTarget, OnTweenStartFunctionName, onTweenUpdateTarget, OnTweenUpdateFunctionName, onTweenLoopTarget, OnTweenLoopFunctionName, onTweenCompleteTarget, OnTweenCompleteFunctionName, tickWhenPaused, ignoreTimeDilation, tieToObjectValidity, cullNonRenderedTweens, secondsToWaitBeforeCull).event;
+}
+
+FiTweenHandle UiTween::ComponentMoveFromToFullWithHandle(float timerInterval, FName tweenName /*= "No Name"*/, USceneComponent* componentToMove /*= nullptr*/, FVector locationFrom /*= FVector::ZeroVector*/, FVector locationTo /*= FVector::ZeroVector*/, bool enforceValueTo, EVectorConstraints::VectorConstraints vectorConstraints /*= VectorConstraints::none*/, ECoordinateSpace::CoordinateSpace coordinateSpace /*= CoordinateSpace::world*/, bool sweep /*= false*/, float delay /*= 0.0f*/, EDelayType::DelayType delayType /*= first*/, ETickType::TickType tickType /*= seconds*/, float tickTypeValue /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, UCurveFloat* customEaseTypeCurve /*= nullptr*/, float punchAmplitude /*= 1.0f*/, ELoopType::LoopType loopType /*= once*/, int32 maximumLoopSections, ELookType::LookType orientation /*= noOrientationChange*/, UObject* orientationTarget /*= nullptr*/, float orientationSpeed /*= 5.0f*/, ERotatorConstraints::RotatorConstraints rotatorConstraints /*= RotatorConstraints::none*/, UObject* onTweenStartTarget /*= nullptr*/, FString OnTweenStartFunctionName /*= ""*/, UObject* onTweenUpdateTarget /*= nullptr*/, FString OnTweenUpdateFunctionName /*= ""*/, UObject* onTweenLoopTarget /*= nullptr*/, FString OnTweenLoopFunctionName /*= ""*/, UObject* onTweenCompleteTarget /*= nullptr*/, FString OnTweenCompleteFunctionName /*= ""*/, bool tickWhenPaused /*= false*/, bool ignoreTimeDilation /*= false*/, bool tieToObjectValidity, bool cullNonRenderedTweens, float secondsToWaitBeforeCull)
 {
 	//Make sure we have a valid object to tween before proceeding
 	if (componentToMove)
 	{
+		//Plain transform tweens run on the tween pool of the aux, no event actor is spawned, the handle gets the pool id
+		if (FMath::Abs(timerInterval) <= 0.0001f && coordinateSpace == CoordinateSpace::world && orientation == LookType::noOrientationChange && !tickWhenPaused && !ignoreTimeDilation && !cullNonRenderedTweens)
+		{
+			FiTweenPoolDesc desc;
+			desc.eventType = EEventType::EventType::compMoveFromTo;
+			desc.tweenName = tweenName;
+			desc.componentTweening = componentToMove;
+			desc.vectorFrom = locationFrom;
+			desc.vectorTo = locationTo;
+			desc.sweep = sweep;
+			desc.enforceValueTo = enforceValueTo;
+			desc.vectorConstraints = vectorConstraints;
+			desc.rotatorConstraints = rotatorConstraints;
+			desc.tieToObjectValidity = tieToObjectValidity;
+			desc.delay = delay;
+			desc.delayType = delayType;
+			desc.tickType = tickType;
+			desc.tickTypeValue = tickTypeValue;
+			desc.easeType = easeType;
+			desc.customEaseTypeCurve = customEaseTypeCurve;
+			desc.punchAmplitude = punchAmplitude;
+			desc.loopType = loopType;
+			desc.maximumLoopSections = maximumLoopSections;
+			desc.onTweenStartTarget = onTweenStartTarget;
+			desc.OnTweenStartFunctionName = OnTweenStartFunctionName;
+			desc.onTweenUpdateTarget = onTweenUpdateTarget;
+			desc.OnTweenUpdateFunctionName = OnTweenUpdateFunctionName;
+			desc.onTweenLoopTarget = onTweenLoopTarget;
+			desc.OnTweenLoopFunctionName = OnTweenLoopFunctionName;
+			desc.onTweenCompleteTarget = onTweenCompleteTarget;
+			desc.OnTweenCompleteFunctionName = OnTweenCompleteFunctionName;
+
+			FiTweenHandle handle;
+			handle.poolId = AddPooledTween(GetAux(), desc);
+			if (handle.poolId != INDEX_NONE)
+			{
+				return handle;
+			}
+		}
+
 		//Create Actor Instance
 		AiTweenEvent* ie = (AiTweenEvent*)SpawnEvent(GetAux());
 		//Set Event Type
@@ -1708,15 +1871,45 @@ AiTweenEvent* UiTween::ComponentMoveFromToFull(float timerInterval, FName tweenN
 	else
 	{
 		Print("No tweenable object defined. No tweening operation will occur.", "error");
-		return nullptr;
+		return FiTweenHandle();
 	}
 }
 
 AiTweenEvent* UiTween::ComponentMoveFromToSimple(FName tweenName /*= "No Name"*/, USceneComponent* componentToMove /*= nullptr*/, FVector locationFrom /*= FVector::ZeroVector*/, FVector locationTo /*= FVector::ZeroVector*/, ECoordinateSpace::CoordinateSpace coordinateSpace /*= CoordinateSpace::world*/, bool sweep /*= false*/, float timeInSeconds /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, FString parameters, UObject* onTweenStartTarget /*= nullptr*/, UObject* onTweenUpdateTarget /*= nullptr*/, UObject* onTweenLoopTarget /*= nullptr*/, UObject* onTweenCompleteTarget /*= nullptr*/)
+{
+	return ComponentMoveFromToSimpleWithHandle(tweenName, componentToMove, locationFrom, locationTo, coordinateSpace, sweep, timeInSeconds, easeType, parameters, onTweenStartTarget, onTweenUpdateTarget, onTweenLoopTarget, onTweenCompleteTarget).event;
+}
+
+FiTweenHandle UiTween::ComponentMoveFromToSimpleWithHandle(FName tweenName /*= "No Name"*/, USceneComponent* componentToMove /*= nullptr*/, FVector locationFrom /*= FVector::ZeroVector*/, FVector locationTo /*= FVector::ZeroVector*/, ECoordinateSpace::CoordinateSpace coordinateSpace /*= CoordinateSpace::world*/, bool sweep /*= false*/, float timeInSeconds /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, FString parameters, UObject* onTweenStartTarget /*= nullptr*/, UObject* onTweenUpdateTarget /*= nullptr*/, UObject* onTweenLoopTarget /*= nullptr*/, UObject* onTweenCompleteTarget /*= nullptr*/)
 {
 	//Make sure we have a valid object to tween before proceeding
 	if (componentToMove)
 	{
+		//Plain transform tweens run on the tween pool of the aux, no event actor is spawned, the handle gets the pool id
+		if (coordinateSpace == CoordinateSpace::world && parameters == "")
+		{
+			FiTweenPoolDesc desc;
+			desc.eventType = EEventType::EventType::compMoveFromTo;
+			desc.tweenName = tweenName;
+			desc.componentTweening = componentToMove;
+			desc.vectorFrom = locationFrom;
+			desc.vectorTo = locationTo;
+			desc.sweep = sweep;
+			desc.tickTypeValue = timeInSeconds;
+			desc.easeType = easeType;
+			desc.onTweenStartTarget = onTweenStartTarget;
+			desc.onTweenUpdateTarget = onTweenUpdateTarget;
+			desc.onTweenLoopTarget = onTweenLoopTarget;
+			desc.onTweenCompleteTarget = onTweenCompleteTarget;
+
+			FiTweenHandle handle;
+			handle.poolId = AddPooledTween(GetAux(), desc);
+			if (handle.poolId != INDEX_NONE)
+			{
+				return handle;
+			}
+		}
+
 		//Create Actor Instance
 		AiTweenEvent* ie = (AiTweenEvent*)SpawnEvent(GetAux());
 		//Set Event Type
@@ -1745,7 +1938,7 @@ AiTweenEvent* UiTween::ComponentMoveFromToSimple(FName tweenName /*= "No Name"*/
 	else
 	{
 		Print("No tweenable object defined. No tweening operation will occur.", "error");
-		return nullptr;
+		return FiTweenHandle();
 	}
 }
 
@@ -2051,10 +2244,54 @@ void UiTween::ComponentMoveUpdate(USceneComponent* componentToMove, FVector loca
 
 //Component Rotate From/To
 AiTweenEvent* UiTween::ComponentRotateFromToFull(float timerInterval, FName tweenName /*= "No Name"*/, USceneComponent* componentToRotate /*= nullptr*/, FRotator rotationFrom /*= FRotator::ZeroRotator*/, FRotator rotationTo /*= FRotator::ZeroRotator*/, bool enforceValueTo, ERotatorConstraints::RotatorConstraints rotatorConstraints /*= RotatorConstraints::none*/, ECoordinateSpace::CoordinateSpace coordinateSpace /*= CoordinateSpace::world*/, bool shortestPath /*= false*/, float delay /*= 0.0f*/, EDelayType::DelayType delayType /*= first*/, ETickType::TickType tickType /*= seconds*/, float tickTypeValue /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, UCurveFloat* customEaseTypeCurve /*= nullptr*/, float punchAmplitude /*= 1.0f*/, ELoopType::LoopType loopType /*= once*/, int32 maximumLoopSections, UObject* onTweenStartTarget /*= nullptr*/, FString OnTweenStartFunctionName /*= ""*/, UObject* onTweenUpdateTarget /*= nullptr*/, FString OnTweenUpdateFunctionName /*= ""*/, UObject* onTweenLoopTarget /*= nullptr*/, FString OnTweenLoopFunctionName /*= ""*/, UObject* onTweenCompleteTarget /*= nullptr*/, FString OnTweenCompleteFunctionName /*= ""*/, bool tickWhenPaused /*= false*/, bool ignoreTimeDilation /*= false*/, bool tieToObjectValidity, bool cullNonRenderedTweens, float secondsToWaitBeforeCull)
+{
+	return ComponentRotateFromToFullWithHandle(timerInterval, tweenName, componentToRotate, rotationFrom, rotationTo, enforceValueTo, rotatorConstraints, coordinateSpace, shortestPath, delay, delayType, tickType, tickTypeValue, easeType, customEaseTypeCurve, punchAmplitude, loopType, maximumLoopSections, onTweenStartTarget, OnTweenStartFunctionName, onTweenUpdateTarget, OnTweenUpdateFunctionName, onTweenLoopTarget, OnTweenLoopFunctionName, onTweenCompleteTarget, OnTweenCompleteFunctionName, tickWhenPaused, ignoreTimeDilation, tieToObjectValidity, cullNonRenderedTweens, secondsToWaitBeforeCull).event;
+}
+
+FiTweenHandle UiTween::ComponentRotateFromToFullWithHandle(float timerInterval, FName tweenName /*= "No Name"*/, USceneComponent* componentToRotate /*= nullptr*/, FRotator rotationFrom /*= FRotator::ZeroRotator*/, FRotator rotationTo /*= FRotator::ZeroRotator*/, bool enforceValueTo, ERotatorConstraints::RotatorConstraints rotatorConstraints /*= RotatorConstraints::none*/, ECoordinateSpace::CoordinateSpace coordinateSpace /*= CoordinateSpace::world*/, bool shortestPath /*= false*/, float delay /*= 0.0f*/, EDelayType::DelayType delayType /*= first*/, ETickType::TickType tickType /*= seconds*/, float tickTypeValue /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, UCurveFloat* customEaseTypeCurve /*= nullptr*/, float punchAmplitude /*= 1.0f*/, ELoopType::LoopType loopType /*= once*/, int32 maximumLoopSections, UObject* onTweenStartTarget /*= nullptr*/, FString OnTweenStartFunctionName /*= ""*/, UObject* onTweenUpdateTarget /*= nullptr*/, FString OnTweenUpdateFunctionName /*= ""*/, UObject* onTweenLoopTarget /*= nullptr*/, FString OnTweenLoopFunctionName /*= ""*/, UObject* onTweenCompleteTarget /*= nullptr*/, FString OnTweenCompleteFunctionName /*= ""*/, bool tickWhenPaused /*= false*/, bool ignoreTimeDilation /*= false*/, bool tieToObjectValidity, bool cullNonRenderedTweens, float secondsToWaitBeforeCull)
 {
 	//Make sure we have a valid object to tween before proceeding
 	if (componentToRotate)
 	{
+		//Plain transform tweens run on the tween pool of the aux, no event actor is spawned, the handle gets the pool id
+		if (FMath::Abs(timerInterval) <= 0.0001f && coordinateSpace == CoordinateSpace::world && !tickWhenPaused && !ignoreTimeDilation && !cullNonRenderedTweens)
+		{
+			FiTweenPoolDesc desc;
+			desc.eventType = EEventType::EventType::compRotateFromTo;
+			desc.tweenName = tweenName;
+			desc.componentTweening = componentToRotate;
+			desc.rotatorFrom = rotationFrom;
+			desc.rotatorTo = rotationTo;
+			desc.shortestPath = shortestPath;
+			desc.enforceValueTo = enforceValueTo;
+			desc.rotatorConstraints = rotatorConstraints;
+			desc.tieToObjectValidity = tieToObjectValidity;
+			desc.delay = delay;
+			desc.delayType = delayType;
+			desc.tickType = tickType;
+			desc.tickTypeValue = tickTypeValue;
+			desc.easeType = easeType;
+			desc.customEaseTypeCurve = customEaseTypeCurve;
+			desc.punchAmplitude = punchAmplitude;
+			desc.loopType = loopType;
+			desc.maximumLoopSections = maximumLoopSections;
+			desc.onTweenStartTarget = onTweenStartTarget;
+			desc.OnTweenStartFunctionName = OnTweenStartFunctionName;
+			desc.onTweenUpdateTarget = onTweenUpdateTarget;
+			desc.OnTweenUpdateFunctionName = OnTweenUpdateFunctionName;
+			desc.onTweenLoopTarget = onTweenLoopTarget;
+			desc.OnTweenLoopFunctionName = OnTweenLoopFunctionName;
+			desc.onTweenCompleteTarget = onTweenCompleteTarget;
+			desc.OnTweenCompleteFunctionName = OnTweenCompleteFunctionName;
+
+			FiTweenHandle handle;
+			handle.poolId = AddPooledTween(GetAux(), desc);
+			if (handle.poolId != INDEX_NONE)
+			{
+				return handle;
+			}
+		}
+
 		//Create Actor Instance
 		AiTweenEvent* ie = (AiTweenEvent*)SpawnEvent(GetAux());
 		//Set Event Type
@@ -2098,15 +2335,45 @@ AiTweenEvent* UiTween::ComponentRotateFromToFull(float timerInterval, FName twee
 	else
 	{
 		Print("No tweenable object defined. No tweening operation will occur.", "error");
-		return nullptr;
+		return FiTweenHandle();
 	}
 }
 
 AiTweenEvent* UiTween::ComponentRotateFromToSimple(FName tweenName /*= "No Name"*/, USceneComponent* componentToRotate /*= nullptr*/, FRotator rotationFrom /*= FRotator::ZeroRotator*/, FRotator rotationTo /*= FRotator::ZeroRotator*/, ECoordinateSpace::CoordinateSpace coordinateSpace /*= CoordinateSpace::world*/, bool shortestPath /*= false*/, float timeInSeconds /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, FString parameters, UObject* onTweenStartTarget /*= nullptr*/, UObject* onTweenUpdateTarget /*= nullptr*/, UObject* onTweenLoopTarget /*= nullptr*/, UObject* onTweenCompleteTarget /*= nullptr*/)
+{
+	return ComponentRotateFromToSimpleWithHandle(tweenName, componentToRotate, rotationFrom, rotationTo, coordinateSpace, shortestPath, timeInSeconds, easeType, parameters, onTweenStartTarget, onTweenUpdateTarget, onTweenLoopTarget, onTweenCompleteTarget).event;
+}
+
+FiTweenHandle UiTween::ComponentRotateFromToSimpleWithHandle(FName tweenName /*= "No Name"*/, USceneComponent* componentToRotate /*= nullptr*/, FRotator rotationFrom /*= FRotator::ZeroRotator*/, FRotator rotationTo /*= FRotator::ZeroRotator*/, ECoordinateSpace::CoordinateSpace coordinateSpace /*= CoordinateSpace::world*/, bool shortestPath /*= false*/, float timeInSeconds /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, FString parameters, UObject* onTweenStartTarget /*= nullptr*/, UObject* onTweenUpdateTarget /*= nullptr*/, UObject* onTweenLoopTarget /*= nullptr*/, UObject* onTweenCompleteTarget /*= nullptr*/)
 {
 	//Make sure we have a valid object to tween before proceeding
 	if (componentToRotate)
 	{
+		//Plain transform tweens run on the tween pool of the aux, no event actor is spawned, the handle gets the pool id
+		if (coordinateSpace == CoordinateSpace::world && parameters == "")
+		{
+			FiTweenPoolDesc desc;
+			desc.eventType = EEventType::EventType::compRotateFromTo;
+			desc.tweenName = tweenName;
+			desc.componentTweening = componentToRotate;
+			desc.rotatorFrom = rotationFrom;
+			desc.rotatorTo = rotationTo;
+			desc.shortestPath = shortestPath;
+			desc.tickTypeValue = timeInSeconds;
+			desc.easeType = easeType;
+			desc.onTweenStartTarget = onTweenStartTarget;
+			desc.onTweenUpdateTarget = onTweenUpdateTarget;
+			desc.onTweenLoopTarget = onTweenLoopTarget;
+			desc.onTweenCompleteTarget = onTweenCompleteTarget;
+
+			FiTweenHandle handle;
+			handle.poolId = AddPooledTween(GetAux(), desc);
+			if (handle.poolId != INDEX_NONE)
+			{
+				return handle;
+			}
+		}
+
 		//Create Actor Instance
 		AiTweenEvent* ie = (AiTweenEvent*)SpawnEvent(GetAux());
 		//Set Event Type
@@ -2135,7 +2402,7 @@ AiTweenEvent* UiTween::ComponentRotateFromToSimple(FName tweenName /*= "No Name"
 	else
 	{
 		Print("No tweenable object defined. No tweening operation will occur.", "error");
-		return nullptr;
+		return FiTweenHandle();
 	}
 }
 
@@ -2414,10 +2681,53 @@ void UiTween::ComponentRotateUpdate(USceneComponent* componentToRotate, FRotator
 
 //Component Scale From/To
 AiTweenEvent* UiTween::ComponentScaleFromToFull(float timerInterval, FName tweenName /*= "No Name"*/, USceneComponent* componentToScale /*= nullptr*/, FVector scaleFrom /*= FVector::ZeroVector*/, FVector scaleTo /*= FVector(1, 1, 1)*/, bool enforceValueTo, EVectorConstraints::VectorConstraints vectorConstraints /*= VectorConstraints::none*/, bool isLocal, float delay /*= 0.0f*/, EDelayType::DelayType delayType /*= first*/, ETickType::TickType tickType /*= seconds*/, float tickTypeValue /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, UCurveFloat* customEaseTypeCurve /*= nullptr*/, float punchAmplitude /*= 1.0f*/, ELoopType::LoopType loopType /*= once*/, int32 maximumLoopSections, UObject* onTweenStartTarget /*= nullptr*/, FString OnTweenStartFunctionName /*= ""*/, UObject* onTweenUpdateTarget /*= nullptr*/, FString OnTweenUpdateFunctionName /*= ""*/, UObject* onTweenLoopTarget /*= nullptr*/, FString OnTweenLoopFunctionName /*= ""*/, UObject* onTweenCompleteTarget /*= nullptr*/, FString OnTweenCompleteFunctionName /*= ""*/, bool tickWhenPaused /*= false*/, bool ignoreTimeDilation /*= false*/, bool tieToObjectValidity, bool cullNonRenderedTweens, float secondsToWaitBeforeCull)
+{
+	return ComponentScaleFromToFullWithHandle(timerInterval, tweenName, componentToScale, scaleFrom, scaleTo, enforceValueTo, vectorConstraints, isLocal, delay, delayType, tickType, tickTypeValue, easeType, customEaseTypeCurve, punchAmplitude, loopType, maximumLoopSections, onTweenStartTarget, OnTweenStartFunctionName, onTweenUpdateTarget, OnTweenUpdateFunctionName, onTweenLoopTarget, OnTweenLoopFunctionName, onTweenCompleteTarget, OnTweenCompleteFunctionName, tickWhenPaused, ignoreTimeDilation, tieToObjectValidity, cullNonRenderedTweens, secondsToWaitBeforeCull).event;
+}
+
+FiTweenHandle UiTween::ComponentScaleFromToFullWithHandle(float timerInterval, FName tweenName /*= "No Name"*/, USceneComponent* componentToScale /*= nullptr*/, FVector scaleFrom /*= FVector::ZeroVector*/, FVector scaleTo /*= FVector(1, 1, 1)*/, bool enforceValueTo, EVectorConstraints::VectorConstraints vectorConstraints /*= VectorConstraints::none*/, bool isLocal, float delay /*= 0.0f*/, EDelayType::DelayType delayType /*= first*/, ETickType::TickType tickType /*= seconds*/, float tickTypeValue /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, UCurveFloat* customEaseTypeCurve /*= nullptr*/, float punchAmplitude /*= 1.0f*/, ELoopType::LoopType loopType /*= once*/, int32 maximumLoopSections, UObject* onTweenStartTarget /*= nullptr*/, FString OnTweenStartFunctionName /*= ""*/, UObject* onTweenUpdateTarget /*= nullptr*/, FString OnTweenUpdateFunctionName /*= ""*/, UObject* onTweenLoopTarget /*= nullptr*/, FString OnTweenLoopFunctionName /*= ""*/, UObject* onTweenCompleteTarget /*= nullptr*/, FString OnTweenCompleteFunctionName /*= ""*/, bool tickWhenPaused /*= false*/, bool ignoreTimeDilation /*= false*/, bool tieToObjectValidity, bool cullNonRenderedTweens, float secondsToWaitBeforeCull)
 {
 	//Make sure we have a valid object to tween before proceeding
 	if (componentToScale)
 	{
+		//Plain transform tweens run on the tween pool of the aux, no event actor is spawned, the handle gets the pool id
+		if (FMath::Abs(timerInterval) <= 0.0001f && !isLocal && !tickWhenPaused && !ignoreTimeDilation && !cullNonRenderedTweens)
+		{
+			FiTweenPoolDesc desc;
+			desc.eventType = EEventType::EventType::compScaleFromTo;
+			desc.tweenName = tweenName;
+			desc.componentTweening = componentToScale;
+			desc.vectorFrom = scaleFrom;
+			desc.vectorTo = scaleTo;
+			desc.enforceValueTo = enforceValueTo;
+			desc.vectorConstraints = vectorConstraints;
+			desc.tieToObjectValidity = tieToObjectValidity;
+			desc.delay = delay;
+			desc.delayType = delayType;
+			desc.tickType = tickType;
+			desc.tickTypeValue = tickTypeValue;
+			desc.easeType = easeType;
+			desc.customEaseTypeCurve = customEaseTypeCurve;
+			desc.punchAmplitude = punchAmplitude;
+			desc.loopType = loopType;
+			desc.maximumLoopSections = maximumLoopSections;
+			desc.onTweenStartTarget = onTweenStartTarget;
+			desc.OnTweenStartFunctionName = OnTweenStartFunctionName;
+			desc.onTweenUpdateTarget = onTweenUpdateTarget;
+			desc.OnTweenUpdateFunctionName = OnTweenUpdateFunctionName;
+			desc.onTweenLoopTarget = onTweenLoopTarget;
+			desc.OnTweenLoopFunctionName = OnTweenLoopFunctionName;
+			desc.onTweenCompleteTarget = onTweenCompleteTarget;
+			desc.OnTweenCompleteFunctionName = OnTweenCompleteFunctionName;
+
+			FiTweenHandle handle;
+			handle.poolId = AddPooledTween(GetAux(), desc);
+			if (handle.poolId != INDEX_NONE)
+			{
+				return handle;
+			}
+		}
+
 		//Create Actor Instance
 		AiTweenEvent* ie = (AiTweenEvent*)SpawnEvent(GetAux());
 		//Set Event Type
@@ -2463,15 +2773,44 @@ AiTweenEvent* UiTween::ComponentScaleFromToFull(float timerInterval, FName tween
 	else
 	{
 		Print("No tweenable object defined. No tweening operation will occur.", "error");
-		return nullptr;
+		return FiTweenHandle();
 	}
 }
 
 AiTweenEvent* UiTween::ComponentScaleFromToSimple(FName tweenName /*= "No Name"*/, USceneComponent* componentToScale /*= nullptr*/, FVector scaleFrom /*= FVector::ZeroVector*/, FVector scaleTo /*= FVector(1, 1, 1)*/, bool isLocal, float timeInSeconds /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, FString parameters, UObject* onTweenStartTarget /*= nullptr*/, UObject* onTweenUpdateTarget /*= nullptr*/, UObject* onTweenLoopTarget /*= nullptr*/, UObject* onTweenCompleteTarget /*= nullptr*/)
+{
+	return ComponentScaleFromToSimpleWithHandle(tweenName, componentToScale, scaleFrom, scaleTo, isLocal, timeInSeconds, easeType, parameters, onTweenStartTarget, onTweenUpdateTarget, onTweenLoopTarget, onTweenCompleteTarget).event;
+}
+
+FiTweenHandle UiTween::ComponentScaleFromToSimpleWithHandle(FName tweenName /*= "No Name"*/, USceneComponent* componentToScale /*= nullptr*/, FVector scaleFrom /*= FVector::ZeroVector*/, FVector scaleTo /*= FVector(1, 1, 1)*/, bool isLocal, float timeInSeconds /*= 5.0f*/, EEaseType::EaseType easeType /*= linear*/, FString parameters, UObject* onTweenStartTarget /*= nullptr*/, UObject* onTweenUpdateTarget /*= nullptr*/, UObject* onTweenLoopTarget /*= nullptr*/, UObject* onTweenCompleteTarget /*= nullptr*/)
 {
 	//Make sure we have a valid object to tween before proceeding
 	if (componentToScale)
 	{
+		//Plain transform tweens run on the tween pool of the aux, no event actor is spawned, the handle gets the pool id
+		if (!isLocal && parameters == "")
+		{
+			FiTweenPoolDesc desc;
+			desc.eventType = EEventType::EventType::compScaleFromTo;
+			desc.tweenName = tweenName;
+			desc.componentTweening = componentToScale;
+			desc.vectorFrom = scaleFrom;
+			desc.vectorTo = scaleTo;
+			desc.tickTypeValue = timeInSeconds;
+			desc.easeType = easeType;
+			desc.onTweenStartTarget = onTweenStartTarget;
+			desc.onTweenUpdateTarget = onTweenUpdateTarget;
+			desc.onTweenLoopTarget = onTweenLoopTarget;
+			desc.onTweenCompleteTarget = onTweenCompleteTarget;
+
+			FiTweenHandle handle;
+			handle.poolId = AddPooledTween(GetAux(), desc);
+			if (handle.poolId != INDEX_NONE)
+			{
+				return handle;
+			}
+		}
+
 		//Create Actor Instance
 		AiTweenEvent* ie = (AiTweenEvent*)SpawnEvent(GetAux());
 		//Set Event Type
@@ -2502,7 +2841,7 @@ AiTweenEvent* UiTween::ComponentScaleFromToSimple(FName tweenName /*= "No Name"*
 	else
 	{
 		Print("No tweenable object defined. No tweening operation will occur.", "error");
-		return nullptr;
+		return FiTweenHandle();
 	}
 }
 
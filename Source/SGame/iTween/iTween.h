@@ -5,6 +5,7 @@
 #include "iTweenPCH.h"
 #include "iTAux.h"
 #include "iTSpline.h"
+#include "iTParams.h"
 #include "iTween.generated.h"
 
 /**
@@ -23,6 +24,30 @@ using namespace ECoordinateSpace;
 
 class AiTweenEvent;
 class STweenableWidget;
+
+/**
+* A tween started by a Full or Simple move, rotate or scale From/To function. A tween on the tween pool of the aux has no
+* event operator, its pool id finds it instead. Stop, pause, resume and query either kind with the tween handle functions
+*/
+USTRUCT(BlueprintType)
+struct FiTweenHandle
+{
+	GENERATED_USTRUCT_BODY()
+
+	FiTweenHandle() {}
+
+	//The handle of an event operator, or of nothing for nullptr
+	FiTweenHandle(AiTweenEvent* inEvent) : event(inEvent) {}
+
+	//The event operator of the tween, nullptr if it runs on the tween pool
+	UPROPERTY(BlueprintReadOnly, Category = iTween)
+		AiTweenEvent* event = nullptr;
+
+	//The id of the tween on the tween pool, INDEX_NONE if it has an event operator
+	UPROPERTY(BlueprintReadOnly, Category = iTween)
+		int32 poolId = INDEX_NONE;
+};
+
 UCLASS()
 class SGAME_API UiTween : public UBlueprintFunctionLibrary
 {
@@ -49,6 +74,10 @@ public:
 	UFUNCTION()
 		static UObject* FindObjectByName(FString s);
 
+	//Compile a parameter string of the Expert and Min functions into typed parameters, to keep and apply to many tweens
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Compile Tween Parameters"), Category = "iTween|Utilities")
+		static FiTweenParams CompileParameters(FString parameters);
+
 	//UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Actor Rotation In Parent Space"), Category = "iTween|Utilities")
 	//static FRotator GetActorRotationByParent(AActor* actor);
 
@@ -126,6 +155,23 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction), Category = "iTween|Stopping, Pausing and Resuming Tweens")
 		static void ResumeAllTweens();
 
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction), Category = "iTween|Stopping, Pausing and Resuming Tweens")
+		static void StopTweeningByHandle(const FiTweenHandle& handle);
+
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction), Category = "iTween|Stopping, Pausing and Resuming Tweens")
+		static void PauseTweeningByHandle(const FiTweenHandle& handle);
+
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction), Category = "iTween|Stopping, Pausing and Resuming Tweens")
+		static void ResumeTweeningByHandle(const FiTweenHandle& handle);
+
+	//Whether the tween of the handle is running or paused
+	UFUNCTION(BlueprintPure, meta = (UnsafeDuringActorConstruction), Category = "iTween|Stopping, Pausing and Resuming Tweens")
+		static bool IsTweenActive(const FiTweenHandle& handle);
+
+	//Bake the easing tables with the settings of the aux of the world, see AiTAux::BakeEasingTables
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction), Category = "iTween|Easing Tables")
+		static void BakeEasingTables();
+
 	//Get iTweenEvents
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction), Category = "iTween|Getting Event Operators")
 		static AiTweenEvent* GetEventByIndex(int32 index);
@@ -140,6 +186,10 @@ public:
 		static TArray<AiTweenEvent*> GetEventsByTweeningObjectReference(UObject* object);
 
 	//Actor
+	//The Full and Simple move, rotate and scale From/To tweens in world space, without timer, orientation, culling, pause or
+	//time dilation settings (and without Simple parameters) run on the tween pool of the aux and return no event, their
+	//WithHandle versions return a handle with the pool id instead. Their callbacks get no event operator. The Expert and
+	//Min versions always spawn an event.
 	//Actor Move From/To
 
 	/**
@@ -179,6 +229,9 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Actor Move From/To (Full)"), Category = "iTween|Events|Actor Tweens|Actor Move")
 		static AiTweenEvent* ActorMoveFromToFull(float timerInterval = 0.f, FName tweenName = "No Name", AActor* actorToMove = nullptr, FVector locationFrom = FVector::ZeroVector, FVector locationTo = FVector::ZeroVector, bool enforceValueTo = true, EVectorConstraints::VectorConstraints vectorConstraints = VectorConstraints::none, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool sweep = false, float delay = 0.0f, EDelayType::DelayType delayType = first, ETickType::TickType tickType = seconds, float tickTypeValue = 5.0f, EEaseType::EaseType easeType = linear, UCurveFloat* customEaseTypeCurve = nullptr, float punchAmplitude = 1.0f, ELoopType::LoopType loopType = once, int32 maximumLoopSections = 0, ELookType::LookType orientation = noOrientationChange, UObject* orientationTarget = nullptr, float orientationSpeed = 5.0f, ERotatorConstraints::RotatorConstraints rotatorConstraints = RotatorConstraints::none, UObject* onTweenStartTarget = nullptr, FString OnTweenStartFunctionName = "", UObject* onTweenUpdateTarget = nullptr, FString OnTweenUpdateFunctionName = "", UObject* onTweenLoopTarget = nullptr, FString OnTweenLoopFunctionName = "", UObject* onTweenCompleteTarget = nullptr, FString OnTweenCompleteFunctionName = "", bool tickWhenPaused = false, bool ignoreTimeDilation = false, bool tieToObjectValidity = true, bool cullNonRenderedTweens = false, float secondsToWaitBeforeCull = 3.f);
 
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Actor Move From/To (Full, Handle)"), Category = "iTween|Events|Actor Tweens|Actor Move")
+		static FiTweenHandle ActorMoveFromToFullWithHandle(float timerInterval = 0.f, FName tweenName = "No Name", AActor* actorToMove = nullptr, FVector locationFrom = FVector::ZeroVector, FVector locationTo = FVector::ZeroVector, bool enforceValueTo = true, EVectorConstraints::VectorConstraints vectorConstraints = VectorConstraints::none, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool sweep = false, float delay = 0.0f, EDelayType::DelayType delayType = first, ETickType::TickType tickType = seconds, float tickTypeValue = 5.0f, EEaseType::EaseType easeType = linear, UCurveFloat* customEaseTypeCurve = nullptr, float punchAmplitude = 1.0f, ELoopType::LoopType loopType = once, int32 maximumLoopSections = 0, ELookType::LookType orientation = noOrientationChange, UObject* orientationTarget = nullptr, float orientationSpeed = 5.0f, ERotatorConstraints::RotatorConstraints rotatorConstraints = RotatorConstraints::none, UObject* onTweenStartTarget = nullptr, FString OnTweenStartFunctionName = "", UObject* onTweenUpdateTarget = nullptr, FString OnTweenUpdateFunctionName = "", UObject* onTweenLoopTarget = nullptr, FString OnTweenLoopFunctionName = "", UObject* onTweenCompleteTarget = nullptr, FString OnTweenCompleteFunctionName = "", bool tickWhenPaused = false, bool ignoreTimeDilation = false, bool tieToObjectValidity = true, bool cullNonRenderedTweens = false, float secondsToWaitBeforeCull = 3.f);
+
 	/**
 	* Moves an actor from one location to another over time. Most-used options only. Parameters available.
 	* @return The generated actor that performs the tweening operation. Known as the "Event Operator."
@@ -198,6 +251,9 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Actor Move From/To (Simple)"), Category = "iTween|Events|Actor Tweens|Actor Move")
 		static AiTweenEvent* ActorMoveFromToSimple(FName tweenName = "No Name", AActor* actorToMove = nullptr, FVector locationFrom = FVector::ZeroVector, FVector locationTo = FVector::ZeroVector, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool sweep = false, float timeInSeconds = 5.0f, EEaseType::EaseType easeType = linear, FString parameters = "", UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
 
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Actor Move From/To (Simple, Handle)"), Category = "iTween|Events|Actor Tweens|Actor Move")
+		static FiTweenHandle ActorMoveFromToSimpleWithHandle(FName tweenName = "No Name", AActor* actorToMove = nullptr, FVector locationFrom = FVector::ZeroVector, FVector locationTo = FVector::ZeroVector, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool sweep = false, float timeInSeconds = 5.0f, EEaseType::EaseType easeType = linear, FString parameters = "", UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
+
 	/**
 	* Moves an actor from one location to another over time. Parameters and object inputs only.
 	* @return The generated actor that performs the tweening operation. Known as the "Event Operator."
@@ -245,9 +301,15 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Actor Rotate From/To (Full)"), Category = "iTween|Events|Actor Tweens|Actor Rotate")
 		static AiTweenEvent* ActorRotateFromToFull(float timerInterval = 0.f, FName tweenName = "No Name", AActor* actorToRotate = nullptr, FRotator rotationFrom = FRotator::ZeroRotator, FRotator rotationTo = FRotator::ZeroRotator, bool enforceValueTo = true, ERotatorConstraints::RotatorConstraints rotatorConstraints = RotatorConstraints::none, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool shortestPath = false, float delay = 0.0f, EDelayType::DelayType delayType = first, ETickType::TickType tickType = seconds, float tickTypeValue = 5.0f, EEaseType::EaseType easeType = linear, UCurveFloat* customEaseTypeCurve = nullptr, float punchAmplitude = 1.0f, ELoopType::LoopType loopType = once, int32 maximumLoopSections = 0, UObject* onTweenStartTarget = nullptr, FString OnTweenStartFunctionName = "", UObject* onTweenUpdateTarget = nullptr, FString OnTweenUpdateFunctionName = "", UObject* onTweenLoopTarget = nullptr, FString OnTweenLoopFunctionName = "", UObject* onTweenCompleteTarget = nullptr, FString OnTweenCompleteFunctionName = "", bool tickWhenPaused = false, bool ignoreTimeDilation = false, bool tieToObjectValidity = true, bool cullNonRenderedTweens = false, float secondsToWaitBeforeCull = 3.f);
 
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Actor Rotate From/To (Full, Handle)"), Category = "iTween|Events|Actor Tweens|Actor Rotate")
+		static FiTweenHandle ActorRotateFromToFullWithHandle(float timerInterval = 0.f, FName tweenName = "No Name", AActor* actorToRotate = nullptr, FRotator rotationFrom = FRotator::ZeroRotator, FRotator rotationTo = FRotator::ZeroRotator, bool enforceValueTo = true, ERotatorConstraints::RotatorConstraints rotatorConstraints = RotatorConstraints::none, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool shortestPath = false, float delay = 0.0f, EDelayType::DelayType delayType = first, ETickType::TickType tickType = seconds, float tickTypeValue = 5.0f, EEaseType::EaseType easeType = linear, UCurveFloat* customEaseTypeCurve = nullptr, float punchAmplitude = 1.0f, ELoopType::LoopType loopType = once, int32 maximumLoopSections = 0, UObject* onTweenStartTarget = nullptr, FString OnTweenStartFunctionName = "", UObject* onTweenUpdateTarget = nullptr, FString OnTweenUpdateFunctionName = "", UObject* onTweenLoopTarget = nullptr, FString OnTweenLoopFunctionName = "", UObject* onTweenCompleteTarget = nullptr, FString OnTweenCompleteFunctionName = "", bool tickWhenPaused = false, bool ignoreTimeDilation = false, bool tieToObjectValidity = true, bool cullNonRenderedTweens = false, float secondsToWaitBeforeCull = 3.f);
+
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Actor Rotate From/To (Simple)"), Category = "iTween|Events|Actor Tweens|Actor Rotate")
 		static AiTweenEvent* ActorRotateFromToSimple(FName tweenName = "No Name", AActor* actorToRotate = nullptr, FRotator rotationFrom = FRotator::ZeroRotator, FRotator rotationTo = FRotator::ZeroRotator, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool shortestPath = false, float timeInSeconds = 5.0f, EEaseType::EaseType easeType = linear, FString parameters = "", UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
 
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Actor Rotate From/To (Simple, Handle)"), Category = "iTween|Events|Actor Tweens|Actor Rotate")
+		static FiTweenHandle ActorRotateFromToSimpleWithHandle(FName tweenName = "No Name", AActor* actorToRotate = nullptr, FRotator rotationFrom = FRotator::ZeroRotator, FRotator rotationTo = FRotator::ZeroRotator, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool shortestPath = false, float timeInSeconds = 5.0f, EEaseType::EaseType easeType = linear, FString parameters = "", UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
+
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Actor Rotate From/To (Expert)"), Category = "iTween|Events|Actor Tweens|Actor Rotate")
 		static AiTweenEvent* ActorRotateFromToExpert(AActor* actorToRotate = nullptr, FString parameters = "", bool initializeOnSpawn = true, UCurveFloat* customEaseTypeCurve = nullptr, UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
 
@@ -275,9 +337,15 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Actor Scale From/To (Full)"), Category = "iTween|Events|Actor Tweens|Actor Scale")
 		static AiTweenEvent* ActorScaleFromToFull(float timerInterval = 0.f, FName tweenName = "No Name", AActor* actorToScale = nullptr, FVector scaleFrom = FVector::ZeroVector, FVector scaleTo = FVector(1, 1, 1), bool enforceValueTo = true, EVectorConstraints::VectorConstraints vectorConstraints = VectorConstraints::none, bool isLocal = false, float delay = 0.0f, EDelayType::DelayType delayType = first, ETickType::TickType tickType = seconds, float tickTypeValue = 5.0f, EEaseType::EaseType easeType = linear, UCurveFloat* customEaseTypeCurve = nullptr, float punchAmplitude = 1.0f, ELoopType::LoopType loopType = once, int32 maximumLoopSections = 0, UObject* onTweenStartTarget = nullptr, FString OnTweenStartFunctionName = "", UObject* onTweenUpdateTarget = nullptr, FString OnTweenUpdateFunctionName = "", UObject* onTweenLoopTarget = nullptr, FString OnTweenLoopFunctionName = "", UObject* onTweenCompleteTarget = nullptr, FString OnTweenCompleteFunctionName = "", bool tickWhenPaused = false, bool ignoreTimeDilation = false, bool tieToObjectValidity = true, bool cullNonRenderedTweens = false, float secondsToWaitBeforeCull = 3.f);
 
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Actor Scale From/To (Full, Handle)"), Category = "iTween|Events|Actor Tweens|Actor Scale")
+		static FiTweenHandle ActorScaleFromToFullWithHandle(float timerInterval = 0.f, FName tweenName = "No Name", AActor* actorToScale = nullptr, FVector scaleFrom = FVector::ZeroVector, FVector scaleTo = FVector(1, 1, 1), bool enforceValueTo = true, EVectorConstraints::VectorConstraints vectorConstraints = VectorConstraints::none, bool isLocal = false, float delay = 0.0f, EDelayType::DelayType delayType = first, ETickType::TickType tickType = seconds, float tickTypeValue = 5.0f, EEaseType::EaseType easeType = linear, UCurveFloat* customEaseTypeCurve = nullptr, float punchAmplitude = 1.0f, ELoopType::LoopType loopType = once, int32 maximumLoopSections = 0, UObject* onTweenStartTarget = nullptr, FString OnTweenStartFunctionName = "", UObject* onTweenUpdateTarget = nullptr, FString OnTweenUpdateFunctionName = "", UObject* onTweenLoopTarget = nullptr, FString OnTweenLoopFunctionName = "", UObject* onTweenCompleteTarget = nullptr, FString OnTweenCompleteFunctionName = "", bool tickWhenPaused = false, bool ignoreTimeDilation = false, bool tieToObjectValidity = true, bool cullNonRenderedTweens = false, float secondsToWaitBeforeCull = 3.f);
+
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Actor Scale From/To (Simple)"), Category = "iTween|Events|Actor Tweens|Actor Scale")
 		static AiTweenEvent* ActorScaleFromToSimple(FName tweenName = "No Name", AActor* actorToScale = nullptr, FVector scaleFrom = FVector::ZeroVector, FVector scaleTo = FVector(1, 1, 1), bool isLocal = false, float timeInSeconds = 5.0f, EEaseType::EaseType easeType = linear, FString parameters = "", UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
 
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Actor Scale From/To (Simple, Handle)"), Category = "iTween|Events|Actor Tweens|Actor Scale")
+		static FiTweenHandle ActorScaleFromToSimpleWithHandle(FName tweenName = "No Name", AActor* actorToScale = nullptr, FVector scaleFrom = FVector::ZeroVector, FVector scaleTo = FVector(1, 1, 1), bool isLocal = false, float timeInSeconds = 5.0f, EEaseType::EaseType easeType = linear, FString parameters = "", UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
+
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Actor Scale From/To (Expert)"), Category = "iTween|Events|Actor Tweens|Actor Scale")
 		static AiTweenEvent* ActorScaleFromToExpert(AActor* actorToScale = nullptr, FString parameters = "", bool initializeOnSpawn = true, UCurveFloat* customEaseTypeCurve = nullptr, UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
 
@@ -292,9 +360,15 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Component Move From/To (Full)"), Category = "iTween|Events|Component Tweens|Component Move")
 		static AiTweenEvent* ComponentMoveFromToFull(float timerInterval = 0.f, FName tweenName = "No Name", USceneComponent* componentToMove = nullptr, FVector locationFrom = FVector::ZeroVector, FVector locationTo = FVector::ZeroVector, bool enforceValueTo = true, EVectorConstraints::VectorConstraints vectorConstraints = VectorConstraints::none, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool sweep = false, float delay = 0.0f, EDelayType::DelayType delayType = first, ETickType::TickType tickType = seconds, float tickTypeValue = 5.0f, EEaseType::EaseType easeType = linear, UCurveFloat* customEaseTypeCurve = nullptr, float punchAmplitude = 1.0f, ELoopType::LoopType loopType = once, int32 maximumLoopSections = 0, ELookType::LookType orientation = noOrientationChange, UObject* orientationTarget = nullptr, float orientationSpeed = 5.0f, ERotatorConstraints::RotatorConstraints rotatorConstraints = RotatorConstraints::none, UObject* onTweenStartTarget = nullptr, FString OnTweenStartFunctionName = "", UObject* onTweenUpdateTarget = nullptr, FString OnTweenUpdateFunctionName = "", UObject* onTweenLoopTarget = nullptr, FString OnTweenLoopFunctionName = "", UObject* onTweenCompleteTarget = nullptr, FString OnTweenCompleteFunctionName = "", bool tickWhenPaused = false, bool ignoreTimeDilation = false, bool tieToObjectValidity = true, bool cullNonRenderedTweens = false, float secondsToWaitBeforeCull = 3.f);
 
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Component Move From/To (Full, Handle)"), Category = "iTween|Events|Component Tweens|Component Move")
+		static FiTweenHandle ComponentMoveFromToFullWithHandle(float timerInterval = 0.f, FName tweenName = "No Name", USceneComponent* componentToMove = nullptr, FVector locationFrom = FVector::ZeroVector, FVector locationTo = FVector::ZeroVector, bool enforceValueTo = true, EVectorConstraints::VectorConstraints vectorConstraints = VectorConstraints::none, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool sweep = false, float delay = 0.0f, EDelayType::DelayType delayType = first, ETickType::TickType tickType = seconds, float tickTypeValue = 5.0f, EEaseType::EaseType easeType = linear, UCurveFloat* customEaseTypeCurve = nullptr, float punchAmplitude = 1.0f, ELoopType::LoopType loopType = once, int32 maximumLoopSections = 0, ELookType::LookType orientation = noOrientationChange, UObject* orientationTarget = nullptr, float orientationSpeed = 5.0f, ERotatorConstraints::RotatorConstraints rotatorConstraints = RotatorConstraints::none, UObject* onTweenStartTarget = nullptr, FString OnTweenStartFunctionName = "", UObject* onTweenUpdateTarget = nullptr, FString OnTweenUpdateFunctionName = "", UObject* onTweenLoopTarget = nullptr, FString OnTweenLoopFunctionName = "", UObject* onTweenCompleteTarget = nullptr, FString OnTweenCompleteFunctionName = "", bool tickWhenPaused = false, bool ignoreTimeDilation = false, bool tieToObjectValidity = true, bool cullNonRenderedTweens = false, float secondsToWaitBeforeCull = 3.f);
+
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Component Move From/To (Simple)"), Category = "iTween|Events|Component Tweens|Component Move")
 		static AiTweenEvent* ComponentMoveFromToSimple(FName tweenName = "No Name", USceneComponent* componentToMove = nullptr, FVector locationFrom = FVector::ZeroVector, FVector locationTo = FVector::ZeroVector, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool sweep = false, float timeInSeconds = 5.0f, EEaseType::EaseType easeType = linear, FString parameters = "", UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
 
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Component Move From/To (Simple, Handle)"), Category = "iTween|Events|Component Tweens|Component Move")
+		static FiTweenHandle ComponentMoveFromToSimpleWithHandle(FName tweenName = "No Name", USceneComponent* componentToMove = nullptr, FVector locationFrom = FVector::ZeroVector, FVector locationTo = FVector::ZeroVector, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool sweep = false, float timeInSeconds = 5.0f, EEaseType::EaseType easeType = linear, FString parameters = "", UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
+
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Component Move From/To (Expert)"), Category = "iTween|Events|Component Tweens|Component Move")
 		static AiTweenEvent* ComponentMoveFromToExpert(USceneComponent* componentToMove = nullptr, FString parameters = "", bool initializeOnSpawn = true, UCurveFloat* customEaseTypeCurve = nullptr, UObject* orientationTarget = nullptr, UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
 
@@ -322,9 +396,15 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Component Rotate From/To (Full)"), Category = "iTween|Events|Component Tweens|Component Rotate")
 		static AiTweenEvent* ComponentRotateFromToFull(float timerInterval = 0.f, FName tweenName = "No Name", USceneComponent* componentToRotate = nullptr, FRotator rotationFrom = FRotator::ZeroRotator, FRotator rotationTo = FRotator::ZeroRotator, bool enforceValueTo = true, ERotatorConstraints::RotatorConstraints rotatorConstraints = RotatorConstraints::none, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool shortestPath = false, float delay = 0.0f, EDelayType::DelayType delayType = first, ETickType::TickType tickType = seconds, float tickTypeValue = 5.0f, EEaseType::EaseType easeType = linear, UCurveFloat* customEaseTypeCurve = nullptr, float punchAmplitude = 1.0f, ELoopType::LoopType loopType = once, int32 maximumLoopSections = 0, UObject* onTweenStartTarget = nullptr, FString OnTweenStartFunctionName = "", UObject* onTweenUpdateTarget = nullptr, FString OnTweenUpdateFunctionName = "", UObject* onTweenLoopTarget = nullptr, FString OnTweenLoopFunctionName = "", UObject* onTweenCompleteTarget = nullptr, FString OnTweenCompleteFunctionName = "", bool tickWhenPaused = false, bool ignoreTimeDilation = false, bool tieToObjectValidity = true, bool cullNonRenderedTweens = false, float secondsToWaitBeforeCull = 3.f);
 
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Component Rotate From/To (Full, Handle)"), Category = "iTween|Events|Component Tweens|Component Rotate")
+		static FiTweenHandle ComponentRotateFromToFullWithHandle(float timerInterval = 0.f, FName tweenName = "No Name", USceneComponent* componentToRotate = nullptr, FRotator rotationFrom = FRotator::ZeroRotator, FRotator rotationTo = FRotator::ZeroRotator, bool enforceValueTo = true, ERotatorConstraints::RotatorConstraints rotatorConstraints = RotatorConstraints::none, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool shortestPath = false, float delay = 0.0f, EDelayType::DelayType delayType = first, ETickType::TickType tickType = seconds, float tickTypeValue = 5.0f, EEaseType::EaseType easeType = linear, UCurveFloat* customEaseTypeCurve = nullptr, float punchAmplitude = 1.0f, ELoopType::LoopType loopType = once, int32 maximumLoopSections = 0, UObject* onTweenStartTarget = nullptr, FString OnTweenStartFunctionName = "", UObject* onTweenUpdateTarget = nullptr, FString OnTweenUpdateFunctionName = "", UObject* onTweenLoopTarget = nullptr, FString OnTweenLoopFunctionName = "", UObject* onTweenCompleteTarget = nullptr, FString OnTweenCompleteFunctionName = "", bool tickWhenPaused = false, bool ignoreTimeDilation = false, bool tieToObjectValidity = true, bool cullNonRenderedTweens = false, float secondsToWaitBeforeCull = 3.f);
+
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Component Rotate From/To (Simple)"), Category = "iTween|Events|Component Tweens|Component Rotate")
 		static AiTweenEvent* ComponentRotateFromToSimple(FName tweenName = "No Name", USceneComponent* componentToRotate = nullptr, FRotator rotationFrom = FRotator::ZeroRotator, FRotator rotationTo = FRotator::ZeroRotator, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool shortestPath = false, float timeInSeconds = 5.0f, EEaseType::EaseType easeType = linear, FString parameters = "", UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
 
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Component Rotate From/To (Simple, Handle)"), Category = "iTween|Events|Component Tweens|Component Rotate")
+		static FiTweenHandle ComponentRotateFromToSimpleWithHandle(FName tweenName = "No Name", USceneComponent* componentToRotate = nullptr, FRotator rotationFrom = FRotator::ZeroRotator, FRotator rotationTo = FRotator::ZeroRotator, ECoordinateSpace::CoordinateSpace coordinateSpace = CoordinateSpace::world, bool shortestPath = false, float timeInSeconds = 5.0f, EEaseType::EaseType easeType = linear, FString parameters = "", UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
+
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Component Rotate From/To (Expert)"), Category = "iTween|Events|Component Tweens|Component Rotate")
 		static AiTweenEvent* ComponentRotateFromToExpert(USceneComponent* componentToRotate = nullptr, FString parameters = "", bool initializeOnSpawn = true, UCurveFloat* customEaseTypeCurve = nullptr, UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
 
@@ -352,9 +432,15 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Component Scale From/To (Full)"), Category = "iTween|Events|Component Tweens|Component Scale")
 		static AiTweenEvent* ComponentScaleFromToFull(float timerInterval = 0.f, FName tweenName = "No Name", USceneComponent* componentToScale = nullptr, FVector scaleFrom = FVector::ZeroVector, FVector scaleTo = FVector(1, 1, 1), bool enforceValueTo = true, EVectorConstraints::VectorConstraints vectorConstraints = VectorConstraints::none, bool isLocal = false, float delay = 0.0f, EDelayType::DelayType delayType = first, ETickType::TickType tickType = seconds, float tickTypeValue = 5.0f, EEaseType::EaseType easeType = linear, UCurveFloat* customEaseTypeCurve = nullptr, float punchAmplitude = 1.0f, ELoopType::LoopType loopType = once, int32 maximumLoopSections = 0, UObject* onTweenStartTarget = nullptr, FString OnTweenStartFunctionName = "", UObject* onTweenUpdateTarget = nullptr, FString OnTweenUpdateFunctionName = "", UObject* onTweenLoopTarget = nullptr, FString OnTweenLoopFunctionName = "", UObject* onTweenCompleteTarget = nullptr, FString OnTweenCompleteFunctionName = "", bool tickWhenPaused = false, bool ignoreTimeDilation = false, bool tieToObjectValidity = true, bool cullNonRenderedTweens = false, float secondsToWaitBeforeCull = 3.f);
 
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Component Scale From/To (Full, Handle)"), Category = "iTween|Events|Component Tweens|Component Scale")
+		static FiTweenHandle ComponentScaleFromToFullWithHandle(float timerInterval = 0.f, FName tweenName = "No Name", USceneComponent* componentToScale = nullptr, FVector scaleFrom = FVector::ZeroVector, FVector scaleTo = FVector(1, 1, 1), bool enforceValueTo = true, EVectorConstraints::VectorConstraints vectorConstraints = VectorConstraints::none, bool isLocal = false, float delay = 0.0f, EDelayType::DelayType delayType = first, ETickType::TickType tickType = seconds, float tickTypeValue = 5.0f, EEaseType::EaseType easeType = linear, UCurveFloat* customEaseTypeCurve = nullptr, float punchAmplitude = 1.0f, ELoopType::LoopType loopType = once, int32 maximumLoopSections = 0, UObject* onTweenStartTarget = nullptr, FString OnTweenStartFunctionName = "", UObject* onTweenUpdateTarget = nullptr, FString OnTweenUpdateFunctionName = "", UObject* onTweenLoopTarget = nullptr, FString OnTweenLoopFunctionName = "", UObject* onTweenCompleteTarget = nullptr, FString OnTweenCompleteFunctionName = "", bool tickWhenPaused = false, bool ignoreTimeDilation = false, bool tieToObjectValidity = true, bool cullNonRenderedTweens = false, float secondsToWaitBeforeCull = 3.f);
+
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Component Scale From/To (Simple)"), Category = "iTween|Events|Component Tweens|Component Scale")
 		static AiTweenEvent* ComponentScaleFromToSimple(FName tweenName = "No Name", USceneComponent* componentToScale = nullptr, FVector scaleFrom = FVector::ZeroVector, FVector scaleTo = FVector(1, 1, 1), bool isLocal = false, float timeInSeconds = 5.0f, EEaseType::EaseType easeType = linear, FString parameters = "", UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
 
+	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Component Scale From/To (Simple, Handle)"), Category = "iTween|Events|Component Tweens|Component Scale")
+		static FiTweenHandle ComponentScaleFromToSimpleWithHandle(FName tweenName = "No Name", USceneComponent* componentToScale = nullptr, FVector scaleFrom = FVector::ZeroVector, FVector scaleTo = FVector(1, 1, 1), bool isLocal = false, float timeInSeconds = 5.0f, EEaseType::EaseType easeType = linear, FString parameters = "", UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
+
 	UFUNCTION(BlueprintCallable, meta = (UnsafeDuringActorConstruction, DisplayName = "Component Scale From/To (Expert)"), Category = "iTween|Events|Component Tweens|Component Scale")
 		static AiTweenEvent* ComponentScaleFromToExpert(USceneComponent* componentToScale = nullptr, FString parameters = "", bool initializeOnSpawn = true, UCurveFloat* customEaseTypeCurve = nullptr, UObject* onTweenStartTarget = nullptr, UObject* onTweenUpdateTarget = nullptr, UObject* onTweenLoopTarget = nullptr, UObject* onTweenCompleteTarget = nullptr);
 
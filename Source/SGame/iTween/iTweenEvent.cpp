@@ -4,6 +4,7 @@
 #include "iTweenPCH.h"
 #include "iTween.h"
 #include "iTweenEvent.h"
+#include "iTEasing.h"
 
 AiTweenEvent::AiTweenEvent()
 {
@@ -26,7 +27,7 @@ void AiTweenEvent::EndPlay(const EEndPlayReason::Type endPlayReason)
 	{
 		UiTween::Print("iTweenEvent object destroyed.");
 
-		aux->currentTweens.Remove(this);
+		aux->tweenRegistry.Remove(this, aux->currentTweens);
 	}
 
 	if (eventType == EEventType::EventType::actorMoveToSplinePoint || eventType == EEventType::EventType::actorRotateToSplinePoint || eventType == EEventType::EventType::compMoveToSplinePoint || eventType == EEventType::EventType::compRotateToSplinePoint)
@@ -90,1870 +91,303 @@ void AiTweenEvent::SetTimerInterval(float interval /*= 0.f*/)
 	}
 }
 
-void AiTweenEvent::ParseParameters(FString params)
+void AiTweenEvent::ParseParameters(const FString& params)
 {
-	//Create an array and a map for parsing
-	TArray<FString> arr;
-	TMap<FString, FString> map;
-	//Split into new array entry after each semicolon
-	params.ParseIntoArray(arr, TEXT(";"), true);
-
-	//Split each array entry into map at the equal (assignment) sign
-	for (int i = 0; i < arr.Num(); i++)
-	{
-		arr[i].Trim();
-		arr[i].TrimTrailing();
-
-		FString left;
-		FString right;
-		arr[i].Split("=", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-		left = left.ToLower();
-		left.ReplaceInline(TEXT(" "), TEXT(""));
-		right.Trim();
-		right.TrimTrailing();
-		map.Add(left, right);
-	}
-
-	if (map.Contains("name"))
-	{
-		tweenName = FName(*map["name"]);
-		UiTween::Print("tweenName: " + tweenName.ToString());
-	}
-
-	if (map.Contains("floatfrom"))
-	{
-		map.Add("ffrom", map["floatfrom"]);
-		map.Remove("floatfrom");
-	}
-
-	if (map.Contains("ffrom"))
-	{
-		map["ffrom"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["ffrom"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["ffrom"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["ffrom"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["ffrom"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["ffrom"].ReplaceInline(TEXT("]"), TEXT(" "));
-
-		map["ffrom"].Trim();
-		map["ffrom"].TrimTrailing();
-
-		if (map["ffrom"].Contains("current") || map["ffrom"].Contains("this"))
-		{
-			if (widgetTweening != nullptr)
-			{
-				if (eventType == EEventType::EventType::umgRTRotateFromTo)
-				{
-					floatFrom = widgetTweening->RenderTransform.Angle;
-				}
-				else
-				{
-					UiTween::Print("You aren't performing a UMG RT Rotate From/To operation. The 'current' and 'this' keywords only apply to that operation. Defaulting floatFrom to 0.", "error");
-					floatFrom = 0.f;
-				}
-			}
-			else
-			{
-				UiTween::Print("You aren't performing a UMG RT Rotate From/To operation. The 'current' and 'this' keywords only apply to that operation. Defaulting floatFrom to 0.", "error");
-				floatFrom = 0.f;
-			}
-		}
-		else
-		{
-			floatFrom = FCString::Atof(*map["ffrom"]);
-		}
-
-		if (map["ffrom"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["ffrom"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			floatFrom *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("floatFrom: " + FString::SanitizeFloat(floatFrom));
-	}
-
-	if (map.Contains("floatto"))
-	{
-		map.Add("fto", map["floatto"]);
-		map.Remove("floatto");
-	}
-
-	if (map.Contains("fto"))
-	{
-		map["fto"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["fto"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["fto"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["fto"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["fto"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["fto"].ReplaceInline(TEXT("]"), TEXT(" "));
-
-		map["fto"].Trim();
-		map["fto"].TrimTrailing();
-
-		if (map["fto"].Contains("current") || map["fto"].Contains("this"))
-		{
-			if (widgetTweening != nullptr)
-			{
-				if (eventType == EEventType::EventType::umgRTRotateFromTo)
-				{
-					floatTo = widgetTweening->RenderTransform.Angle;
-				}
-				else
-				{
-					UiTween::Print("You aren't performing a UMG RT Rotate From/To operation. The 'current' and 'this' keywords only apply to that operation. Defaulting floatFrom to 0.", "error");
-					floatTo = 0.f;
-				}
-			}
-			else
-			{
-				UiTween::Print("You aren't performing a UMG RT Rotate From/To operation. The 'current' and 'this' keywords only apply to that operation. Defaulting floatFrom to 0.", "error");
-				floatTo = 0.f;
-			}
-		}
-		else
-		{
-			floatTo = FCString::Atof(*map["fto"]);
-		}
-
-		if (map["fto"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["fto"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			floatTo *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("floatTo: " + FString::SanitizeFloat(floatTo));
-	}
-
-	if (map.Contains("coordinatespace"))
-	{
-		map.Add("cspace", map["coordinatespace"]);
-		map.Remove(map["coordinatespace"]);
-	}
-
-	if (map.Contains("cspace"))
-	{
-		map["cspace"].Trim();
-		map["cspace"].TrimTrailing();
-
-		if (map["cspace"].Contains("world"))
-		{
-			coordinateSpace = ECoordinateSpace::CoordinateSpace::world;
-		}
-		else if (map["cspace"].Contains("parent"))
-		{
-			coordinateSpace = ECoordinateSpace::CoordinateSpace::parent;
-		}
-		else if (map["cspace"].Contains("self"))
-		{
-			coordinateSpace = ECoordinateSpace::CoordinateSpace::self;
-		}
-
-		UiTween::Print("coordinateSpace: " + map["cspace"]);
-	}
-
-	if (map.Contains("vectorfrom"))
-	{
-		map.Add("vfrom", map["vectorfrom"]);
-		map.Remove("vectorfrom");
-	}
-
-	if (map.Contains("vfrom"))
-	{
-		map["vfrom"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["vfrom"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["vfrom"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["vfrom"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["vfrom"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["vfrom"].ReplaceInline(TEXT("]"), TEXT(" "));
-		map["vfrom"].ReplaceInline(TEXT("FVector"), TEXT(" "));
-		map["vfrom"].ReplaceInline(TEXT("X="), TEXT(" "));
-		map["vfrom"].ReplaceInline(TEXT("Y="), TEXT(","));
-		map["vfrom"].ReplaceInline(TEXT("Z="), TEXT(","));
-
-		map["vfrom"].Trim();
-		map["vfrom"].TrimTrailing();
-
-		//Implement something that will allow a parameter to be the object's current transform
-		if (map["vfrom"].Contains("zero"))
-		{
-			vectorFrom = FVector::ZeroVector;
-		}
-		else if (map["vfrom"].Contains("one"))
-		{
-			vectorFrom = FVector(1, 1, 1);
-		}
-		else if (map["vfrom"].Contains("current") || map["vfrom"].Contains("this"))
-		{
-			if (actorTweening != nullptr)
-			{
-				vectorFrom = actorTweening->GetActorLocation();
-			}
-			else if (componentTweening != nullptr)
-			{
-				vectorFrom = componentTweening->GetComponentLocation();
-			}
-			else
-			{
-				UiTween::Print("You aren't performing an Actor- or SceneComponent-based operation. The 'current' and 'this' keywords only apply to those operations. Defaulting vectorFrom to (0,0,0).", "error");
-				vectorFrom = FVector::ZeroVector;
-			}
-		}
-		else
-		{
-			TArray<FString> parse;
-
-			map["vfrom"].ParseIntoArray(parse, TEXT(","), true);
-
-			vectorFrom = FVector(FCString::Atof(*parse[0]), FCString::Atof(*parse[1]), FCString::Atof(*parse[2]));
-		}
-
-		if (map["vfrom"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["vfrom"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			vectorFrom *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("vectorFrom: " + vectorFrom.ToString());
-	}
-
-	if (map.Contains("vectorto"))
-	{
-		map.Add("vto", map["vectorto"]);
-		map.Remove("vectorto");
-	}
-
-	if (map.Contains("vto"))
-	{
-		map["vto"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["vto"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["vto"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["vto"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["vto"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["vto"].ReplaceInline(TEXT("]"), TEXT(" "));
-		map["vto"].ReplaceInline(TEXT("FVector"), TEXT(" "));
-		map["vto"].ReplaceInline(TEXT("X="), TEXT(" "));
-		map["vto"].ReplaceInline(TEXT("Y="), TEXT(","));
-		map["vto"].ReplaceInline(TEXT("Z="), TEXT(","));
-
-		map["vto"].Trim();
-		map["vto"].TrimTrailing();
-
-		if (map["vto"].Contains("zero"))
-		{
-			vectorTo = FVector::ZeroVector;
-		}
-		else if (map["vto"].Contains("one"))
-		{
-			vectorTo = FVector(1, 1, 1);
-		}
-		else if (map["vto"].Contains("current") || map["vto"].Contains("this"))
-		{
-			if (actorTweening != nullptr)
-			{
-				vectorTo = actorTweening->GetActorLocation();
-			}
-			else if (componentTweening != nullptr)
-			{
-				vectorTo = componentTweening->GetComponentLocation();
-			}
-			else
-			{
-				UiTween::Print("You aren't performing an Actor- or SceneComponent-based operation. The 'current' and 'this' keywords only apply to those operations. Defaulting vectorTo to (0,0,0).", "error");
-				vectorTo = FVector::ZeroVector;
-			}
-		}
-		else
-		{
-			TArray<FString> parse;
-
-			map["vto"].ParseIntoArray(parse, TEXT(","), true);
-
-			vectorTo = FVector(FCString::Atof(*parse[0]), FCString::Atof(*parse[1]), FCString::Atof(*parse[2]));
-		}
-
-		if (map["vto"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["vto"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			vectorTo *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("vectorTo: " + vectorTo.ToString());
-	}
-
-	if (map.Contains("vector2dfrom"))
-	{
-		map.Add("v2from", map["vector2dfrom"]);
-		map.Remove("vector2dfrom");
-	}
-
-	if (map.Contains("v2from"))
-	{
-		map["v2from"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["v2from"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["v2from"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["v2from"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["v2from"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["v2from"].ReplaceInline(TEXT("]"), TEXT(" "));
-		map["v2from"].ReplaceInline(TEXT("FVector2D"), TEXT(" "));
-		map["v2from"].ReplaceInline(TEXT("X="), TEXT(" "));
-		map["v2from"].ReplaceInline(TEXT("Y="), TEXT(","));
-
-		map["v2from"].Trim();
-		map["v2from"].TrimTrailing();
-
-		if (map["v2from"].Contains("zero"))
-		{
-			vector2DFrom = FVector2D::ZeroVector;
-		}
-		else if (map["v2from"].Contains("one"))
-		{
-			vector2DFrom = FVector2D(1, 1);
-		}
-		else if (map["v2from"].Contains("current") || map["v2from"].Contains("this"))
-		{
-			if (widgetTweening != nullptr)
-			{
-				if (eventType == EEventType::EventType::umgRTMoveFromTo)
-				{
-					vector2DFrom = widgetTweening->RenderTransform.Translation;
-				}
-				else if (eventType == EEventType::EventType::umgRTScaleFromTo)
-				{
-					vector2DFrom = widgetTweening->RenderTransform.Scale;
-				}
-				else if (eventType == EEventType::EventType::umgRTShearFromTo)
-				{
-					vector2DFrom = widgetTweening->RenderTransform.Shear;
-				}
-				else
-				{
-					UiTween::Print("You aren't performing a UMG RT Move, Scale, or Shear From/To operation. The 'current' and 'this' keywords only apply to those operations. Defaulting vector2DFrom to (0,0).", "error");
-					vector2DFrom = FVector2D::ZeroVector;
-				}
-			}
-#if !PLATFORM_ANDROID
-			else if (slateTweening)
-			{
-				if (eventType == EEventType::EventType::slateMoveFromTo)
-				{
-					vector2DFrom = slateTweening->TweenTransform.Translation;
-				}
-				else if (eventType == EEventType::EventType::slateScaleFromTo)
-				{
-					vector2DFrom = slateTweening->TweenTransform.Scale;
-				}
-				else
-				{
-					UiTween::Print("You aren't performing a Slate Move, Scale, or Shear From/To operation. The 'current' and 'this' keywords only apply to those operations. Defaulting vector2DFrom to (0,0).", "error");
-					vector2DFrom = FVector2D::ZeroVector;
-				}
-			}
-#endif
-			else
-			{
-				UiTween::Print("You aren't performing a Slate or UMG RT Move, Scale, or Shear From/To operation. The 'current' and 'this' keywords only apply to those operations. Defaulting vector2DFrom to (0,0).", "error");
-				vector2DFrom = FVector2D::ZeroVector;
-			}
-		}
-		else
-		{
-			TArray<FString> parse;
-
-			map["v2from"].ParseIntoArray(parse, TEXT(","), true);
-
-			vector2DFrom = FVector2D(FCString::Atof(*parse[0]), FCString::Atof(*parse[1]));
-		}
-
-		if (map["v2from"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["v2from"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			vector2DFrom *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("vector2DFrom: " + vector2DFrom.ToString());
-	}
-
-	if (map.Contains("vector2dto"))
-	{
-		map.Add("v2to", map["vector2dto"]);
-		map.Remove("vector2dto");
-	}
-
-	if (map.Contains("v2to"))
-	{
-		map["v2to"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["v2to"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["v2to"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["v2to"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["v2to"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["v2to"].ReplaceInline(TEXT("]"), TEXT(" "));
-		map["v2to"].ReplaceInline(TEXT("FVector2D"), TEXT(" "));
-		map["v2to"].ReplaceInline(TEXT("X="), TEXT(" "));
-		map["v2to"].ReplaceInline(TEXT("Y="), TEXT(","));
-
-		map["v2to"].Trim();
-		map["v2to"].TrimTrailing();
-
-		if (map["v2to"].Contains("zero"))
-		{
-			vector2DTo = FVector2D::ZeroVector;
-		}
-		else if (map["v2to"].Contains("one"))
-		{
-			vector2DTo = FVector2D(1, 1);
-		}
-		else if (map["v2to"].Contains("current") || map["v2to"].Contains("this"))
-		{
-			if (widgetTweening != nullptr)
-			{
-				if (eventType == EEventType::EventType::umgRTMoveFromTo)
-				{
-					vector2DTo = widgetTweening->RenderTransform.Translation;
-				}
-				else if (eventType == EEventType::EventType::umgRTScaleFromTo)
-				{
-					vector2DTo = widgetTweening->RenderTransform.Scale;
-				}
-				else if (eventType == EEventType::EventType::umgRTShearFromTo)
-				{
-					vector2DTo = widgetTweening->RenderTransform.Shear;
-				}
-				else
-				{
-					UiTween::Print("You aren't performing a UMG RT Move, Scale, or Shear From/To operation. The 'current' and 'this' keywords only apply to those operations. Defaulting vector2DTo to (0,0).", "error");
-					vector2DFrom = FVector2D::ZeroVector;
-				}
-			}
-#if !PLATFORM_ANDROID
-			else if (slateTweening)
-			{
-				if (eventType == EEventType::EventType::slateMoveFromTo)
-				{
-					if (slateTweening->GetRenderTransform().IsSet())
-					{
-						vector2DTo = slateTweening->TweenTransform.Translation;
-					}
-				}
-				else if (eventType == EEventType::EventType::slateScaleFromTo)
-				{
-					if (slateTweening->GetRenderTransform().IsSet())
-					{
-						vector2DTo = slateTweening->TweenTransform.Scale;
-					}
-				}
-				else
-				{
-					UiTween::Print("You aren't performing a Slate Move, Scale, or Shear From/To operation. The 'current' and 'this' keywords only apply to those operations. Defaulting vector2DFrom to (0,0).", "error");
-					vector2DFrom = FVector2D::ZeroVector;
-				}
-			}
-#endif
-			else
-			{
-				UiTween::Print("You aren't performing a UMG RT Move, Scale, or Shear From/To operation. The 'current' and 'this' keywords only apply to those operations. Defaulting vector2DTo to (0,0).", "error");
-				vector2DFrom = FVector2D::ZeroVector;
-			}
-		}
-		else
-		{
-			TArray<FString> parse;
-
-			map["v2to"].ParseIntoArray(parse, TEXT(","), true);
-
-			vector2DTo = FVector2D(FCString::Atof(*parse[0]), FCString::Atof(*parse[1]));
-		}
-
-		if (map["v2to"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["v2to"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			vector2DTo *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("vector2DTo: " + vector2DTo.ToString());
-	}
-
-	if (map.Contains("rotatorfrom"))
-	{
-		map.Add("rfrom", map["rotatorfrom"]);
-		map.Remove("rotatorfrom");
-	}
-
-	if (map.Contains("rfrom"))
-	{
-		map["rfrom"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["rfrom"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["rfrom"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["rfrom"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["rfrom"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["rfrom"].ReplaceInline(TEXT("]"), TEXT(" "));
-		map["rfrom"].ReplaceInline(TEXT("FRotator"), TEXT(" "));
-		map["rfrom"].ReplaceInline(TEXT("P="), TEXT(" "));
-		map["rfrom"].ReplaceInline(TEXT("Y="), TEXT(","));
-		map["rfrom"].ReplaceInline(TEXT("R="), TEXT(","));
-
-		map["rfrom"].Trim();
-		map["rfrom"].TrimTrailing();
-
-		if (map["rfrom"].Contains("zero"))
-		{
-			rotatorFrom = FRotator::ZeroRotator;
-		}
-		else if (map["rfrom"].Contains("one"))
-		{
-			rotatorFrom = FRotator(1, 1, 1);
-		}
-		else if (map["rfrom"].Contains("current") || map["rfrom"].Contains("this"))
-		{
-			if (actorTweening != nullptr)
-			{
-				rotatorFrom = actorTweening->GetActorRotation();
-			}
-			else if (componentTweening != nullptr)
-			{
-				rotatorFrom = componentTweening->GetComponentRotation();
-			}
-			else
-			{
-				UiTween::Print("You aren't performing an Actor- or SceneComponent-based operation. The 'current' and 'this' keywords only apply to those operations. Defaulting rotatorFrom to (0,0,0).", "error");
-				rotatorFrom = FRotator::ZeroRotator;
-			}
-		}
-		else
-		{
-			TArray<FString> parse;
-
-			map["rfrom"].ParseIntoArray(parse, TEXT(","), true);
-
-			rotatorFrom = FRotator(FCString::Atof(*parse[0]), FCString::Atof(*parse[1]), FCString::Atof(*parse[2]));
-		}
-
-		if (map["rfrom"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["rfrom"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			rotatorFrom *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("rotatorFrom: " + rotatorFrom.ToString());
-	}
-
-	if (map.Contains("rotatorto"))
-	{
-		map.Add("rto", map["rotatorto"]);
-		map.Remove("rotatorto");
-	}
-
-	if (map.Contains("rto"))
-	{
-		map["rto"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["rto"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["rto"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["rto"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["rto"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["rto"].ReplaceInline(TEXT("]"), TEXT(" "));
-		map["rto"].ReplaceInline(TEXT("FRotator"), TEXT(" "));
-		map["rto"].ReplaceInline(TEXT("P="), TEXT(" "));
-		map["rto"].ReplaceInline(TEXT("Y="), TEXT(","));
-		map["rto"].ReplaceInline(TEXT("R="), TEXT(","));
-
-		map["rto"].Trim();
-		map["rto"].TrimTrailing();
-
-		if (map["rto"].Contains("zero"))
-		{
-			rotatorTo = FRotator::ZeroRotator;
-		}
-		else if (map["rto"].Contains("one"))
-		{
-			rotatorTo = FRotator(1, 1, 1);
-		}
-		else if (map["rto"].Contains("current") || map["rto"].Contains("this"))
-		{
-			if (actorTweening != nullptr)
-			{
-				rotatorTo = actorTweening->GetActorRotation();
-			}
-			else if (componentTweening != nullptr)
-			{
-				rotatorTo = componentTweening->GetComponentRotation();
-			}
-			else
-			{
-				UiTween::Print("You aren't performing an Actor- or SceneComponent-based operation. The 'current' and 'this' keywords only apply to those operations. Defaulting rotatorTo to (0,0,0).", "error");
-				rotatorTo = FRotator::ZeroRotator;
-			}
-		}
-		else
-		{
-			TArray<FString> parse;
-
-			map["rto"].ParseIntoArray(parse, TEXT(","), true);
-
-			rotatorTo = FRotator(FCString::Atof(*parse[0]), FCString::Atof(*parse[1]), FCString::Atof(*parse[2]));
-		}
-
-		if (map["rto"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["rto"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			rotatorTo *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("rotatorTo: " + rotatorTo.ToString());
-	}
-
-	if (map.Contains("linearcolorfrom"))
-	{
-		map.Add("lcfrom", map["linearcolorfrom"]);
-		map.Remove("linearcolorfrom");
-	}
-
-	if (map.Contains("linearcolourfrom"))
-	{
-		map.Add("lcfrom", map["linearcolourfrom"]);
-		map.Remove("linearcolourfrom");
-	}
-
-	if (map.Contains("colorfrom"))
-	{
-		map.Add("lcfrom", map["colorfrom"]);
-		map.Remove("colorfrom");
-	}
-
-	if (map.Contains("colourfrom"))
-	{
-		map.Add("lcfrom", map["colourfrom"]);
-		map.Remove("colourfrom");
-	}
-
-	if (map.Contains("cfrom"))
-	{
-		map.Add("lcfrom", map["cfrom"]);
-		map.Remove("cfrom");
-	}
-
-	if (map.Contains("lcfrom"))
-	{
-		map["lcfrom"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["lcfrom"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["lcfrom"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["lcfrom"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["lcfrom"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["lcfrom"].ReplaceInline(TEXT("]"), TEXT(" "));
-		map["lcfrom"].ReplaceInline(TEXT("FLinearColor"), TEXT(" "));
-		map["lcfrom"].ReplaceInline(TEXT("R="), TEXT(" "));
-		map["lcfrom"].ReplaceInline(TEXT("G="), TEXT(","));
-		map["lcfrom"].ReplaceInline(TEXT("B="), TEXT(","));
-		map["lcfrom"].ReplaceInline(TEXT("A="), TEXT(","));
-
-		map["lcfrom"].Trim();
-		map["lcfrom"].TrimTrailing();
-
-		TArray<FString> parse;
-
-		map["lcfrom"].ParseIntoArray(parse, TEXT(","), true);
-
-		if (parse.Num() == 1)
-		{
-			map["lcfrom"].ToLower();
-
-			if (map["lcfrom"].Contains("black"))
-			{
-				linearColorFrom = FLinearColor(FColor::Black);
-			}
-			else if (map["lcfrom"].Contains("blue"))
-			{
-				linearColorFrom = FLinearColor(FColor::Blue);
-			}
-			else if (map["lcfrom"].Contains("cyan"))
-			{
-				linearColorFrom = FLinearColor(FColor::Cyan);
-			}
-			else if (map["lcfrom"].Contains("green"))
-			{
-				linearColorFrom = FLinearColor(FColor::Green);
-			}
-			else if (map["lcfrom"].Contains("magenta"))
-			{
-				linearColorFrom = FLinearColor(FColor::Magenta);
-			}
-			else if (map["lcfrom"].Contains("red"))
-			{
-				linearColorFrom = FLinearColor(FColor::Red);
-			}
-			else if (map["lcfrom"].Contains("white"))
-			{
-				linearColorFrom = FLinearColor(FColor::White);
-			}
-			else if (map["lcfrom"].Contains("yellow"))
-			{
-				linearColorFrom = FLinearColor(FColor::Yellow);
-			}
-		}
-		else if (parse.Num() == 2)
-		{
-			UiTween::Print("Linear color parameters take 1, 3, or 4 arguments, not 2.", "error");
-		}
-		else if (parse.Num() == 3)
-		{
-			linearColorFrom = FLinearColor(FCString::Atof(*parse[0]), FCString::Atof(*parse[1]), FCString::Atof(*parse[2]));
-		}
-		else if (parse.Num() == 4)
-		{
-			linearColorFrom = FLinearColor(FCString::Atof(*parse[0]), FCString::Atof(*parse[1]), FCString::Atof(*parse[2]), FCString::Atof(*parse[3]));
-		}
-
-		if (map["lcfrom"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["lcfrom"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			linearColorFrom *= FCString::Atof(*right);
-			linearColorFrom.A /= FCString::Atof(*right);
-		}
-
-		UiTween::Print("linearColorFrom: " + linearColorFrom.ToString());
-	}
-
-	if (map.Contains("linearcolorto"))
-	{
-		map.Add("lcto", map["linearcolorto"]);
-		map.Remove("linearcolorto");
-	}
-
-	if (map.Contains("linearcolourto"))
-	{
-		map.Add("lcto", map["linearcolourto"]);
-		map.Remove("linearcolourto");
-	}
-
-	if (map.Contains("colorto"))
-	{
-		map.Add("lcto", map["colorto"]);
-		map.Remove("colorto");
-	}
-
-	if (map.Contains("colourto"))
-	{
-		map.Add("lcto", map["colourto"]);
-		map.Remove("colourto");
-	}
-
-	if (map.Contains("cto"))
-	{
-		map.Add("lcto", map["cto"]);
-		map.Remove("cto");
-	}
-
-	if (map.Contains("lcto"))
-	{
-		map["lcto"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["lcto"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["lcto"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["lcto"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["lcto"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["lcto"].ReplaceInline(TEXT("]"), TEXT(" "));
-		map["lcto"].ReplaceInline(TEXT("FLinearColor"), TEXT(" "));
-		map["lcto"].ReplaceInline(TEXT("R="), TEXT(" "));
-		map["lcto"].ReplaceInline(TEXT("G="), TEXT(","));
-		map["lcto"].ReplaceInline(TEXT("B="), TEXT(","));
-		map["lcto"].ReplaceInline(TEXT("A="), TEXT(","));
-
-		map["lcto"].Trim();
-		map["lcto"].TrimTrailing();
-
-		TArray<FString> parse;
-
-		map["lcto"].ParseIntoArray(parse, TEXT(","), true);
-
-		if (parse.Num() == 1)
-		{
-			map["lcto"].ToLower();
-
-			if (map["lcto"].Contains("black"))
-			{
-				linearColorTo = FLinearColor(FColor::Black);
-			}
-			else if (map["lcto"].Contains("blue"))
-			{
-				linearColorTo = FLinearColor(FColor::Blue);
-			}
-			else if (map["lcto"].Contains("cyan"))
-			{
-				linearColorTo = FLinearColor(FColor::Cyan);
-			}
-			else if (map["lcto"].Contains("green"))
-			{
-				linearColorTo = FLinearColor(FColor::Green);
-			}
-			else if (map["lcto"].Contains("magenta"))
-			{
-				linearColorTo = FLinearColor(FColor::Magenta);
-			}
-			else if (map["lcto"].Contains("red"))
-			{
-				linearColorTo = FLinearColor(FColor::Red);
-			}
-			else if (map["lcto"].Contains("white"))
-			{
-				linearColorTo = FLinearColor(FColor::White);
-			}
-			else if (map["lcto"].Contains("yellow"))
-			{
-				linearColorTo = FLinearColor(FColor::Yellow);
-			}
-		}
-		else if (parse.Num() == 2)
-		{
-			UiTween::Print("Color parameters take 1, 3, or 4 arguments, not 2.", "error");
-		}
-		else if (parse.Num() == 3)
-		{
-			linearColorTo = FLinearColor(FCString::Atof(*parse[0]), FCString::Atof(*parse[1]), FCString::Atof(*parse[2]));
-		}
-		else if (parse.Num() == 4)
-		{
-			linearColorTo = FLinearColor(FCString::Atof(*parse[0]), FCString::Atof(*parse[1]), FCString::Atof(*parse[2]), FCString::Atof(*parse[3]));
-		}
-
-		if (map["lcto"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["lcto"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			linearColorTo *= FCString::Atof(*right);
-			linearColorTo.A /= FCString::Atof(*right);
-		}
-
-		UiTween::Print("linearColorTo: " + linearColorTo.ToString());
-	}
-
-	if (map.Contains("delaytype"))
-	{
-		map.Add("dtype", map["delaytype"]);
-		map.Remove("delaytype");
-	}
-
-	if (map.Contains("dtype"))
-	{
-		if (map["dtype"] == "first")
-		{
-			delayType = EDelayType::DelayType::first;
-		}
-		else if (map["dtype"] == "firstloop")
-		{
-			delayType = EDelayType::DelayType::firstLoop;
-		}
-		else if (map["dtype"] == "firstloopfull")
-		{
-			delayType = EDelayType::DelayType::firstLoopFull;
-		}
-		else if (map["dtype"] == "loop")
-		{
-			delayType = EDelayType::DelayType::loop;
-		}
-		else if (map["dtype"] == "loopfull")
-		{
-			delayType = EDelayType::DelayType::loopFull;
-		}
-		else
-		{
-			UiTween::Print("Acceptable parameters for the delayType argument are: first, firstloop, firstloopfull, loop, and loopfull.", "error");
-		}
-
-		UiTween::Print("delaytype: " + map["dtype"]);
-	}
-
-	if (map.Contains("delay"))
-	{
-		map["delay"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["delay"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["delay"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["delay"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["delay"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["delay"].ReplaceInline(TEXT("]"), TEXT(" "));
-
-		map["delay"].Trim();
-		map["delay"].TrimTrailing();
-
-		delay = FCString::Atof(*map["delay"]);
-
-		if (map["delay"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["delay"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			delay *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("delay: " + FString::SanitizeFloat(delay));
-	}
-
-	if (map.Contains("ticktype"))
-	{
-		map.Add("ttype", map["ticktype"]);
-		map.Remove("ticktype");
-	}
-
-	if (map.Contains("ttype"))
-	{
-		if (map["ttype"] == "seconds")
-		{
-			tickType = ETickType::TickType::seconds;
-		}
-		else if (map["ttype"] == "speed")
-		{
-			tickType = ETickType::TickType::speed;
-		}
-		else
-		{
-			UiTween::Print("Acceptable parameters for the tickType argument are: seconds and speed.", "error");
-		}
-
-		UiTween::Print("tickType: " + map["ttype"]);
-	}
-
-	if (map.Contains("ticktypevalue"))
-	{
-		map.Add("ttv", map["ticktypevalue"]);
-		map.Remove("ticktypevalue");
-	}
-
-	if (map.Contains("ttv"))
-	{
-		map["ttv"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["ttv"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["ttv"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["ttv"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["ttv"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["ttv"].ReplaceInline(TEXT("]"), TEXT(" "));
-
-		map["ttv"].Trim();
-		map["ttv"].TrimTrailing();
-
-		tickTypeValue = FCString::Atof(*map["ttv"]);
-
-		if (map["ttv"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["ttv"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			tickTypeValue *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("tickTypeValue: " + FString::SanitizeFloat(tickTypeValue));
-	}
-
-	if (map.Contains("speed"))
-	{
-		tickType = ETickType::TickType::speed;
-
-		map["speed"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["speed"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["speed"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["speed"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["speed"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["speed"].ReplaceInline(TEXT("]"), TEXT(" "));
-
-		map["speed"].Trim();
-		map["speed"].TrimTrailing();
-
-		tickTypeValue = FCString::Atof(*map["speed"]);
-
-		if (map["speed"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["speed"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			tickTypeValue *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("speed: " + FString::SanitizeFloat(tickTypeValue));
-	}
-
-	if (map.Contains("timeinseconds"))
-	{
-		tickType = ETickType::TickType::seconds;
-
-		map["timeinseconds"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["timeinseconds"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["timeinseconds"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["timeinseconds"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["timeinseconds"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["timeinseconds"].ReplaceInline(TEXT("]"), TEXT(" "));
-
-		map["timeinseconds"].Trim();
-		map["timeinseconds"].TrimTrailing();
-
-		tickTypeValue = FCString::Atof(*map["timeinseconds"]);
-
-		if (map["timeinseconds"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["timeinseconds"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			tickTypeValue *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("timeInSeconds: " + FString::SanitizeFloat(tickTypeValue));
-	}
-
-	if (map.Contains("time"))
-	{
-		tickType = ETickType::TickType::seconds;
-
-		map["time"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["time"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["time"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["time"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["time"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["time"].ReplaceInline(TEXT("]"), TEXT(" "));
-
-		map["time"].Trim();
-		map["time"].TrimTrailing();
-
-		tickTypeValue = FCString::Atof(*map["time"]);
-
-		if (map["time"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["time"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			tickTypeValue *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("timeInSeconds: " + FString::SanitizeFloat(tickTypeValue));
-	}
-
-	if (map.Contains("punchamplitude"))
-	{
-		map.Add("pamp", map["punchamplitude"]);
-		map.Remove("punchamplitude");
-	}
-
-	if (map.Contains("punch"))
-	{
-		map.Add("pamp", map["punch"]);
-		map.Remove("punch");
-	}
-
-	if (map.Contains("pamp"))
-	{
-		map["pamp"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["pamp"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["pamp"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["pamp"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["pamp"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["pamp"].ReplaceInline(TEXT("]"), TEXT(" "));
-
-		map["pamp"].Trim();
-		map["pamp"].TrimTrailing();
-
-		punchAmplitude = FCString::Atof(*map["pAmp"]);
-
-		if (map["pamp"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["pamp"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			punchAmplitude *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("punchAmplitude: " + FString::SanitizeFloat(punchAmplitude));
-	}
-
-	if (map.Contains("generatedpointdistance"))
-	{
-		map.Add("gpd", map["generatedpointdistance"]);
-		map.Remove("generatedpointdistance");
-	}
-
-	if (map.Contains("gpd"))
-	{
-		map["gpd"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["gpd"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["gpd"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["gpd"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["gpd"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["gpd"].ReplaceInline(TEXT("]"), TEXT(" "));
-
-		map["gpd"].Trim();
-		map["gpd"].TrimTrailing();
-
-		generatedPointDistance = FCString::Atof(*map["pAmp"]);
-
-		if (map["gpd"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["gpd"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			generatedPointDistance *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("generatedPointDistance: " + FString::SanitizeFloat(generatedPointDistance));
-	}
-
-	if (map.Contains("sweep"))
-	{
-		if (map["sweep"].Contains("true"))
-		{
-			sweep = true;
-		}
-		else
-		{
-			sweep = false;
-		}
-
-		UiTween::Print("sweep: " + map["sweep"]);
-	}
-
-	if (map.Contains("vectorconstraints"))
-	{
-		map.Add("vconst", map["vectorconstraints"]);
-		map.Remove("vectorconstraints");
-	}
-
-	if (map.Contains("vconst"))
+	//The string is only parsed the first time it is seen, see FiTweenParams::FindOrCompile
+	if (!params.IsEmpty())
 	{
-		if (map["vconst"].Contains("no"))
-		{
-			vectorConstraints = EVectorConstraints::VectorConstraints::none;
-		}
-		else if (map["vconst"] == "x")
-		{
-			vectorConstraints = EVectorConstraints::VectorConstraints::xOnly;
-		}
-		else if (map["vconst"] == "y")
-		{
-			vectorConstraints = EVectorConstraints::VectorConstraints::yOnly;
-		}
-		else if (map["vconst"] == "z")
-		{
-			vectorConstraints = EVectorConstraints::VectorConstraints::zOnly;
-		}
-		else if (map["vconst"] == "xy")
-		{
-			vectorConstraints = EVectorConstraints::VectorConstraints::xyOnly;
-		}
-		else if (map["vconst"] == "xz")
-		{
-			vectorConstraints = EVectorConstraints::VectorConstraints::xzOnly;
-		}
-		else if (map["vconst"] == "yz")
-		{
-			vectorConstraints = EVectorConstraints::VectorConstraints::yzOnly;
-		}
-		else
-		{
-			UiTween::Print("Acceptable parameters for the vectorConstraints argument are: no, none, x, y, z, xy, xz, and yz.", "error");
-		}
-
-		UiTween::Print("vectorConstraints: " + map["vconst"]);
-	}
-
-	if (map.Contains("vector2dconstraints"))
-	{
-		map.Add("v2const", map["vector2dconstraints"]);
-		map.Remove("vector2dconstraints");
-	}
-
-	if (map.Contains("v2const"))
-	{
-		if (map["v2const"].Contains("no"))
-		{
-			vector2DConstraints = EVector2DConstraints::Vector2DConstraints::none;
-		}
-		else if (map["v2const"] == "x")
-		{
-			vector2DConstraints = EVector2DConstraints::Vector2DConstraints::xOnly;
-		}
-		else if (map["v2const"] == "y")
-		{
-			vector2DConstraints = EVector2DConstraints::Vector2DConstraints::yOnly;
-		}
-		else
-		{
-			UiTween::Print("Acceptable parameters for the vector2DConstraints argument are: no, none, x, and y.", "error");
-		}
-
-		UiTween::Print("vector2DConstraints: " + map["v2const"]);
-	}
-
-	if (map.Contains("rotatorconstraints"))
-	{
-		map.Add("rconst", map["rotatorconstraints"]);
-		map.Remove("rotatorconstraints");
-	}
-
-	if (map.Contains("rconst"))
-	{
-		if (map["rconst"].Contains("no"))
-		{
-			rotatorConstraints = ERotatorConstraints::RotatorConstraints::none;
-		}
-		else if (map["rconst"] == "pitch")
-		{
-			rotatorConstraints = ERotatorConstraints::RotatorConstraints::pitchOnly;
-		}
-		else if (map["rconst"] == "yaw")
-		{
-			rotatorConstraints = ERotatorConstraints::RotatorConstraints::yawOnly;
-		}
-		else if (map["rconst"] == "roll")
-		{
-			rotatorConstraints = ERotatorConstraints::RotatorConstraints::rollOnly;
-		}
-		else if (map["rconst"] == "pitchyaw")
-		{
-			rotatorConstraints = ERotatorConstraints::RotatorConstraints::pitchYawOnly;
-		}
-		else if (map["rconst"] == "pitchroll")
-		{
-			rotatorConstraints = ERotatorConstraints::RotatorConstraints::pitchRollOnly;
-		}
-		else if (map["rconst"] == "yawroll")
-		{
-			rotatorConstraints = ERotatorConstraints::RotatorConstraints::yawRollOnly;
-		}
-		else
-		{
-			UiTween::Print("Acceptable parameters for the rotatorConstraints argument are: no, none, pitch, yaw, roll, pitchyaw, pitchroll, and yawroll.", "error");
-		}
-
-		UiTween::Print("rotatorConstraints: " + map["rconst"]);
-	}
-
-	if (map.Contains("looptype"))
-	{
-		map.Add("loop", map["looptype"]);
-		map.Remove("looptype");
-	}
-
-	if (map.Contains("loop"))
-	{
-		if (map["loop"] == "once")
-		{
-			loopType = ELoopType::LoopType::once;
-		}
-		else if (map["loop"] == "pingpong" || map["loop"] == "backandforth")
-		{
-			loopType = ELoopType::LoopType::pingPong;
-		}
-		else if (map["loop"] == "rewind")
-		{
-			loopType = ELoopType::LoopType::rewind;
-		}
-		else
-		{
-			UiTween::Print("Acceptable parameters for the loopType argument are: once, pingpong or backandforth, and rewind.", "error");
-		}
-
-		UiTween::Print("loopType: " + map["loop"]);
-	}
-
-	if (map.Contains("looktype"))
-	{
-		map.Add("look", map["looktype"]);
-		map.Remove("looktype");
-	}
-
-	if (map.Contains("orientation"))
-	{
-		map.Add("look", map["orientation"]);
-		map.Remove("orientation");
-	}
-
-	if (map.Contains("look"))
-	{
-		if (map["look"].Contains("no"))
-		{
-			orientation = ELookType::LookType::noOrientationChange;
-		}
-		else if (map["look"].Contains("path"))
-		{
-			orientation = ELookType::LookType::orientToPath;
-		}
-		else if (map["look"].Contains("target"))
-		{
-			orientation = ELookType::LookType::orientToTarget;
-		}
-		else
-		{
-			UiTween::Print("Acceptable parameters for the orientation argument are: no, path, and target.", "error");
-		}
-
-		UiTween::Print("lookType/orientation: " + map["look"]);
-	}
-
-	if (map.Contains("orientationspeed"))
-	{
-		map.Add("ospeed", map["orientationspeed"]);
-		map.Remove("orientationspeed");
-	}
-
-	if (map.Contains("lookspeed"))
-	{
-		map.Add("ospeed", map["lookspeed"]);
-		map.Remove("lookspeed");
-	}
-
-	if (map.Contains("ospeed"))
-	{
-		map["ospeed"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["ospeed"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["ospeed"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["ospeed"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["ospeed"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["ospeed"].ReplaceInline(TEXT("]"), TEXT(" "));
-
-		map["ospeed"].Trim();
-		map["ospeed"].TrimTrailing();
-
-		orientationSpeed = FCString::Atof(*map["ospeed"]);
-
-		if (map["ospeed"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["ospeed"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			orientationSpeed *= FCString::Atof(*right);
-		}
-
-		UiTween::Print("orientationSpeed: " + FString::SanitizeFloat(orientationSpeed));
-	}
-
-	if (map.Contains("tickwhenpaused"))
-	{
-		map.Add("twp", map["tickwhenpaused"]);
-		map.Remove("tickwhenpaused");
-	}
-
-	if (map.Contains("twp"))
-	{
-		if (map["twp"].Contains("true"))
-		{
-			tickWhenPaused = true;
-		}
-		else
-		{
-			tickWhenPaused = false;
-		}
-
-		UiTween::Print("tickWhenPaused: " + map["twp"]);
-	}
-
-	if (map.Contains("ignoretimedilation"))
-	{
-		map.Add("itd", map["ignoretimedilation"]);
-		map.Remove("ignoretimedilation");
-	}
-
-	if (map.Contains("itd"))
-	{
-		if (map["itd"].Contains("true"))
-		{
-			ignoreTimeDilation = true;
-		}
-		else
-		{
-			ignoreTimeDilation = false;
-		}
-
-		UiTween::Print("ignoreTimeDilation: " + map["itd"]);
-	}
-
-	if (map.Contains("interp"))
-	{
-		if (map["interp"].Contains("true"))
-		{
-			interpolateToSpline = true;
-		}
-		else
-		{
-			interpolateToSpline = false;
-		}
-
-		UiTween::Print("interpolateToSpline: " + map["interp"]);
-	}
-
-	if (map.Contains("switchpathorientationdirection"))
-	{
-		map.Add("spod", map["switchpathorientationdirection"]);
-		map.Remove("switchpathorientationdirection");
-	}
-
-	if (map.Contains("spod"))
-	{
-		if (map["spod"].Contains("true"))
-		{
-			switchPathOrientationDirection = true;
-		}
-		else
-		{
-			switchPathOrientationDirection = false;
-		}
-
-		UiTween::Print("switchPathOrientationDirection: " + map["spod"]);
-	}
-
-	if (map.Contains("destroysplineobject"))
-	{
-		map.Add("dso", map["destroysplineobject"]);
-		map.Remove("destroysplineobject");
-	}
-
-	if (map.Contains("destroyspline"))
-	{
-		map.Add("dso", map["destroyspline"]);
-		map.Remove("destroyspline");
-	}
-
-	if (map.Contains("dso"))
-	{
-		if (map["dso"].Contains("true"))
-		{
-			destroySplineObject = true;
-		}
-		else
-		{
-			destroySplineObject = false;
-		}
-
-		UiTween::Print("destroySplineObject: " + map["dso"]);
-	}
-
-	if (map.Contains("shortestpath"))
-	{
-		map.Add("short", map["shortestpath"]);
-		map.Remove(map["shortestpath"]);
-	}
-
-	if (map.Contains("short"))
-	{
-		if (map["short"].Contains("true"))
-		{
-			shortestPath = true;
-		}
-		else
-		{
-			shortestPath = false;
-		}
-
-		UiTween::Print("shortestPath: " + map["short"]);
-	}
-
-	if (map.Contains("easetype"))
-	{
-		map.Add("ease", map["easetype"]);
-		map.Remove(map["easetype"]);
+		ApplyParameters(FiTweenParams::FindOrCompile(params));
 	}
+}
 
-	if (map.Contains("ease"))
-	{
-		map["ease"].Trim();
-		map["ease"].TrimTrailing();
-
-		if (map["ease"].Contains("linear"))
-		{
-			easeType = EEaseType::EaseType::linear;
-		}
-		else if (map["ease"].Contains("punch"))
-		{
-			easeType = EEaseType::EaseType::punch;
-		}
-		else if (map["ease"].Contains("spring"))
-		{
-			easeType = EEaseType::EaseType::spring;
-		}
-		else if (map["ease"].Contains("curve"))
-		{
-			easeType = EEaseType::EaseType::customCurve;
-		}
-		else if (map["ease"].Contains("easeInAndOutBack") || map["ease"].Contains("ioback"))
-		{
-			easeType = EEaseType::EaseType::easeInAndOutBack;
-		}
-		else if (map["ease"].Contains("easeInAndOutBounce") || map["ease"].Contains("iobounce"))
-		{
-			easeType = EEaseType::EaseType::easeInAndOutBounce;
-		}
-		else if (map["ease"].Contains("easeInAndOutCircular") || map["ease"].Contains("iocirc"))
-		{
-			easeType = EEaseType::EaseType::easeInAndOutCircular;
-		}
-		else if (map["ease"].Contains("easeInAndOutCubic") || map["ease"].Contains("iocubic"))
-		{
-			easeType = EEaseType::EaseType::easeInAndOutCubic;
-		}
-		else if (map["ease"].Contains("easeInAndOutElastic") || map["ease"].Contains("ioelas"))
-		{
-			easeType = EEaseType::EaseType::easeInAndOutElastic;
-		}
-		else if (map["ease"].Contains("easeInAndOutExponential") || map["ease"].Contains("ioexpo"))
-		{
-			easeType = EEaseType::EaseType::easeInAndOutExponential;
-		}
-		else if (map["ease"].Contains("easeInAndOutQuadratic") || map["ease"].Contains("ioquad"))
-		{
-			easeType = EEaseType::EaseType::easeInAndOutQuadratic;
-		}
-		else if (map["ease"].Contains("easeInAndOutQuartic") || map["ease"].Contains("ioquart"))
-		{
-			easeType = EEaseType::EaseType::easeInAndOutQuartic;
-		}
-		else if (map["ease"].Contains("easeInAndOutQuintic") || map["ease"].Contains("ioquint"))
-		{
-			easeType = EEaseType::EaseType::easeInAndOutQuintic;
-		}
-		else if (map["ease"].Contains("easeInAndOutSine") || map["ease"].Contains("iosine"))
-		{
-			easeType = EEaseType::EaseType::easeInAndOutSine;
-		}
-		else if (map["ease"].Contains("easeInBack") || map["ease"].Contains("iback"))
-		{
-			easeType = EEaseType::EaseType::easeInBack;
-		}
-		else if (map["ease"].Contains("easeInBounce") || map["ease"].Contains("ibounce"))
-		{
-			easeType = EEaseType::EaseType::easeInBounce;
-		}
-		else if (map["ease"].Contains("easeInCircular") || map["ease"].Contains("icirc"))
-		{
-			easeType = EEaseType::EaseType::easeInCircular;
-		}
-		else if (map["ease"].Contains("easeInCubic") || map["ease"].Contains("icubic"))
-		{
-			easeType = EEaseType::EaseType::easeInCubic;
-		}
-		else if (map["ease"].Contains("easeInElastic") || map["ease"].Contains("ielas"))
-		{
-			easeType = EEaseType::EaseType::easeInElastic;
-		}
-		else if (map["ease"].Contains("easeInExponential") || map["ease"].Contains("iexpo"))
-		{
-			easeType = EEaseType::EaseType::easeInExponential;
-		}
-		else if (map["ease"].Contains("easeInQuadratic") || map["ease"].Contains("iquad"))
-		{
-			easeType = EEaseType::EaseType::easeInQuadratic;
-		}
-		else if (map["ease"].Contains("easeInQuartic") || map["ease"].Contains("iquart"))
-		{
-			easeType = EEaseType::EaseType::easeInQuartic;
-		}
-		else if (map["ease"].Contains("easeInQuintic") || map["ease"].Contains("iquint"))
-		{
-			easeType = EEaseType::EaseType::easeInQuintic;
-		}
-		else if (map["ease"].Contains("easeInSine") || map["ease"].Contains("isine"))
-		{
-			easeType = EEaseType::EaseType::easeInSine;
-		}
-		else if (map["ease"].Contains("easeOutBack") || map["ease"].Contains("oback"))
-		{
-			easeType = EEaseType::EaseType::easeOutBack;
-		}
-		else if (map["ease"].Contains("easeOutBounce") || map["ease"].Contains("obounce"))
-		{
-			easeType = EEaseType::EaseType::easeOutBounce;
-		}
-		else if (map["ease"].Contains("easeOutCircular") || map["ease"].Contains("ocirc"))
-		{
-			easeType = EEaseType::EaseType::easeOutCircular;
-		}
-		else if (map["ease"].Contains("easeOutCubic") || map["ease"].Contains("ocubic"))
-		{
-			easeType = EEaseType::EaseType::easeOutCubic;
-		}
-		else if (map["ease"].Contains("easeOutElastic") || map["ease"].Contains("oelas"))
-		{
-			easeType = EEaseType::EaseType::easeOutElastic;
-		}
-		else if (map["ease"].Contains("easeOutExponential") || map["ease"].Contains("oexpo"))
-		{
-			easeType = EEaseType::EaseType::easeOutExponential;
-		}
-		else if (map["ease"].Contains("easeOutQuadratic") || map["ease"].Contains("oquad"))
-		{
-			easeType = EEaseType::EaseType::easeOutQuadratic;
-		}
-		else if (map["ease"].Contains("easeOutQuartic") || map["ease"].Contains("oquart"))
-		{
-			easeType = EEaseType::EaseType::easeOutQuartic;
-		}
-		else if (map["ease"].Contains("easeOutQuintic") || map["ease"].Contains("oquint"))
-		{
-			easeType = EEaseType::EaseType::easeOutQuintic;
-		}
-		else if (map["ease"].Contains("easeOutSine") || map["ease"].Contains("osine"))
-		{
-			easeType = EEaseType::EaseType::easeOutSine;
-		}
+void AiTweenEvent::ApplyParameters(const FiTweenParams& params)
+{
+	if (params.overrideTweenName)
+	{
+		tweenName = params.tweenName;
+	}
 
-		UiTween::Print("easeType: " + map["ease"]);
+	if (params.overrideFloatFrom)
+	{
+		floatFrom = params.floatFromCurrent ? GetCurrentFloat(params.currentScales[FiTweenParams::currentFloatFrom]) : params.floatFrom;
 	}
 
-	if (map.Contains("timerinterval"))
+	if (params.overrideFloatTo)
 	{
-		map.Add("tiin", map["timerinterval"]);
-		map.Remove(map["timerinterval"]);
+		floatTo = params.floatToCurrent ? GetCurrentFloat(params.currentScales[FiTweenParams::currentFloatTo]) : params.floatTo;
 	}
 
-	if (map.Contains("interval"))
+	if (params.overrideCoordinateSpace)
 	{
-		map.Add("tiin", map["interval"]);
-		map.Remove(map["interval"]);
+		coordinateSpace = params.coordinateSpace;
 	}
 
-	if (map.Contains("tiin"))
+	if (params.overrideVectorFrom)
 	{
-		map["tiin"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["tiin"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["tiin"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["tiin"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["tiin"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["tiin"].ReplaceInline(TEXT("]"), TEXT(" "));
+		vectorFrom = params.vectorFromCurrent ? GetCurrentVector(params.currentScales[FiTweenParams::currentVectorFrom]) : params.vectorFrom;
+	}
 
-		map["tiin"].Trim();
-		map["tiin"].TrimTrailing();
+	if (params.overrideVectorTo)
+	{
+		vectorTo = params.vectorToCurrent ? GetCurrentVector(params.currentScales[FiTweenParams::currentVectorTo]) : params.vectorTo;
+	}
 
-		timerInterval = FCString::Atof(*map["tiin"]);
+	if (params.overrideVector2DFrom)
+	{
+		vector2DFrom = params.vector2DFromCurrent ? GetCurrentVector2D(params.currentScales[FiTweenParams::currentVector2DFrom]) : params.vector2DFrom;
+	}
 
-		if (map["tiin"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["tiin"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
+	if (params.overrideVector2DTo)
+	{
+		vector2DTo = params.vector2DToCurrent ? GetCurrentVector2D(params.currentScales[FiTweenParams::currentVector2DTo]) : params.vector2DTo;
+	}
 
-			timerInterval *= FCString::Atof(*right);
-		}
+	if (params.overrideRotatorFrom)
+	{
+		rotatorFrom = params.rotatorFromCurrent ? GetCurrentRotator(params.currentScales[FiTweenParams::currentRotatorFrom]) : params.rotatorFrom;
+	}
 
-		if (map["tiin"].Contains("fps"))
-		{
-			timerInterval = 1 / timerInterval;
-		}
+	if (params.overrideRotatorTo)
+	{
+		rotatorTo = params.rotatorToCurrent ? GetCurrentRotator(params.currentScales[FiTweenParams::currentRotatorTo]) : params.rotatorTo;
+	}
 
-		UiTween::Print("timerInterval: " + FString::SanitizeFloat(timerInterval));
+	if (params.overrideLinearColorFrom)
+	{
+		linearColorFrom = params.linearColorFrom;
 	}
 
-	if (map.Contains("tietoobjectvalidity"))
+	if (params.overrideLinearColorTo)
 	{
-		map.Add("tov", map["tietoobjectvalidity"]);
-		map.Remove(map["tietoobjectvalidity"]);
+		linearColorTo = params.linearColorTo;
 	}
 
-	if (map.Contains("tova"))
+	if (params.overrideDelayType)
 	{
-		if (map["tov"].Contains("true"))
-		{
-			tieToObjectValidity = true;
-		}
-		else
-		{
-			tieToObjectValidity = false;
-		}
+		delayType = params.delayType;
+	}
 
-		UiTween::Print("tieToObjectValidity: " + map["tov"]);
+	if (params.overrideDelay)
+	{
+		delay = params.delay;
 	}
 
-	if (map.Contains("enforcevalueto"))
+	if (params.overrideTickType)
 	{
-		map.Add("evt", map["enforcevalueto"]);
-		map.Remove(map["enforcevalueto"]);
+		tickType = params.tickType;
 	}
 
-	if (map.Contains("evt"))
+	if (params.overrideTickTypeValue)
 	{
-		if (map["evt"].Contains("true"))
-		{
-			enforceValueTo = true;
-		}
-		else
-		{
-			enforceValueTo = false;
-		}
+		tickTypeValue = params.tickTypeValue;
+	}
 
-		UiTween::Print("enforceValueTo: " + map["evt"]);
+	if (params.overridePunchAmplitude)
+	{
+		punchAmplitude = params.punchAmplitude;
 	}
 
-	if (map.Contains("maximumloopsections"))
+	if (params.overrideGeneratedPointDistance)
 	{
-		map.Add("mls", map["maximumloopsections"]);
-		map.Remove(map["maximumloopsections"]);
+		generatedPointDistance = params.generatedPointDistance;
 	}
 
-	if (map.Contains("maxloops"))
+	if (params.overrideSweep)
 	{
-		map.Add("mls", map["maxloops"]);
-		map.Remove(map["maxloops"]);
+		sweep = params.sweep;
 	}
 
-	if (map.Contains("mls"))
+	if (params.overrideVectorConstraints)
 	{
-		map["mls"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["mls"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["mls"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["mls"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["mls"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["mls"].ReplaceInline(TEXT("]"), TEXT(" "));
+		vectorConstraints = params.vectorConstraints;
+	}
 
-		map["mls"].Trim();
-		map["mls"].TrimTrailing();
+	if (params.overrideVector2DConstraints)
+	{
+		vector2DConstraints = params.vector2DConstraints;
+	}
 
-		maximumLoopSections = FCString::Atoi(*map["mls"]);
+	if (params.overrideRotatorConstraints)
+	{
+		rotatorConstraints = params.rotatorConstraints;
+	}
 
-		if (map["mls"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["mls"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
+	if (params.overrideLoopType)
+	{
+		loopType = params.loopType;
+	}
 
-			maximumLoopSections *= FCString::Atoi(*right);
-		}
+	if (params.overrideOrientation)
+	{
+		orientation = params.orientation;
+	}
 
-		UiTween::Print("maximumLoopSections: " + FString::FromInt(maximumLoopSections));
+	if (params.overrideOrientationSpeed)
+	{
+		orientationSpeed = params.orientationSpeed;
 	}
 
-	if (map.Contains("cullnonrenderedtweens"))
+	if (params.overrideTickWhenPaused)
 	{
-		map.Add("cull", map["cullnonrenderedtweens"]);
-		map.Remove(map["cullnonrenderedtweens"]);
+		tickWhenPaused = params.tickWhenPaused;
 	}
 
-	if (map.Contains("cull"))
+	if (params.overrideIgnoreTimeDilation)
 	{
-		if (map["cull"].Contains("true"))
-		{
-			cullNonRenderedTweens = true;
-		}
-		else
-		{
-			cullNonRenderedTweens = false;
-		}
+		ignoreTimeDilation = params.ignoreTimeDilation;
+	}
 
-		UiTween::Print("cullNonRenderedTweens: " + map["cull"]);
+	if (params.overrideInterpolateToSpline)
+	{
+		interpolateToSpline = params.interpolateToSpline;
 	}
 
-	if (map.Contains("secondstowaitbeforecull"))
+	if (params.overrideSwitchPathOrientationDirection)
 	{
-		map.Add("stwbc", map["secondstowaitbeforecull"]);
-		map.Remove(map["secondstowaitbeforecull"]);
+		switchPathOrientationDirection = params.switchPathOrientationDirection;
 	}
 
-	if (map.Contains("cullwait"))
+	if (params.overrideDestroySplineObject)
 	{
-		map.Add("stwbc", map["cullwait"]);
-		map.Remove(map["cullwait"]);
+		destroySplineObject = params.destroySplineObject;
 	}
 
-	if (map.Contains("stwbc"))
+	if (params.overrideShortestPath)
 	{
-		map["stwbc"].ReplaceInline(TEXT("("), TEXT(" "));
-		map["stwbc"].ReplaceInline(TEXT("{"), TEXT(" "));
-		map["stwbc"].ReplaceInline(TEXT("["), TEXT(" "));
-		map["stwbc"].ReplaceInline(TEXT(")"), TEXT(" "));
-		map["stwbc"].ReplaceInline(TEXT("}"), TEXT(" "));
-		map["stwbc"].ReplaceInline(TEXT("]"), TEXT(" "));
+		shortestPath = params.shortestPath;
+	}
 
-		map["stwbc"].Trim();
-		map["stwbc"].TrimTrailing();
+	if (params.overrideEaseType)
+	{
+		easeType = params.easeType;
+	}
 
-		secondsToWaitBeforeCull = FCString::Atof(*map["stwbc"]);
+	if (params.overrideTimerInterval)
+	{
+		timerInterval = params.timerInterval;
+	}
 
-		if (map["stwbc"].Contains("*"))
-		{
-			FString left;
-			FString right;
-			map["stwbc"].Split("*", &left, &right, ESearchCase::IgnoreCase, ESearchDir::FromStart);
+	if (params.overrideTieToObjectValidity)
+	{
+		tieToObjectValidity = params.tieToObjectValidity;
+	}
 
-			secondsToWaitBeforeCull *= FCString::Atof(*right);
-		}
+	if (params.overrideEnforceValueTo)
+	{
+		enforceValueTo = params.enforceValueTo;
+	}
 
-		UiTween::Print("secondsToWaitBeforeCull: " + FString::SanitizeFloat(secondsToWaitBeforeCull));
+	if (params.overrideMaximumLoopSections)
+	{
+		maximumLoopSections = params.maximumLoopSections;
+	}
+
+	if (params.overrideCullNonRenderedTweens)
+	{
+		cullNonRenderedTweens = params.cullNonRenderedTweens;
 	}
 
-	if (map.Contains("startfunction"))
+	if (params.overrideSecondsToWaitBeforeCull)
 	{
-		map.Add("osfn", map["startfunction"]);
-		map.Remove(map["startfunction"]);
+		secondsToWaitBeforeCull = params.secondsToWaitBeforeCull;
 	}
 
-	if (map.Contains("osfn"))
+	//Only a named delegate allocates its name
+	if (!params.OnTweenStartFunctionName.IsEmpty())
 	{
-		OnTweenStartFunctionName = map["osfn"];
+		OnTweenStartFunctionName = params.OnTweenStartFunctionName;
 	}
 
-	if (map.Contains("updatefunction"))
+	if (!params.OnTweenUpdateFunctionName.IsEmpty())
 	{
-		map.Add("oufn", map["updatefunction"]);
-		map.Remove(map["updatefunction"]);
+		OnTweenUpdateFunctionName = params.OnTweenUpdateFunctionName;
 	}
 
-	if (map.Contains("tickfunction"))
+	if (!params.OnTweenLoopFunctionName.IsEmpty())
 	{
-		map.Add("oufn", map["tickfunction"]);
-		map.Remove(map["tickfunction"]);
+		OnTweenLoopFunctionName = params.OnTweenLoopFunctionName;
 	}
 
-	if (map.Contains("oufn"))
+	if (!params.OnTweenCompleteFunctionName.IsEmpty())
 	{
-		OnTweenUpdateFunctionName = map["oufn"];
+		OnTweenCompleteFunctionName = params.OnTweenCompleteFunctionName;
 	}
+}
 
-	if (map.Contains("loopfunction"))
+float AiTweenEvent::GetCurrentFloat(float scale)
+{
+	if (widgetTweening != nullptr && eventType == EEventType::EventType::umgRTRotateFromTo)
 	{
-		map.Add("olfn", map["loopfunction"]);
-		map.Remove(map["loopfunction"]);
+		return widgetTweening->RenderTransform.Angle * scale;
 	}
 
-	if (map.Contains("olfn"))
+	UiTween::Print("You aren't performing a UMG RT Rotate From/To operation. The 'current' and 'this' keywords only apply to that operation. Defaulting to 0.", "error");
+	return 0.f;
+}
+
+FVector AiTweenEvent::GetCurrentVector(float scale)
+{
+	if (actorTweening != nullptr)
+	{
+		return actorTweening->GetActorLocation() * scale;
+	}
+	else if (componentTweening != nullptr)
 	{
-		OnTweenLoopFunctionName = map["olfn"];
+		return componentTweening->GetComponentLocation() * scale;
 	}
 
-	//of course it's a...
-	if (map.Contains("completefunction"))
+	UiTween::Print("You aren't performing an Actor- or SceneComponent-based operation. The 'current' and 'this' keywords only apply to those operations. Defaulting to (0,0,0).", "error");
+	return FVector::ZeroVector;
+}
+
+FVector2D AiTweenEvent::GetCurrentVector2D(float scale)
+{
+	if (widgetTweening != nullptr)
+	{
+		if (eventType == EEventType::EventType::umgRTMoveFromTo)
+		{
+			return widgetTweening->RenderTransform.Translation * scale;
+		}
+		else if (eventType == EEventType::EventType::umgRTScaleFromTo)
+		{
+			return widgetTweening->RenderTransform.Scale * scale;
+		}
+		else if (eventType == EEventType::EventType::umgRTShearFromTo)
+		{
+			return widgetTweening->RenderTransform.Shear * scale;
+		}
+	}
+#if !PLATFORM_ANDROID
+	else if (slateTweening)
 	{
-		map.Add("ocfn", map["completefunction"]);
-		map.Remove(map["completefunction"]);
+		if (eventType == EEventType::EventType::slateMoveFromTo)
+		{
+			return slateTweening->TweenTransform.Translation * scale;
+		}
+		else if (eventType == EEventType::EventType::slateScaleFromTo)
+		{
+			return slateTweening->TweenTransform.Scale * scale;
+		}
 	}
+#endif
+
+	UiTween::Print("You aren't performing a Slate or UMG RT Move, Scale, or Shear From/To operation. The 'current' and 'this' keywords only apply to those operations. Defaulting to (0,0).", "error");
+	return FVector2D::ZeroVector;
+}
 
-	if (map.Contains("ocfn"))
+FRotator AiTweenEvent::GetCurrentRotator(float scale)
+{
+	if (actorTweening != nullptr)
 	{
-		OnTweenCompleteFunctionName = map["ocfn"];
+		return actorTweening->GetActorRotation() * scale;
 	}
+	else if (componentTweening != nullptr)
+	{
+		return componentTweening->GetComponentRotation() * scale;
+	}
+
+	UiTween::Print("You aren't performing an Actor- or SceneComponent-based operation. The 'current' and 'this' keywords only apply to those operations. Defaulting to (0,0,0).", "error");
+	return FRotator::ZeroRotator;
 }
 
 void AiTweenEvent::IgnorePauseTimeDilationSettings()
@@ -2100,405 +534,22 @@ void AiTweenEvent::SetTickTypeValue()
 
 float AiTweenEvent::GetAlphaFromEquation(float value)
 {
-	//Big thanks to Bob Berkebile at PixelPlacement for the original iTween equation interpretations. Unlike the rest of 
-	//iTween for UE4, Easetype equations are taken almost 100% verbatim from iTween source code (with Bob's permission, 
-	//of course).
-
-	//TERMS OF USE - EASING EQUATIONS Open source under the BSD License. Copyright(c)2001 Robert PennerAll rights reserved. 
-
-	//Redistribution and use in source and binary forms, with or without modification, are permitted provided that the 
-	//following conditions are met : Redistributions of source code must retain the above copyright notice, this list 
-	//of conditions and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
-	//notice, this list of conditions and the following disclaimer in the documentation and / or other materials 
-	//provided with the distribution. Neither the name of the author nor the names of contributors may be used to endorse 
-	//or promote products derived from this software without specific prior written permission. THIS SOFTWARE IS PROVIDED 
-	//BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED 
-	//TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL 
-	//THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR 
-	//CONSEQUENTIAL DAMAGES(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, 
-	//OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT 
-	//LIABILITY, OR TORT(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
-	//ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-	switch (easeType)
-	{
-
-	case EEaseType::EaseType::linear:
-		return value;
-
-	case EEaseType::EaseType::spring:
-	{
-				   value = FMath::Clamp<float>(value, start, end);
-				   value = (FMath::Sin(value * pi * (0.2f + 2.5f * value * value * value)) * FMath::Pow(1.f - value, 2.2f) + value) * (1.f + (1.2f * (1.f - value)));
-				   return start + (end - start) * value;
-	}
-
-
-	case EEaseType::EaseType::easeInQuadratic:
-	{
-							end -= start;
-							return end * value * value + start;
-	}
-
-
-	case EEaseType::EaseType::easeOutQuadratic:
-	{
-							 end -= start;
-							 return -end * value * (value - 2) + start;
-	}
-
-
-	case EEaseType::EaseType::easeInAndOutQuadratic:
-	{
-								  value /= 0.5f;
-								  end -= start;
-								  if (value < 1) return end / 2 * value * value + start;
-								  value--;
-								  return -end / 2 * (value * (value - 2) - 1) + start;
-	}
-
-
-	case EEaseType::EaseType::easeInCubic:
-	{
-						end -= start;
-						return end * value * value * value + start;
-	}
-
-
-	case EEaseType::EaseType::easeOutCubic:
-	{
-						 value--;
-						 end -= start;
-						 return end * (value * value * value + 1) + start;
-	}
-
-
-	case EEaseType::EaseType::easeInAndOutCubic:
-	{
-							  value /= 0.5f;
-							  end -= start;
-							  if (value < 1) return end / 2 * value * value * value + start;
-							  value -= 2;
-							  return end / 2 * (value * value * value + 2) + start;
-	}
-
-
-	case EEaseType::EaseType::easeInQuartic:
-	{
-						  end -= start;
-						  return end * value * value * value * value + start;
-	}
-
-
-	case EEaseType::EaseType::easeOutQuartic:
-	{
-						   value--;
-						   end -= start;
-						   return -end * (value * value * value * value - 1) + start;
-	}
-
-
-	case EEaseType::EaseType::easeInAndOutQuartic:
-	{
-								value /= 0.5f;
-								end -= start;
-								if (value < 1) return end / 2 * value * value * value * value + start;
-								value -= 2;
-								return -end / 2 * (value * value * value * value - 2) + start;
-	}
-
-
-	case EEaseType::EaseType::easeInQuintic:
-	{
-						  end -= start;
-						  return end * value * value * value * value * value + start;
-	}
-
-
-	case EEaseType::EaseType::easeOutQuintic:
-	{
-						   value--;
-						   end -= start;
-						   return end * (value * value * value * value * value + 1) + start;
-	}
-
-
-	case EEaseType::EaseType::easeInAndOutQuintic:
-	{
-								value /= 0.5f;
-								end -= start;
-								if (value < 1) return end / 2 * value * value * value * value * value + start;
-								value -= 2;
-								return end / 2 * (value * value * value * value * value + 2) + start;
-	}
-
-
-	case EEaseType::EaseType::easeInSine:
-	{
-					   end -= start;
-					   return -end * FMath::Cos(value / 1 * (pi / 2)) + end + start;
-	}
-
-
-	case EEaseType::EaseType::easeOutSine:
-	{
-						end -= start;
-						return end * FMath::Sin(value / 1 * (pi / 2)) + start;
-	}
-
-
-	case EEaseType::EaseType::easeInAndOutSine:
-	{
-							 end -= start;
-							 return -end / 2 * (FMath::Cos(pi * value / 1) - 1) + start;
-	}
-
-
-	case EEaseType::EaseType::easeInExponential:
-	{
-							  end -= start;
-							  return end * FMath::Pow(2, 10 * (value / 1 - 1)) + start;
-	}
-
-
-	case EEaseType::EaseType::easeOutExponential:
-	{
-							   end -= start;
-							   return end * (-FMath::Pow(2, -10 * value / 1) + 1) + start;
-	}
-
-
-	case EEaseType::EaseType::easeInAndOutExponential:
-	{
-									value /= 0.5f;
-									end -= start;
-									if (value < 1) return end / 2 * FMath::Pow(2, 10 * (value - 1)) + start;
-									value--;
-									return end / 2 * (-FMath::Pow(2, -10 * value) + 2) + start;
-	}
-
-
-	case EEaseType::EaseType::easeInCircular:
-	{
-						   end -= start;
-						   return -end * (FMath::Sqrt(1 - value * value) - 1) + start;
-	}
-
-
-	case EEaseType::EaseType::easeOutCircular:
-	{
-							value--;
-							end -= start;
-							return end * FMath::Sqrt(1 - value * value) + start;
-	}
-
-
-	case EEaseType::EaseType::easeInAndOutCircular:
-	{
-								 value /= 0.5f;
-								 end -= start;
-								 if (value < 1) return -end / 2 * (FMath::Sqrt(1 - value * value) - 1) + start;
-								 value -= 2;
-								 return end / 2 * (FMath::Sqrt(1 - value * value) + 1) + start;
-	}
-
-
-	case EEaseType::EaseType::easeInBounce:
-		return EaseInBounce(value);
-
-	case EEaseType::EaseType::easeOutBounce:
-		return EaseOutBounce(value);
-
-
-	case EEaseType::EaseType::easeInAndOutBounce:
-		return EaseInOutBounce(value);
-
-	case EEaseType::EaseType::easeInBack:
-	{
-					   end -= start;
-					   value /= 1;
-					   float s = 1.70158f;
-					   return end * (value)* value * ((s + 1) * value - s) + start;
-	}
-
-
-	case EEaseType::EaseType::easeOutBack:
-	{
-						float s = 1.70158f;
-						end -= start;
-						value = (value / 1) - 1;
-						return end * ((value)* value * ((s + 1) * value + s) + 1) + start;
-	}
-
-
-	case EEaseType::EaseType::easeInAndOutBack:
-	{
-							 float s = 1.70158f;
-							 end -= start;
-							 value /= 0.5f;
-							 if ((value) < 1){
-								 s *= (1.525f);
-								 return end / 2 * (value * value * (((s)+1) * value - s)) + start;
-							 }
-							 value -= 2;
-							 s *= (1.525f);
-							 return end / 2 * ((value)* value * (((s)+1) * value + s) + 2) + start;
-	}
-
-
-	case EEaseType::EaseType::punch:
-	{
-				  float s = 9;
-				  if (value == 0){
-					  return 0;
-				  }
-				  if (value == 1){
-					  return 0;
-				  }
-				  float period = 1 * 0.3f;
-				  s = period / (2 * pi) * FMath::Asin(0);
-				  return (punchAmplitude * FMath::Pow(2, -10 * value) * FMath::Sin((value * 1 - s) * (2 * pi) / period));
-	}
-
-
-	case EEaseType::EaseType::easeInElastic:
-	{
-						  end -= start;
-
-						  float d = 1.f;
-						  float p = d * 0.3f;
-						  float s = 0;
-						  float a = 0;
-
-						  if (value == 0) return start;
-
-						  if ((value /= d) == 1) return start + end;
-
-						  if (a == 0.f || a < FMath::Abs(end)){
-							  a = end;
-							  s = p / 4;
-						  }
-						  else{
-							  s = p / (2 * pi) * FMath::Asin(end / a);
-						  }
-						  value -= 1;
-						  return -(a * FMath::Pow(2, 10 * (value)) * FMath::Sin((value * d - s) * (2 * pi) / p)) + start;
-	}
-
-
-	case EEaseType::EaseType::easeOutElastic:
-		//Thank you to rafael.marteleto for fixing this as a port over from Pedro's UnityTween
-	{
-						   end -= start;
-
-						   float d = 1.f;
-						   float p = d * 0.3f;
-						   float s = 0;
-						   float a = 0;
-
-						   if (value == 0) return start;
-
-						   if ((value /= d) == 1) return start + end;
-
-						   if (a == 0.f || a < FMath::Abs(end)){
-							   a = end;
-							   s = p / 4;
-						   }
-						   else{
-							   s = p / (2 * pi) * FMath::Asin(end / a);
-						   }
-
-						   return (a * FMath::Pow(2, -10 * value) * FMath::Sin((value * d - s) * (2 * pi) / p) + end + start);
-	}
-
-
-	case EEaseType::EaseType::easeInAndOutElastic:
-	{
-								end -= start;
-
-								float d = 1.f;
-								float p = d * 0.3f;
-								float s = 0;
-								float a = 0;
-
-								if (value == 0) return start;
-
-								if ((value /= d / 2) == 2) return start + end;
-
-								if (a == 0.f || a < FMath::Abs(end)){
-									a = end;
-									s = p / 4;
-								}
-								else{
-									s = p / (2 * pi) * FMath::Asin(end / a);
-								}
-
-#if !PLATFORM_IOS && !PLATFORM_ANDROID
-								if (value < 1) return -0.5f * (a * FMath::Pow(2, 10 * (value -= 1)) * FMath::Sin((value * d - s) * (2 * pi) / p)) + start;
-								return a * FMath::Pow(2, -10 * (value -= 1)) * FMath::Sin((value * d - s) * (2 * pi) / p) * 0.5f + end + start;
-#else //This is still broken on mobile, but at least you'll be able to build. Instead, try using ease in elastic then ease out elastic.
-								value = value - 1;
-								if (value < 1) return -0.5f * (a * FMath::Pow(2, 10 * (value)) * FMath::Sin((value * d - s) * (2 * pi) / p)) + start;
-								return a * FMath::Pow(2, -10 * (value)) * FMath::Sin((value * d - s) * (2 * pi) / p) * 0.5f + end + start;
-#endif
-	}
-
-	case EEaseType::EaseType::customCurve:
-	{
-						if (customEaseTypeCurve)
-						{
-							return customEaseTypeCurve->GetFloatValue(value);
-						}
-						else
-						{
-							return value;
-						}
-	}
-	default:
-		return value;
-	}
+	return FiTweenEasing::Evaluate(easeType, value, customEaseTypeCurve, punchAmplitude);
 }
 
 float AiTweenEvent::EaseInBounce(float value)
 {
-	end -= start;
-	float d = 1.f;
-	return end - EaseOutBounce(d - value) + start;
+	return FiTweenEasing::EaseInBounce(value);
 }
 
 float AiTweenEvent::EaseOutBounce(float value)
 {
-	value /= 1.f;
-	end -= start;
-	if (value < (1 / 2.75f)){
-		return end * (7.5625f * value * value) + start;
-	}
-	else if (value < (2 / 2.75f)){
-		value -= (1.5f / 2.75f);
-		return end * (7.5625f * (value)* value + 0.75f) + start;
-	}
-	else if (value < (2.5 / 2.75)){
-		value -= (2.25f / 2.75f);
-		return end * (7.5625f * (value)* value + 0.9375f) + start;
-	}
-	else{
-		value -= (2.625f / 2.75f);
-		return end * (7.5625f * (value)* value + 0.984375f) + start;
-	}
+	return FiTweenEasing::EaseOutBounce(value);
 }
 
 float AiTweenEvent::EaseInOutBounce(float value)
 {
-	end -= start;
-	float d = 1.f;
-	if (value < d / 2)
-	{
-		return EaseInBounce(value *= 2) * 0.5f + start;
-	}
-	else
-	{
-		return EaseOutBounce(value * 2 - d) * 0.5f + end*0.5f + start;
-	}
+	return FiTweenEasing::EaseInOutBounce(value);
 }
 
 void AiTweenEvent::EndPhase()
@@ -2974,6 +1025,12 @@ void AiTweenEvent::InitEvent()
 	//Validate nodes
 	CheckTargetValidity();
 
+	//The tween name and the tweening object are set by now, index the event by them
+	if (aux)
+	{
+		aux->tweenRegistry.UpdateKeys(this);
+	}
+
 	//Check if delay is needed
 	CheckIfFirstDelay();
 
@@ -5,6 +5,7 @@
 #include "iTweenPCH.h"
 #include "iTAux.h"
 #include "iTInterface.h"
+#include "iTParams.h"
 #include "iTweenEvent.generated.h"
 
 /**
@@ -236,6 +237,7 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Generic Properties")
 		float actorTimeDilation = 1.f;
 
+	//Given at spawn and never reused, the ByIndex functions find the event by it
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Generic Properties")
 		int32 tweenIndex = 0;
 
@@ -320,7 +322,17 @@ public:
 		void UpdateTween();
 
 	UFUNCTION()
-		void ParseParameters(FString params);
+		void ParseParameters(const FString& params);
+
+	//Apply the overridden values of the typed parameters, e.g. built without any string
+	UFUNCTION(BlueprintCallable, Category = "iTween")
+		void ApplyParameters(const FiTweenParams& params);
+
+	//The values the 'current' and 'this' parameter keywords read from the tweened object
+	float GetCurrentFloat(float scale);
+	FVector GetCurrentVector(float scale);
+	FVector2D GetCurrentVector2D(float scale);
+	FRotator GetCurrentRotator(float scale);
 
 	UFUNCTION()
 		void IgnorePauseTimeDilationSettings();